@@ -0,0 +1,68 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header that defines advanced related properties for the automatic batching plugin.
+ * These properties should be used in SetConfig() and LoadNetwork() methods
+ *
+ * @file auto_batch_config.hpp
+ */
+
+#pragma once
+
+#include <string>
+#include "ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Automatic batching plugin configuration
+ */
+namespace AutoBatchConfigParams {
+
+/**
+ * @def AUTO_BATCH_CONFIG_KEY(name)
+ * @brief A macro which provides an AUTO_BATCH-mangled name for configuration key with name `name`
+ */
+#define AUTO_BATCH_CONFIG_KEY(name) InferenceEngine::AutoBatchConfigParams::_CONFIG_KEY(AUTO_BATCH_##name)
+
+#define DECLARE_AUTO_BATCH_CONFIG_KEY(name) DECLARE_CONFIG_KEY(AUTO_BATCH_##name)
+#define DECLARE_AUTO_BATCH_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(AUTO_BATCH_##name)
+
+/**
+ * @brief The device to execute batched requests on, optionally followed by the batch size in brackets, e.g. "CPU(16)".
+ * The batch size is 8 if omitted. The "BATCH:<device>" device name sets this key implicitly
+ */
+DECLARE_AUTO_BATCH_CONFIG_KEY(DEVICE);
+
+/**
+ * @brief Time in milliseconds a request waits for other requests to form a batch, 5 by default.
+ * When it expires, the collected requests are executed one by one without batching
+ */
+DECLARE_AUTO_BATCH_CONFIG_KEY(TIMEOUT);
+
+}  // namespace AutoBatchConfigParams
+
+namespace Metrics {
+
+/**
+ * @def AUTO_BATCH_METRIC(name)
+ * @brief Shortcut for defining automatic batching plugin metrics
+ */
+#define AUTO_BATCH_METRIC(name) METRIC_KEY(AUTO_BATCH_##name)
+#define DECLARE_AUTO_BATCH_METRIC(name, ...) DECLARE_METRIC_KEY(AUTO_BATCH_##name, __VA_ARGS__)
+
+/**
+ * @brief ExecutableNetwork metric to get a float of the average number of requests executed at once
+ */
+DECLARE_AUTO_BATCH_METRIC(AVERAGE_BATCH_SIZE, float);
+
+/**
+ * @brief ExecutableNetwork metric to get a float of the average time in milliseconds requests spent
+ * waiting for a batch to be formed
+ */
+DECLARE_AUTO_BATCH_METRIC(AVERAGE_QUEUE_DELAY, float);
+
+}  // namespace Metrics
+}  // namespace InferenceEngine
@@ -206,6 +206,18 @@ public:
         CALL_STATUS_FNC(SetBatch, batch);
     }
 
+    /**
+     * @copybrief IInferRequest::InferChunked
+     *
+     * Wraps IInferRequest::InferChunked
+     * @param inputs Map of input names to blobs with input sequences
+     * @param outputs Map of output names to preallocated blobs for output sequences
+     * @param chunkSize Number of sequence elements inferred at once
+     */
+    void InferChunked(const BlobMap& inputs, const BlobMap& outputs, size_t chunkSize) {
+        CALL_STATUS_FNC(InferChunked, inputs, outputs, chunkSize);
+    }
+
     /**
      * @brief Start inference of specified input(s) in asynchronous mode
      *
@@ -72,6 +72,16 @@ public:
     void SetState(Blob::Ptr state) {
         CALL_STATUS_FNC(SetState, state);
     }
+
+    /**
+     * @copybrief IMemoryState::SaveState
+     *
+     * Wraps IMemoryState::SaveState
+     * @param state A blob to copy the last state to
+     */
+    void SaveState(Blob::Ptr state) const {
+        CALL_STATUS_FNC(SaveState, state);
+    }
 };
 
 }  // namespace InferenceEngine
\ No newline at end of file
@@ -0,0 +1,102 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header that defines advanced related properties for CPU plugin.
+ * These properties should be used in SetConfig() and LoadNetwork() methods of plugins
+ *
+ * @file cpu_config.hpp
+ */
+
+#pragma once
+
+#include <string>
+#include "ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief CPU plugin configuration
+ */
+namespace CPUConfigParams {
+
+/**
+ * @def CPU_CONFIG_KEY(name)
+ * @brief Shortcut for defining CPU configuration keys
+ */
+#define CPU_CONFIG_KEY(name) InferenceEngine::CPUConfigParams::_CONFIG_KEY(CPU_##name)
+/**
+ * @def CPU_CONFIG_VALUE(name)
+ * @brief Shortcut for defining CPU configuration values
+ */
+#define CPU_CONFIG_VALUE(name) InferenceEngine::CPUConfigParams::CPU_##name
+
+#define DECLARE_CPU_CONFIG_KEY(name) DECLARE_CONFIG_KEY(CPU_##name)
+#define DECLARE_CPU_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(CPU_##name)
+
+/**
+ * @brief Storage precision of constant embedding tables consumed by EmbeddingBagOffsetsSum,
+ * EmbeddingBagPackedSum and EmbeddingSegmentsSum layers.
+ * Supported values are "FP32" (default, the table is kept as is), "FP16", "BF16" and "U8".
+ * "U8" stores every row as 8-bit values with a per-row FP32 scale and bias.
+ * Compressed rows are converted back to FP32 on the fly while they are accumulated into the output.
+ */
+DECLARE_CPU_CONFIG_KEY(EMBEDDING_TABLE_PRECISION);
+
+/**
+ * @brief Storage precision of constant FP32 weights of FullyConnected layers.
+ * Supported values are "FP32" (default, the weights are kept as is), "I8" and "I4".
+ * "I8" and "I4" quantize every output channel symmetrically with a per-channel FP32 scale,
+ * activations stay in FP32 and the weights are converted back on the fly inside the matrix-vector kernel.
+ * Quantized FullyConnected layers and layers with non-constant weights are not affected.
+ */
+DECLARE_CPU_CONFIG_KEY(FC_WEIGHTS_PRECISION);
+
+/**
+ * @brief Runtime quantization of FullyConnected activations for models without FakeQuantize.
+ * Supported values are CONFIG_VALUE(NO) (default), CPU_CONFIG_VALUE(PER_TENSOR) and CPU_CONFIG_VALUE(PER_ROW).
+ * Activation scales are computed from the minimum and maximum of the whole input or of every input row
+ * on each inference, weights are quantized to INT8 at network loading time and the product is computed
+ * with integer dot products. Layers with "I4" CPU_FC_WEIGHTS_PRECISION keep FP32 activations.
+ * Activations are quantized to 8 bits on CPUs with AVX512 VNNI. Other CPUs quantize them to 7 bits
+ * to keep intermediate sums of their integer instructions within 16 bits, with a twice coarser step.
+ */
+DECLARE_CPU_CONFIG_KEY(DYNAMIC_QUANTIZATION);
+DECLARE_CPU_CONFIG_VALUE(PER_TENSOR);
+DECLARE_CPU_CONFIG_VALUE(PER_ROW);
+
+/**
+ * @brief Weight of the network in the process-wide split of CPU cores.
+ * By default (0) the network doesn't take part in the split: its threads are bound to cores starting
+ * after the cores taken by the previous such network, and its executor can be shared with other networks.
+ * A positive weight gives the network its own partition of cores, proportional to its weight
+ * among all the networks that have a weight. Partitions are rebalanced when networks are loaded
+ * and released, threads of running networks are pinned again to follow them. Unless the number
+ * of threads is set explicitly, the network uses as many threads as its partition has cores at load time,
+ * so weights fit best networks loaded together, before they start inference.
+ * The value takes effect only if threads are bound to cores (KEY_CPU_BIND_THREAD is YES).
+ */
+DECLARE_CPU_CONFIG_KEY(CORES_WEIGHT);
+
+/**
+ * @brief Enables flush-to-zero and denormals-are-zero modes on all the threads that run inference:
+ * CONFIG_VALUE(YES) or CONFIG_VALUE(NO) (default).
+ * Denormal floating point values are treated as zeros, so layers consuming them don't slow down
+ * by an order of magnitude on x86 CPUs, at the cost of strict IEEE 754 conformance.
+ * The value has no effect with KEY_EXCLUSIVE_ASYNC_REQUESTS, which uses an executor shared between networks.
+ * KEY_CPU_COUNT_DENORMALS helps to decide whether the option is needed.
+ */
+DECLARE_CPU_CONFIG_KEY(DENORMALS_OPTIMIZATION);
+
+/**
+ * @brief Debug option which counts denormal values in FP32 outputs of every executed layer:
+ * CONFIG_VALUE(YES) or CONFIG_VALUE(NO) (default).
+ * Every output is scanned after the layer execution, so inference is slower with the option enabled.
+ * The share of denormal values is reported by the "outputDenormalsShare" parameter of the layers
+ * of the executable graph (see ExecutableNetwork::GetExecGraphInfo).
+ */
+DECLARE_CPU_CONFIG_KEY(COUNT_DENORMALS);
+
+}  // namespace CPUConfigParams
+}  // namespace InferenceEngine
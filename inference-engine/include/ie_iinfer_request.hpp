@@ -178,6 +178,33 @@ public:
      * @return Enumeration of the resulted action: InferenceEngine::OK (0) for success
      */
     virtual InferenceEngine::StatusCode SetBatch(int batch_size, ResponseDesc* resp) noexcept = 0;
+
+    /**
+     * @brief Infers a long sequence chunk by chunk in synchronous mode
+     *
+     * Every blob holds a sequence along its outermost dimension. The network inputs and outputs take `chunkSize`
+     * elements of the sequence, so their first dimension must be equal to `chunkSize` and the rest ones must be equal
+     * to the dimensions of the blobs. The chunks are inferred back-to-back without leaving the request, outputs of
+     * every chunk are written to the corresponding slices of the preallocated output blobs.
+     *
+     * @note The state of the network (see IExecutableNetwork::QueryState) is kept between chunks and is not reset
+     * before the first one, so a new sequence is started by resetting the states.
+     * @note blocks all methods of IInferRequest while request is ongoing
+     * @param inputs Map of input names to blobs with input sequences
+     * @param outputs Map of output names to preallocated blobs for output sequences
+     * @param chunkSize Number of sequence elements inferred at once
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: InferenceEngine::OK (0) for success,
+     * InferenceEngine::NOT_IMPLEMENTED if the request implementation does not support chunked inference
+     */
+    virtual StatusCode InferChunked(const BlobMap& inputs, const BlobMap& outputs, size_t chunkSize,
+                                    ResponseDesc* resp) noexcept {
+        (void)inputs;
+        (void)outputs;
+        (void)chunkSize;
+        (void)resp;
+        return NOT_IMPLEMENTED;
+    }
 };
 
 }  // namespace InferenceEngine
@@ -67,6 +67,21 @@ public:
      * @return Status code of the operation: InferenceEngine::OK (0) for success
      * */
     virtual StatusCode GetLastState(Blob::CPtr& lastState, ResponseDesc* resp) const noexcept = 0;
+
+    /**
+     * @brief Copies the value of the last memory state to a caller-provided blob.
+     *
+     * @details Together with SetState it allows to keep states of many sessions outside of a network and
+     * to switch a network between sessions without allocations.
+     * @param state A blob of the same size and precision as the state to copy the state to
+     * @param  resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: InferenceEngine::OK (0) for success
+     */
+    virtual StatusCode SaveState(Blob::Ptr state, ResponseDesc* resp) const noexcept {
+        (void)state;
+        (void)resp;
+        return NOT_IMPLEMENTED;
+    }
 };
 
 }  // namespace InferenceEngine
\ No newline at end of file
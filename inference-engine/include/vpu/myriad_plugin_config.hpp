@@ -52,6 +52,19 @@ DECLARE_VPU_MYRIAD_CONFIG_KEY(PLATFORM);
 DECLARE_VPU_MYRIAD_CONFIG_VALUE(2450);
 DECLARE_VPU_MYRIAD_CONFIG_VALUE(2480);
 
+/**
+ * @brief Directory of the compiled networks cache.
+ * LoadNetwork stores compiled blobs there and loads them instead of compiling the same network
+ * with the same compilation options again. The directory must exist. Empty value (default) disables the cache.
+ */
+DECLARE_VPU_MYRIAD_CONFIG_KEY(COMPILED_BLOB_CACHE_DIR);
+
+/**
+ * @brief Maximum total size of the compiled networks cache in megabytes, default is 1024.
+ * Least recently used blobs are removed from the cache when the limit is exceeded.
+ */
+DECLARE_VPU_MYRIAD_CONFIG_KEY(COMPILED_BLOB_CACHE_SIZE);
+
 }  // namespace VPUConfigParams
 
 }  // namespace InferenceEngine
@@ -0,0 +1,701 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <memory>
+#include <utility>
+#include <map>
+#include <unordered_map>
+
+#include "ie_metric_helpers.hpp"
+#include <ie_api.h>
+#include <cpp_interfaces/base/ie_plugin_base.hpp>
+#include <cpp_interfaces/base/ie_infer_async_request_base.hpp>
+#include <auto_batch/auto_batch_config.hpp>
+#include <ie_plugin_config.hpp>
+#include <ie_util_internal.hpp>
+#include <blob_factory.hpp>
+#include <blob_transform.hpp>
+#include <ie_memcpy.h>
+#include "auto_batch.hpp"
+
+namespace AutoBatchPlugin {
+    using namespace InferenceEngine;
+
+namespace {
+
+constexpr int DEFAULT_BATCH_SIZE = 8;
+constexpr int DEFAULT_TIMEOUT_MS = 5;
+
+bool isBatchFirstLayout(Layout layout) {
+    switch (layout) {
+        case Layout::NC:
+        case Layout::NCHW:
+        case Layout::NHWC:
+        case Layout::NCDHW:
+        case Layout::NDHWC:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Creates a view of the batchId-th batch slot of the batched blob, no data is copied
+Blob::Ptr sliceBatchedBlob(const Blob::Ptr& batchedBlob, int batchId, int batchSize, const TensorDesc& desc) {
+    const size_t sliceSize = batchedBlob->byteSize() / batchSize;
+    auto ptr = batchedBlob->buffer().as<uint8_t*>() + batchId * sliceSize;
+    return make_blob_with_precision(TensorDesc{desc.getPrecision(), desc.getDims(),
+                                               batchedBlob->getTensorDesc().getLayout()}, ptr);
+}
+
+void copyBlob(const Blob::Ptr& src, const Blob::Ptr& dst) {
+    if (src->getTensorDesc().getLayout() == dst->getTensorDesc().getLayout()) {
+        ie_memcpy(dst->buffer(), dst->byteSize(), src->cbuffer(), src->byteSize());
+    } else {
+        blob_copy(src, dst);
+    }
+}
+
+// Sets the batched blob to the worker request unless it is already set
+void bindBatchedBlob(WorkerInferRequest& workerRequest, const std::string& name, const Blob::Ptr& blob) {
+    auto& boundBlob = workerRequest._boundBlobs[name];
+    if (boundBlob != blob) {
+        workerRequest._inferRequest.SetBlob(name, blob);
+        boundBlob = blob;
+    }
+}
+
+}  // namespace
+
+// ------------------------------AutoBatchInferRequest----------------------------
+AutoBatchInferRequest::AutoBatchInferRequest(const InputsDataMap&       networkInputs,
+                                             const OutputsDataMap&      networkOutputs,
+                                             const BatchedBlobs::Ptr&   batchedBlobs,
+                                             int                        batchId,
+                                             int                        batchSize)
+        : InferRequestInternal(networkInputs, networkOutputs), _batchedBlobs{batchedBlobs}, _batchId{batchId} {
+    // Default blobs are views of the slot of the request in the batched blobs of its group,
+    // the batch reads and writes them in place if it is formed by the group
+    for (const auto &it : networkInputs) {
+        _inputs[it.first] = sliceBatchedBlob(_batchedBlobs->_inputs[it.first], batchId, batchSize, it.second->getTensorDesc());
+        _defaultBlobs[it.first] = _inputs[it.first];
+    }
+    for (const auto &it : networkOutputs) {
+        _outputs[it.first] = sliceBatchedBlob(_batchedBlobs->_outputs[it.first], batchId, batchSize, it.second->getTensorDesc());
+        _defaultBlobs[it.first] = _outputs[it.first];
+    }
+}
+
+void AutoBatchInferRequest::PreprocessInputs() {
+    execDataPreprocessing(_inputs);
+}
+
+bool AutoBatchInferRequest::HasDefaultBlob(const std::string& name) const {
+    auto input = _inputs.find(name);
+    const auto& blob = input != _inputs.end() ? input->second : _outputs.at(name);
+    return blob == _defaultBlobs.at(name);
+}
+
+void AutoBatchInferRequest::CopyInputToSlot(const std::string& name, const Blob::Ptr& slotInput) {
+    copyBlob(_inputs[name], slotInput);
+}
+
+void AutoBatchInferRequest::CopyOutputFromSlot(const std::string& name, const Blob::Ptr& slotOutput) {
+    copyBlob(slotOutput, _outputs[name]);
+}
+
+void AutoBatchInferRequest::SetBlobsToAnotherRequest(InferRequest& req) {
+    for (const auto &it : _inputs) {
+        req.SetBlob(it.first, it.second);
+    }
+    for (const auto &it : _outputs) {
+        req.SetBlob(it.first, it.second);
+    }
+}
+
+// ------------------------------AutoBatchAsyncInferRequest----------------------------
+AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
+    const AutoBatchInferRequest::Ptr&           inferRequest,
+    const bool                                  needPerfCounters,
+    const AutoBatchExecutableNetwork::Ptr&      autoBatchExecutableNetwork,
+    InferRequest&&                              inferRequestWithoutBatch,
+    const ITaskExecutor::Ptr&                   callbackExecutor) :
+    AsyncInferRequestThreadSafeDefault(inferRequest, nullptr, callbackExecutor),
+    _inferRequestWithoutBatch{std::move(inferRequestWithoutBatch)},
+    _inferRequest{inferRequest},
+    _autoBatchExecutableNetwork{autoBatchExecutableNetwork},
+    _needPerfCounters{needPerfCounters} {
+    _inferRequestWithoutBatch.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+        [this] (InferRequest, StatusCode status) {
+            _status = status;
+            _exceptionPtr = nullptr;
+            if (_needPerfCounters && StatusCode::OK == status) {
+                _perfMap = _inferRequestWithoutBatch.GetPerformanceCounts();
+            }
+            auto capturedTask = std::move(_taskWithoutBatch);
+            capturedTask();
+        });
+
+    struct ThisRequestExecutor : public ITaskExecutor {
+        explicit ThisRequestExecutor(AutoBatchAsyncInferRequest* _this_) : _this{_this_} {}
+        void run(Task task) override {
+            _this->_autoBatchExecutableNetwork->Enqueue(_this, std::move(task));
+        };
+        AutoBatchAsyncInferRequest* _this = nullptr;
+    };
+    _pipeline = {
+        {std::make_shared<ImmediateExecutor>(), [this] {
+            _inferRequest->PreprocessInputs();
+        }},
+        {std::make_shared<ThisRequestExecutor>(this), [this] {
+            if (nullptr != _exceptionPtr) {
+                std::rethrow_exception(_exceptionPtr);
+            }
+            if (InferenceEngine::StatusCode::OK != _status) {
+                if (nullptr != InferenceEngine::CurrentException()) {
+                    std::rethrow_exception(InferenceEngine::CurrentException());
+                } else {
+                    THROW_IE_EXCEPTION << InferenceEngine::details::as_status << _status;
+                }
+            }
+        }}
+    };
+}
+
+void AutoBatchAsyncInferRequest::RunWithoutBatch(Task task) {
+    _taskWithoutBatch = std::move(task);
+    try {
+        // the user may have set other blobs since the previous run
+        _inferRequest->SetBlobsToAnotherRequest(_inferRequestWithoutBatch);
+        _inferRequestWithoutBatch.StartAsync();
+    } catch (...) {
+        // the completion callback is not going to be called, so the pipeline is resumed here
+        _status = StatusCode::GENERAL_ERROR;
+        _exceptionPtr = std::current_exception();
+        auto capturedTask = std::move(_taskWithoutBatch);
+        capturedTask();
+    }
+}
+
+void AutoBatchAsyncInferRequest::Infer_ThreadUnsafe() {
+    InferUsingAsync();
+}
+
+void AutoBatchAsyncInferRequest::GetPerformanceCounts_ThreadUnsafe(std::map<std::string, InferenceEngineProfileInfo> &perfMap) const {
+    perfMap = _perfMap;
+}
+
+AutoBatchAsyncInferRequest::~AutoBatchAsyncInferRequest() {
+    StopAndWait();
+}
+
+// ------------------------------AutoBatchExecutableNetwork----------------------------
+AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(const InferenceEngine::ExecutableNetwork&                            networkWithBatch,
+                                                       const InferenceEngine::ExecutableNetwork&                            networkWithoutBatch,
+                                                       const DeviceInformation&                                             networkDevice,
+                                                       const std::unordered_map<std::string, InferenceEngine::Parameter>&   config,
+                                                       const std::chrono::milliseconds                                      timeout,
+                                                       const bool                                                           needPerfCounters) :
+    InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<InferenceEngine::ImmediateExecutor>()),
+    _device{networkDevice},
+    _networkWithBatch{networkWithBatch},
+    _networkWithoutBatch{networkWithoutBatch},
+    _timeout{timeout},
+    _config{config},
+    _needPerfCounters{needPerfCounters} {
+    _taskExecutor.reset();
+}
+
+AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
+    _terminate = true;
+    /* NOTE: Every AsyncInferRequest holds the executable network and waits for its pipelines in the destructor,
+     *       so no task is pending here and the worker threads only need to be woken up and joined
+     */
+    {
+        std::lock_guard<std::mutex> lock(_tasksMutex);
+    }
+    _tasksCond.notify_all();
+    for (auto&& workerRequest : _workerRequests) {
+        if (workerRequest->_thread.joinable()) {
+            workerRequest->_thread.join();
+        }
+    }
+    _workerRequests.clear();
+}
+
+WorkerInferRequest::Ptr AutoBatchExecutableNetwork::CreateWorkerRequest(const InputsDataMap&   networkInputs,
+                                                                        const OutputsDataMap&  networkOutputs) {
+    auto workerRequest = std::make_shared<WorkerInferRequest>();
+    workerRequest->_inferRequest = _networkWithBatch.CreateInferRequest();
+    workerRequest->_batchSize = _device.batchForDevice;
+    for (const auto &it : networkInputs) {
+        workerRequest->_ownBlobs._inputs[it.first] = workerRequest->_inferRequest.GetBlob(it.first);
+    }
+    for (const auto &it : networkOutputs) {
+        workerRequest->_ownBlobs._outputs[it.first] = workerRequest->_inferRequest.GetBlob(it.first);
+    }
+    workerRequest->_boundBlobs.insert(workerRequest->_ownBlobs._inputs.begin(), workerRequest->_ownBlobs._inputs.end());
+    workerRequest->_boundBlobs.insert(workerRequest->_ownBlobs._outputs.begin(), workerRequest->_ownBlobs._outputs.end());
+    workerRequest->_slotInputs.resize(workerRequest->_batchSize);
+    workerRequest->_slotOutputs.resize(workerRequest->_batchSize);
+    for (int batchId = 0; batchId < workerRequest->_batchSize; batchId++) {
+        for (const auto &it : networkInputs) {
+            workerRequest->_slotInputs[batchId][it.first] = sliceBatchedBlob(workerRequest->_ownBlobs._inputs[it.first],
+                batchId, workerRequest->_batchSize, it.second->getTensorDesc());
+        }
+        for (const auto &it : networkOutputs) {
+            workerRequest->_slotOutputs[batchId][it.first] = sliceBatchedBlob(workerRequest->_ownBlobs._outputs[it.first],
+                batchId, workerRequest->_batchSize, it.second->getTensorDesc());
+        }
+    }
+    auto* workerRequestPtr = workerRequest.get();
+    workerRequest->_thread = std::thread([this, workerRequestPtr] {
+        WorkerLoop(*workerRequestPtr);
+    });
+    return workerRequest;
+}
+
+void AutoBatchExecutableNetwork::Enqueue(AutoBatchAsyncInferRequest* request, Task task) {
+    {
+        std::lock_guard<std::mutex> lock(_tasksMutex);
+        _tasks.push_back({request, std::move(task), Clock::now()});
+    }
+    _tasksCond.notify_one();
+}
+
+void AutoBatchExecutableNetwork::WorkerLoop(WorkerInferRequest& workerRequest) {
+    const auto batchSize = static_cast<size_t>(workerRequest._batchSize);
+    while (!_terminate) {
+        std::vector<PendingTask> tasks;
+        bool moreTasks = false;
+        {
+            std::unique_lock<std::mutex> lock(_tasksMutex);
+            // the oldest request defines how long the worker may wait for the rest of the batch,
+            // other workers may take the requests in the meantime, so the deadline is checked on every wake up
+            while (!_terminate && _tasks.size() < batchSize) {
+                if (_tasks.empty()) {
+                    _tasksCond.wait(lock);
+                    continue;
+                }
+                const auto deadline = _tasks.front()._enqueueTime + _timeout;
+                if (Clock::now() >= deadline) {
+                    break;
+                }
+                _tasksCond.wait_until(lock, deadline);
+            }
+            if (_terminate) {
+                break;
+            }
+            const auto numTasks = std::min(batchSize, _tasks.size());
+            tasks.assign(std::make_move_iterator(_tasks.begin()), std::make_move_iterator(_tasks.begin() + numTasks));
+            _tasks.erase(_tasks.begin(), _tasks.begin() + numTasks);
+            moreTasks = !_tasks.empty();
+        }
+        // the rest of requests is collected by another worker
+        if (moreTasks) {
+            _tasksCond.notify_one();
+        }
+
+        const auto now = Clock::now();
+        if (tasks.size() == batchSize) {
+            Clock::duration queueDelay{0};
+            for (auto&& task : tasks) {
+                queueDelay += now - task._enqueueTime;
+            }
+            UpdateStatistics(tasks.size(), queueDelay);
+
+            StatusCode status = StatusCode::OK;
+            std::exception_ptr exceptionPtr = nullptr;
+            try {
+                // A batch formed by one group of requests keeps their slots, so the batched blobs of the group are used
+                // in place for every port where all requests have default blobs. Blobs set by the user and requests
+                // of different groups are copied to the own blobs of the worker request.
+                const auto& groupBlobs = tasks.front()._request->_inferRequest->_batchedBlobs;
+                const bool sameGroup = std::all_of(tasks.begin(), tasks.end(), [&](const PendingTask& task) {
+                    return task._request->_inferRequest->_batchedBlobs == groupBlobs;
+                });
+                auto inPlace = [&](const std::string& name) {
+                    return sameGroup && std::all_of(tasks.begin(), tasks.end(), [&](const PendingTask& task) {
+                        return task._request->_inferRequest->HasDefaultBlob(name);
+                    });
+                };
+                // otherwise slots are assigned in the order requests have been submitted
+                auto slotOf = [&](size_t taskId) {
+                    return sameGroup ? static_cast<size_t>(tasks[taskId]._request->_inferRequest->_batchId) : taskId;
+                };
+
+                for (const auto &it : groupBlobs->_inputs) {
+                    if (inPlace(it.first)) {
+                        bindBatchedBlob(workerRequest, it.first, it.second);
+                        continue;
+                    }
+                    bindBatchedBlob(workerRequest, it.first, workerRequest._ownBlobs._inputs[it.first]);
+                    for (size_t taskId = 0; taskId < batchSize; taskId++) {
+                        tasks[taskId]._request->_inferRequest->CopyInputToSlot(it.first,
+                            workerRequest._slotInputs[slotOf(taskId)][it.first]);
+                    }
+                }
+                std::vector<std::string> copiedOutputs;
+                for (const auto &it : groupBlobs->_outputs) {
+                    if (inPlace(it.first)) {
+                        bindBatchedBlob(workerRequest, it.first, it.second);
+                    } else {
+                        bindBatchedBlob(workerRequest, it.first, workerRequest._ownBlobs._outputs[it.first]);
+                        copiedOutputs.push_back(it.first);
+                    }
+                }
+                workerRequest._inferRequest.Infer();
+                for (const auto &name : copiedOutputs) {
+                    for (size_t taskId = 0; taskId < batchSize; taskId++) {
+                        tasks[taskId]._request->_inferRequest->CopyOutputFromSlot(name,
+                            workerRequest._slotOutputs[slotOf(taskId)][name]);
+                    }
+                }
+            } catch (const details::InferenceEngineException& iie) {
+                status = iie.hasStatus() ? iie.getStatus() : StatusCode::GENERAL_ERROR;
+                exceptionPtr = std::current_exception();
+            } catch (...) {
+                status = StatusCode::GENERAL_ERROR;
+                exceptionPtr = std::current_exception();
+            }
+            std::map<std::string, InferenceEngineProfileInfo> perfMap;
+            if (_needPerfCounters && StatusCode::OK == status) {
+                perfMap = workerRequest._inferRequest.GetPerformanceCounts();
+            }
+            for (auto&& task : tasks) {
+                task._request->_status = status;
+                task._request->_exceptionPtr = exceptionPtr;
+                task._request->_perfMap = perfMap;
+                auto capturedTask = std::move(task._task);
+                capturedTask();
+            }
+        } else {
+            // the batch was not collected in time, so each request runs on its own
+            for (auto&& task : tasks) {
+                UpdateStatistics(1, now - task._enqueueTime);
+                task._request->RunWithoutBatch(std::move(task._task));
+            }
+        }
+    }
+}
+
+void AutoBatchExecutableNetwork::UpdateStatistics(size_t numRequests, Clock::duration queueDelay) {
+    _executions++;
+    _executedRequests += numRequests;
+    _queueDelayUs += std::chrono::duration_cast<std::chrono::microseconds>(queueDelay).count();
+}
+
+InferenceEngine::InferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                                              InferenceEngine::OutputsDataMap networkOutputs) {
+    BatchedBlobs::Ptr batchedBlobs;
+    int batchId = 0;
+    {
+        // a batched request is added for every batch of user requests, so all of them can be in flight at once,
+        // and the default blobs of the group of user requests are slots of another set of batched blobs
+        std::lock_guard<std::mutex> lock(_workerRequestsMutex);
+        batchId = static_cast<int>(_numRequestsCreated % _device.batchForDevice);
+        if (0 == batchId) {
+            auto workerRequest = CreateWorkerRequest(networkInputs, networkOutputs);
+            _requestsBlobs = std::make_shared<BatchedBlobs>();
+            for (const auto &it : workerRequest->_ownBlobs._inputs) {
+                _requestsBlobs->_inputs[it.first] = make_blob_with_precision(it.second->getTensorDesc());
+                _requestsBlobs->_inputs[it.first]->allocate();
+            }
+            for (const auto &it : workerRequest->_ownBlobs._outputs) {
+                _requestsBlobs->_outputs[it.first] = make_blob_with_precision(it.second->getTensorDesc());
+                _requestsBlobs->_outputs[it.first]->allocate();
+            }
+            _workerRequests.push_back(workerRequest);
+        }
+        batchedBlobs = _requestsBlobs;
+        _numRequestsCreated++;
+    }
+    return std::make_shared<AutoBatchInferRequest>(networkInputs, networkOutputs, batchedBlobs, batchId, _device.batchForDevice);
+}
+
+void AutoBatchExecutableNetwork::CreateInferRequest(IInferRequest::Ptr& asyncRequest) {
+    auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    auto asyncTreadSafeImpl = std::make_shared<AutoBatchAsyncInferRequest>(std::static_pointer_cast<AutoBatchInferRequest>(syncRequestImpl),
+                                                                           _needPerfCounters,
+                                                                           std::static_pointer_cast<AutoBatchExecutableNetwork>(shared_from_this()),
+                                                                           _networkWithoutBatch.CreateInferRequest(),
+                                                                           _callbackExecutor);
+    asyncRequest.reset(new InferRequestBase<AutoBatchAsyncInferRequest>(asyncTreadSafeImpl), [](IInferRequest *p) { p->Release(); });
+    asyncTreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
+}
+
+void AutoBatchExecutableNetwork::GetConfig(const std::string &name, InferenceEngine::Parameter &result,
+        InferenceEngine::ResponseDesc * /* resp */) const {
+    auto res = _config.find(name);
+    if (res != _config.end()) {
+        result =  res->second;
+    } else {
+        THROW_IE_EXCEPTION << NOT_FOUND_str << name <<" not found in the ExecutableNetwork config";
+    }
+}
+
+void AutoBatchExecutableNetwork::GetMetric(const std::string &name, Parameter &result, ResponseDesc * /* resp */) const {
+    if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
+        unsigned int res = 0u;
+        try {
+            res = _networkWithBatch.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        } catch (const details::InferenceEngineException &iie) {
+            THROW_IE_EXCEPTION
+                    << "Every device used with the Auto-Batching should "
+                    << "support OPTIMAL_NUMBER_OF_INFER_REQUESTS ExecutableNetwork metric. "
+                    << "Failed to query the metric for the " << _device.deviceName << " with error:" << iie.what();
+        }
+        // every request of the batched network serves the whole batch of user requests
+        result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, res * static_cast<unsigned int>(_device.batchForDevice));
+    } else if (name == METRIC_KEY(NETWORK_NAME)) {
+        result = IE_SET_METRIC(NETWORK_NAME, _networkWithoutBatch.GetMetric(
+            METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == AUTO_BATCH_METRIC(AVERAGE_BATCH_SIZE)) {
+        const uint64_t executions = _executions;
+        const float averageBatch = executions ? static_cast<float>(_executedRequests) / executions : 0.f;
+        result = IE_SET_METRIC(AUTO_BATCH_AVERAGE_BATCH_SIZE, averageBatch);
+    } else if (name == AUTO_BATCH_METRIC(AVERAGE_QUEUE_DELAY)) {
+        const uint64_t executedRequests = _executedRequests;
+        const float averageDelay = executedRequests ? static_cast<float>(_queueDelayUs) / executedRequests / 1000.f : 0.f;
+        result = IE_SET_METRIC(AUTO_BATCH_AVERAGE_QUEUE_DELAY, averageDelay);
+    } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        result = IE_SET_METRIC(SUPPORTED_METRICS, {
+            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+            METRIC_KEY(SUPPORTED_METRICS),
+            METRIC_KEY(NETWORK_NAME),
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            AUTO_BATCH_METRIC(AVERAGE_BATCH_SIZE),
+            AUTO_BATCH_METRIC(AVERAGE_QUEUE_DELAY)
+        });
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        std::vector<std::string> configKeys = { AUTO_BATCH_CONFIG_KEY(DEVICE), AUTO_BATCH_CONFIG_KEY(TIMEOUT) };
+        result = IE_SET_METRIC(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported Network metric: " << name;
+    }
+}
+
+// ------------------------------AutoBatchInferencePlugin----------------------------
+
+namespace {
+
+std::map<std::string, std::string> mergeConfigs(std::map<std::string, std::string> config,
+                                                const std::map<std::string, std::string> & local) {
+    for (auto && kvp : local) {
+        config[kvp.first] = kvp.second;
+    }
+    return config;
+}
+
+std::chrono::milliseconds parseTimeout(const std::map<std::string, std::string>& config) {
+    auto timeout = config.find(AUTO_BATCH_CONFIG_KEY(TIMEOUT));
+    if (timeout == config.end()) {
+        return std::chrono::milliseconds{DEFAULT_TIMEOUT_MS};
+    }
+    int value = -1;
+    try {
+        value = std::stoi(timeout->second);
+    } catch (...) {
+    }
+    if (value < 0) {
+        THROW_IE_EXCEPTION << "Wrong value for property key " << AUTO_BATCH_CONFIG_KEY(TIMEOUT)
+                           << ". Expected non-negative number of milliseconds, got: " << timeout->second;
+    }
+    return std::chrono::milliseconds{value};
+}
+
+}  // namespace
+
+std::map<std::string, std::string> AutoBatchInferencePlugin::GetSupportedConfig(
+    const std::map<std::string, std::string> & config, const std::string & deviceName) const {
+    std::vector<std::string> supportedConfigKeys = GetCore()->GetMetric(deviceName, METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+    std::map<std::string, std::string> supportedConfig;
+    for (auto&& key : supportedConfigKeys) {
+        auto itKey = config.find(key);
+        if (config.end() != itKey) {
+            supportedConfig[key] = itKey->second;
+        }
+    }
+    return supportedConfig;
+}
+
+DeviceInformation AutoBatchInferencePlugin::ParseMetaDevice(const std::string& deviceBatch,
+                                                            const std::map<std::string, std::string> & config) const {
+    auto openingBracket = deviceBatch.find_first_of('(');
+    auto closingBracket = deviceBatch.find_first_of(')', openingBracket);
+    auto deviceWithID = deviceBatch.substr(0, openingBracket);
+
+    int batch = DEFAULT_BATCH_SIZE;
+    if (closingBracket != std::string::npos && openingBracket < closingBracket) {
+        batch = std::stol(deviceBatch.substr(openingBracket + 1, closingBracket - openingBracket - 1));
+
+        if (batch <= 0) {
+            THROW_IE_EXCEPTION << "Batch value for '" << deviceWithID << "' must be > 0, while " << batch
+                << "is passed";
+        }
+    }
+
+    DeviceIDParser deviceParser(deviceWithID);
+    std::string deviceName = deviceParser.getDeviceName();
+    std::map<std::string, std::string> tconfig = mergeConfigs(_config, config);
+
+    // set device ID if any
+    std::string deviceIDLocal = deviceParser.getDeviceID();
+    if (!deviceIDLocal.empty()) {
+        tconfig[PluginConfigParams::KEY_DEVICE_ID] = deviceIDLocal;
+    }
+
+    return { deviceName, GetSupportedConfig(tconfig, deviceName), batch };
+}
+
+Parameter AutoBatchInferencePlugin::GetConfig(const std::string& name,
+        const std::map<std::string, Parameter> & /* options */) const {
+    if (name == AUTO_BATCH_CONFIG_KEY(DEVICE) || name == AUTO_BATCH_CONFIG_KEY(TIMEOUT)) {
+        auto it = _config.find(name);
+        if (it == _config.end()) {
+            THROW_IE_EXCEPTION << "Value for " << name << " is not set";
+        } else {
+            return { it->second };
+        }
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported config key: " << name;
+    }
+}
+
+void AutoBatchInferencePlugin::SetConfig(const std::map<std::string, std::string> & config) {
+    parseTimeout(config);
+    for (auto && kvp : config) {
+        _config[kvp.first] = kvp.second;
+    }
+}
+
+IE_SUPPRESS_DEPRECATED_START
+
+INFERENCE_PLUGIN_API(InferenceEngine::StatusCode) CreatePluginEngine(
+        InferenceEngine::IInferencePlugin *&plugin,
+        InferenceEngine::ResponseDesc *resp) noexcept {
+    try {
+        plugin = make_ie_compatible_plugin(
+                {{2, 1},
+                 CI_BUILD_NUMBER,
+                 "AutoBatchPlugin"}, std::make_shared<AutoBatchInferencePlugin>());
+        return OK;
+    }
+    catch (std::exception &ex) {
+        return DescriptionBuffer(GENERAL_ERROR, resp) << ex.what();
+    }
+}
+
+IE_SUPPRESS_DEPRECATED_END
+
+AutoBatchInferencePlugin::AutoBatchInferencePlugin() {
+    _pluginName = "BATCH";
+}
+
+InferenceEngine::Parameter AutoBatchInferencePlugin::GetMetric(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter> & /* options */) const {
+    if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        std::vector<std::string> metrics;
+        metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
+        metrics.push_back(METRIC_KEY(FULL_DEVICE_NAME));
+        metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
+    } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
+        std::string name = { "BATCH" };
+        IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, name);
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        std::vector<std::string> configKeys = { AUTO_BATCH_CONFIG_KEY(DEVICE), AUTO_BATCH_CONFIG_KEY(TIMEOUT) };
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported metric key " << name;
+    }
+}
+
+ExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadExeNetworkImpl(const ICNNNetwork &network,
+                                                                            const std::map<std::string, std::string>& config) {
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with BATCH device via InferencEngine::Core object";
+    }
+
+    auto fullConfig = mergeConfigs(_config, config);
+    auto device = fullConfig.find(AUTO_BATCH_CONFIG_KEY(DEVICE));
+    if (device == fullConfig.end()) {
+        THROW_IE_EXCEPTION << "KEY_AUTO_BATCH_DEVICE key is not set for BATCH device";
+    }
+
+    DeviceInformation metaDevice = ParseMetaDevice(device->second, fullConfig);
+    const auto timeout = parseTimeout(fullConfig);
+    auto & deviceName = metaDevice.deviceName;
+    auto & deviceConfig = metaDevice.config;
+
+    // the batch is formed along the outermost dimension of every input and output
+    CNNNetwork clonedNetwork{cloneNetwork(network)};
+    auto shapes = clonedNetwork.getInputShapes();
+    for (auto&& input : clonedNetwork.getInputsInfo()) {
+        auto& dims = shapes[input.first];
+        if (!isBatchFirstLayout(input.second->getLayout()) || dims.empty() || dims[0] != 1) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "BATCH device supports only networks with batch 1 and batch-first "
+                               << "layouts of inputs, while the input " << input.first << " has layout "
+                               << input.second->getLayout();
+        }
+        dims[0] = metaDevice.batchForDevice;
+    }
+    clonedNetwork.reshape(shapes);
+    for (auto&& output : clonedNetwork.getOutputsInfo()) {
+        const auto& dims = output.second->getTensorDesc().getDims();
+        if (!isBatchFirstLayout(output.second->getLayout()) || dims.empty() ||
+            dims[0] != static_cast<size_t>(metaDevice.batchForDevice)) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "BATCH device failed to batch the output " << output.first
+                               << ": outputs should have the batch-first layout and follow the batch of inputs";
+        }
+    }
+
+    auto networkWithBatch = GetCore()->LoadNetwork(clonedNetwork, deviceName, deviceConfig);
+    auto networkWithoutBatch = GetCore()->LoadNetwork(CNNNetwork{cloneNetwork(network)}, deviceName, deviceConfig);
+
+    // collect the settings that are applicable to the device we are loading the network to
+    std::unordered_map<std::string, InferenceEngine::Parameter> networkConfig;
+    networkConfig.insert(*device);
+    networkConfig.insert({AUTO_BATCH_CONFIG_KEY(TIMEOUT), std::to_string(timeout.count())});
+    networkConfig.insert(deviceConfig.begin(), deviceConfig.end());
+
+    auto perfConfig = fullConfig.find(PluginConfigParams::KEY_PERF_COUNT);
+    bool enablePerfCounters = (fullConfig.end() != perfConfig) && (perfConfig->second == PluginConfigParams::YES);
+
+    return std::make_shared<AutoBatchExecutableNetwork>(networkWithBatch,
+                                                        networkWithoutBatch,
+                                                        metaDevice,
+                                                        networkConfig,
+                                                        timeout,
+                                                        enablePerfCounters);
+}
+
+void AutoBatchInferencePlugin::QueryNetwork(const ICNNNetwork&                        network,
+                                            const std::map<std::string, std::string>& config,
+                                            QueryNetworkResult&                       queryResult) const {
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with BATCH device via InferencEngine::Core object";
+    }
+
+    queryResult.rc = StatusCode::OK;
+    queryResult.supportedLayersMap.clear();
+
+    auto fullConfig = mergeConfigs(_config, config);
+    auto device = fullConfig.find(AUTO_BATCH_CONFIG_KEY(DEVICE));
+    if (device == fullConfig.end()) {
+        THROW_IE_EXCEPTION << "KEY_AUTO_BATCH_DEVICE key is not set for BATCH device";
+    }
+
+    DeviceInformation metaDevice = ParseMetaDevice(device->second, fullConfig);
+    auto deviceResult = GetCore()->QueryNetwork(network, metaDevice.deviceName, metaDevice.config);
+    for (auto&& layer : deviceResult.supportedLayersMap) {
+        queryResult.supportedLayersMap[layer.first] = GetName();
+    }
+}
+}  // namespace AutoBatchPlugin
@@ -0,0 +1,214 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cpp/ie_plugin_cpp.hpp>
+#include <cpp_interfaces/impl/ie_plugin_internal.hpp>
+#include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+#include "ie_iinfer_request.hpp"
+#include "details/ie_exception_conversion.hpp"
+
+namespace AutoBatchPlugin {
+
+using Clock = std::chrono::steady_clock;
+
+struct DeviceInformation {
+    std::string deviceName;
+    std::map<std::string, std::string> config;
+    int batchForDevice;
+};
+
+class AutoBatchAsyncInferRequest;
+
+/**
+ * A user request waiting for a batch to be formed
+ */
+struct PendingTask {
+    AutoBatchAsyncInferRequest*         _request;
+    InferenceEngine::Task               _task;
+    Clock::time_point                   _enqueueTime;
+};
+
+/**
+ * Batched blobs of a group of user requests. The default blobs of every request of the group are views of its own
+ * batch slot, so the group is executed in place once all of its requests form a batch.
+ */
+struct BatchedBlobs {
+    using Ptr = std::shared_ptr<BatchedBlobs>;
+
+    InferenceEngine::BlobMap                _inputs;
+    InferenceEngine::BlobMap                _outputs;
+};
+
+/**
+ * A request of the batched network. Its batch slots are assigned to user requests every time a batch is formed,
+ * so any user request can join any batch.
+ */
+struct WorkerInferRequest {
+    using Ptr = std::shared_ptr<WorkerInferRequest>;
+
+    InferenceEngine::InferRequest           _inferRequest;
+    int                                     _batchSize = 1;
+    // blobs allocated by the batched request, the data of user requests is copied to their slots
+    BatchedBlobs                            _ownBlobs;
+    // views of every batch slot in the own blobs of the batched request
+    std::vector<InferenceEngine::BlobMap>   _slotInputs;
+    std::vector<InferenceEngine::BlobMap>   _slotOutputs;
+    // blobs currently set to the batched request: own blobs or batched blobs of a group of user requests
+    InferenceEngine::BlobMap                _boundBlobs;
+    std::thread                             _thread;
+};
+
+class AutoBatchInferRequest : public InferenceEngine::InferRequestInternal {
+public:
+    using Ptr = std::shared_ptr<AutoBatchInferRequest>;
+    explicit AutoBatchInferRequest(const InferenceEngine::InputsDataMap&   networkInputs,
+                                   const InferenceEngine::OutputsDataMap&  networkOutputs,
+                                   const BatchedBlobs::Ptr&                batchedBlobs,
+                                   int                                     batchId,
+                                   int                                     batchSize);
+    void GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>&) const override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+    void InferImpl() override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+    // Auto-batching impl specific: pre-processes inputs if needed
+    void PreprocessInputs();
+    // Auto-batching impl specific: checks the user has not replaced the default blob, which is a view of the slot
+    bool HasDefaultBlob(const std::string& name) const;
+    // Auto-batching impl specific: copies the input to the batch slot the request is assigned to
+    void CopyInputToSlot(const std::string& name, const InferenceEngine::Blob::Ptr& slotInput);
+    // Auto-batching impl specific: copies the batch slot result to the output
+    void CopyOutputFromSlot(const std::string& name, const InferenceEngine::Blob::Ptr& slotOutput);
+    // Auto-batching impl specific: sets inputs and outputs to the request of the not batched network
+    void SetBlobsToAnotherRequest(InferenceEngine::InferRequest& req);
+
+    // batched blobs of the group of requests the request belongs to and its slot in them
+    const BatchedBlobs::Ptr                 _batchedBlobs;
+    const int                               _batchId;
+
+protected:
+    InferenceEngine::BlobMap                _defaultBlobs;
+};
+
+class AutoBatchExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<AutoBatchExecutableNetwork>;
+
+    explicit AutoBatchExecutableNetwork(const InferenceEngine::ExecutableNetwork&                           networkWithBatch,
+                                        const InferenceEngine::ExecutableNetwork&                           networkWithoutBatch,
+                                        const DeviceInformation&                                            networkDevice,
+                                        const std::unordered_map<std::string, InferenceEngine::Parameter>&  config,
+                                        const std::chrono::milliseconds                                     timeout,
+                                        const bool                                                          needPerfCounters = false);
+
+    void GetConfig(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *resp) const override;
+    void GetMetric(const std::string &name, InferenceEngine::Parameter &result, InferenceEngine::ResponseDesc *resp) const override;
+    void CreateInferRequest(InferenceEngine::IInferRequest::Ptr& asyncRequest) override;
+    InferenceEngine::InferRequestInternal::Ptr CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                      InferenceEngine::OutputsDataMap networkOutputs) override;
+    ~AutoBatchExecutableNetwork() override;
+
+    // Puts the request to the queue of requests waiting for a batch
+    void Enqueue(AutoBatchAsyncInferRequest* request, InferenceEngine::Task task);
+    // Accounts requests executed at once and the time they waited for the batch
+    void UpdateStatistics(size_t numRequests, Clock::duration queueDelay);
+
+    std::atomic_bool                                            _terminate = {false};
+    DeviceInformation                                           _device;
+    InferenceEngine::ExecutableNetwork                          _networkWithBatch;
+    InferenceEngine::ExecutableNetwork                          _networkWithoutBatch;
+    std::chrono::milliseconds                                   _timeout;
+    std::vector<WorkerInferRequest::Ptr>                        _workerRequests;
+    std::mutex                                                  _workerRequestsMutex;
+    size_t                                                      _numRequestsCreated = 0;
+    // batched blobs of the group of user requests being created
+    BatchedBlobs::Ptr                                           _requestsBlobs;
+    // requests waiting for a batch, every idle worker request takes up to a batch of them
+    std::vector<PendingTask>                                    _tasks;
+    std::mutex                                                  _tasksMutex;
+    std::condition_variable                                     _tasksCond;
+    std::unordered_map<std::string, InferenceEngine::Parameter> _config;
+    bool                                                        _needPerfCounters = false;
+
+    std::atomic<uint64_t>                                       _executions = {0};
+    std::atomic<uint64_t>                                       _executedRequests = {0};
+    std::atomic<uint64_t>                                       _queueDelayUs = {0};
+
+private:
+    WorkerInferRequest::Ptr CreateWorkerRequest(const InferenceEngine::InputsDataMap&   networkInputs,
+                                                const InferenceEngine::OutputsDataMap&  networkOutputs);
+    void WorkerLoop(WorkerInferRequest& workerRequest);
+};
+
+class AutoBatchAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<AutoBatchAsyncInferRequest>;
+
+    explicit AutoBatchAsyncInferRequest(const AutoBatchInferRequest::Ptr&           inferRequest,
+                                        const bool                                  needPerfCounters,
+                                        const AutoBatchExecutableNetwork::Ptr&      autoBatchExecutableNetwork,
+                                        InferenceEngine::InferRequest&&             inferRequestWithoutBatch,
+                                        const InferenceEngine::ITaskExecutor::Ptr&  callbackExecutor);
+    void Infer_ThreadUnsafe() override;
+    void GetPerformanceCounts_ThreadUnsafe(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &_perfMap) const override;
+    ~AutoBatchAsyncInferRequest() override;
+
+    // Runs the request on the network without batch when a batch could not be formed in time
+    void RunWithoutBatch(InferenceEngine::Task task);
+
+    InferenceEngine::InferRequest                                       _inferRequestWithoutBatch;
+    InferenceEngine::StatusCode                                         _status = InferenceEngine::StatusCode::OK;
+    std::exception_ptr                                                  _exceptionPtr = nullptr;
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>  _perfMap;
+    AutoBatchInferRequest::Ptr                                          _inferRequest;
+
+protected:
+    AutoBatchExecutableNetwork::Ptr                                     _autoBatchExecutableNetwork;
+    InferenceEngine::Task                                               _taskWithoutBatch;
+    bool                                                                _needPerfCounters = false;
+};
+
+class AutoBatchInferencePlugin : public InferenceEngine::InferencePluginInternal {
+public:
+    AutoBatchInferencePlugin();
+    ~AutoBatchInferencePlugin() override = default;
+
+    InferenceEngine::ExecutableNetworkInternal::Ptr LoadExeNetworkImpl(const InferenceEngine::ICNNNetwork& network,
+                                                                       const std::map<std::string, std::string>& config) override;
+
+    void SetConfig(const std::map<std::string, std::string>& config) override;
+    InferenceEngine::Parameter GetConfig(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter>& options) const override;
+    void QueryNetwork(const InferenceEngine::ICNNNetwork&       network,
+                      const std::map<std::string, std::string>& config,
+                      InferenceEngine::QueryNetworkResult&      res) const override;
+    InferenceEngine::Parameter GetMetric(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter>& options) const override;
+
+    DeviceInformation ParseMetaDevice(const std::string& deviceBatch, const std::map<std::string, std::string>& config) const;
+
+protected:
+    std::map<std::string, std::string> GetSupportedConfig(const std::map<std::string, std::string>& config,
+                                                          const std::string& deviceName) const;
+};
+
+}  // namespace AutoBatchPlugin
@@ -9,6 +9,10 @@
 #include "cpu_x86_sse42/blob_transform_sse42.hpp"
 #endif
 
+#include "ie_memcpy.h"
+#include "ie_parallel.hpp"
+
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
 
@@ -16,6 +20,50 @@
 
 namespace InferenceEngine {
 
+// Layout conversions of blobs larger than this are split between the threads
+static constexpr size_t PARALLEL_BLOB_COPY_THRESHOLD = 1 << 18;
+// Number of W positions transposed at once, so both source and destination tiles stay in L1
+static constexpr size_t BLOB_COPY_W_TILE = 16;
+
+/**
+ * Copies one row of W elements of all C channels between the planar and the interleaved layouts.
+ * The row is processed by tiles of W positions, so the innermost loop has unit stride on one side
+ * and is vectorized by the compiler.
+ */
+template <typename data_t>
+static void blob_copy_row_transposed(const data_t* src_ptr, data_t* dst_ptr, size_t C, size_t W,
+                                     size_t C_src_stride, size_t W_src_stride,
+                                     size_t C_dst_stride, size_t W_dst_stride) {
+    for (size_t w0 = 0; w0 < W; w0 += BLOB_COPY_W_TILE) {
+        const size_t w1 = std::min(W, w0 + BLOB_COPY_W_TILE);
+        for (size_t c = 0; c < C; c++) {
+            const data_t* src_ptr_l = src_ptr + c * C_src_stride;
+            data_t* dst_ptr_l = dst_ptr + c * C_dst_stride;
+            for (size_t w = w0; w < w1; w++) {
+                dst_ptr_l[w * W_dst_stride] = src_ptr_l[w * W_src_stride];
+            }
+        }
+    }
+}
+
+template <typename F>
+static void blob_copy_for_2d(size_t bytes, size_t D0, size_t D1, const F& func) {
+    if (bytes >= PARALLEL_BLOB_COPY_THRESHOLD) {
+        parallel_for2d(D0, D1, func);
+    } else {
+        for_2d(0, 1, D0, D1, func);
+    }
+}
+
+template <typename F>
+static void blob_copy_for_3d(size_t bytes, size_t D0, size_t D1, size_t D2, const F& func) {
+    if (bytes >= PARALLEL_BLOB_COPY_THRESHOLD) {
+        parallel_for3d(D0, D1, D2, func);
+    } else {
+        for_3d(0, 1, D0, D1, D2, func);
+    }
+}
+
 template <InferenceEngine::Precision::ePrecision PRC>
 static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     using data_t = typename InferenceEngine::PrecisionTrait<PRC>::value_type;
@@ -47,7 +95,7 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     const auto H_dst_stride = dst_l == NHWC ? dst_strides[1] : dst_strides[2];
     const auto W_dst_stride = dst_l == NHWC ? dst_strides[2] : dst_strides[3];
 
-    src_ptr += dst_blk_desc.getOffsetPadding();
+    dst_ptr += dst_blk_desc.getOffsetPadding();
 
 #ifdef HAVE_SSE
     if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW && C == 3 &&
@@ -85,40 +133,15 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     }
 #endif  // HAVE_SSE
 
-    if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride;
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                for (int h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (int w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        src_ptr_l_l += W_src_stride;
-                        dst_ptr_l++;
-                    }
-                }
-            }
-        }
-    } else if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c;
-                for (int h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (int w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        dst_ptr_l += W_dst_stride;
-                        src_ptr_l_l++;
-                    }
-                }
-            }
-        }
+    const size_t bytes = N * C * H * W * sizeof(data_t);
+    if (src_l != dst_l && (src_l == NHWC || dst_l == NHWC)) {
+        blob_copy_for_2d(bytes, N, H, [&](size_t n, size_t h) {
+            blob_copy_row_transposed(src_ptr + n * N_src_stride + h * H_src_stride,
+                                     dst_ptr + n * N_dst_stride + h * H_dst_stride, C, W,
+                                     C_src_stride, W_src_stride, C_dst_stride, W_dst_stride);
+        });
     } else {
-        for (int i = 0; i < N * C * H * W; i++) {
-            dst_ptr[i] = src_ptr[i];
-        }
+        ie_memcpy(dst_ptr, bytes, src_ptr, bytes);
     }
 }
 
@@ -218,44 +241,15 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
         }
     }
 #endif  // HAVE_SSE
-    if (src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                for (int d = 0; d < D; d++) {
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride + d * D_dst_stride;
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    for (int h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (int w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            src_ptr_l_l += W_src_stride;
-                            dst_ptr_l++;
-                        }
-                    }
-                }
-            }
-        }
-    } else if (src->getTensorDesc().getLayout() == NCDHW && dst->getTensorDesc().getLayout() == NDHWC) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                for (int d = 0; d < D; d++) {
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c + d * D_dst_stride;
-                    for (int h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (int w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            dst_ptr_l += W_dst_stride;
-                            src_ptr_l_l++;
-                        }
-                    }
-                }
-            }
-        }
+    const size_t bytes = N * C * D * H * W * sizeof(data_t);
+    if (src_l != dst_l && (src_l == NDHWC || dst_l == NDHWC)) {
+        blob_copy_for_3d(bytes, N, D, H, [&](size_t n, size_t d, size_t h) {
+            blob_copy_row_transposed(src_ptr + n * N_src_stride + d * D_src_stride + h * H_src_stride,
+                                     dst_ptr + n * N_dst_stride + d * D_dst_stride + h * H_dst_stride, C, W,
+                                     C_src_stride, W_src_stride, C_dst_stride, W_dst_stride);
+        });
     } else {
-        for (int i = 0; i < N * C * D * H * W; i++) {
-            dst_ptr[i] = src_ptr[i];
-        }
+        ie_memcpy(dst_ptr, bytes, src_ptr, bytes);
     }
 }
 
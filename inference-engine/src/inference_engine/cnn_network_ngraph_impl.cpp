@@ -75,6 +75,16 @@ static std::shared_ptr<ngraph::Function> copyFunction(const std::shared_ptr<cons
     return specialized_function;
 }
 
+static bool isStatic(const std::shared_ptr<const ngraph::Function>& func) {
+    for (const auto& op : func->get_ops()) {
+        for (const auto& output : op->outputs()) {
+            if (output.get_partial_shape().is_dynamic())
+                return false;
+        }
+    }
+    return true;
+}
+
 // WA: for cnnNetwork ngraph constructor
 CNNNetwork::CNNNetwork(const std::shared_ptr<const ngraph::Function>& graph) {
     if (graph == nullptr) {
@@ -359,27 +369,57 @@ CNNNetworkNGraphImpl::reshape(const std::map<std::string, std::vector<size_t>>&
     try {
         auto params = _ngraph_function->get_parameters();
 
+        ::ngraph::NodeVector changedParams;
         for (size_t i = 0; i < params.size(); i++) {
             const auto& param = params[i];
             if (inputShapes.find(param->get_friendly_name()) == inputShapes.end())
                 continue;
             ::ngraph::PartialShape shape(inputShapes.at(param->get_friendly_name()));
+            if (param->get_partial_shape().same_scheme(shape))
+                continue;
             auto newParam = std::make_shared<::ngraph::op::Parameter>(param->get_element_type(), shape);
             newParam->set_friendly_name(param->get_friendly_name());
             _ngraph_function->replace_parameter(i, newParam);
+            changedParams.push_back(newParam);
+        }
+
+        // Nothing to do if the network already has the requested shapes
+        if (!inputShapes.empty() && changedParams.empty())
+            return OK;
+
+        // Only nodes downstream of the changed inputs are revalidated
+        if (inputShapes.empty()) {
+            _ngraph_function->validate_nodes_and_infer_types();
+        } else {
+            _ngraph_function->validate_nodes_and_infer_types(changedParams);
         }
-        _ngraph_function->validate_nodes_and_infer_types();
 
         if (cnnNetwork) {
             convertToCNNNetworkImpl();
+        } else if (!inputShapes.empty() && isStatic(_ngraph_function)) {
+            // Constant folding can't refine static shapes, so data objects are updated from
+            // the function itself without specializing a copy of it
+            for (const auto& layer : _ngraph_function->get_ordered_ops()) {
+                for (const auto& output : layer->outputs()) {
+                    std::string outName = layer->get_friendly_name();
+                    if (layer->outputs().size() != 1)
+                        outName += "." + std::to_string(output.get_index());
+                    auto data = _data.find(outName);
+                    if (data != _data.end())
+                        createDataForResult(output, outName, data->second);
+                }
+            }
         } else {
             auto specialized_ngraph_function = cloneFunction(true, inputShapes);
             // Call this transformation because OneHot IE and nGraph have different output precisions
+            bool oneHotConverted = false;
             {
                 IE_PROFILING_AUTO_SCOPE(ConvertOneHot);
-                ::ngraph::pass::ConvertOneHotToOneHotIE().run_on_function(specialized_ngraph_function);
+                oneHotConverted = ::ngraph::pass::ConvertOneHotToOneHotIE().run_on_function(specialized_ngraph_function);
             }
-            specialized_ngraph_function->validate_nodes_and_infer_types();
+            // specialize_function has already validated the copy, only the OneHot consumers are stale
+            if (oneHotConverted)
+                specialized_ngraph_function->validate_nodes_and_infer_types();
 
 #if 0
             for (const auto &op : specialized_ngraph_function->get_ordered_ops()) {
@@ -0,0 +1,113 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "precision_utils_avx2.hpp"
+
+#include <immintrin.h>
+#include <stdint.h>
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+namespace details {
+
+namespace {
+
+// Stores lower halves of eight 32-bit values as 16-bit values
+inline void store_u16(ie_fp16* dst, __m256i v) {
+    // packus saturates and works within 128-bit lanes, so the values are truncated first
+    // and the qwords are gathered back in order after packing
+    v = _mm256_and_si256(v, _mm256_set1_epi32(0xFFFF));
+    const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(v, v), 0xD8);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm256_castsi256_si128(packed));
+}
+
+// Vector version of f32tof16: the same rounding, saturation and flushing of denormals
+inline __m256i f32tof16_avx2(__m256 x) {
+    const __m256i exp_mask = _mm256_set1_epi32(0x7F800000);
+    const __m256i u = _mm256_castps_si256(x);
+    const __m256i s = _mm256_and_si256(_mm256_srli_epi32(u, 16), _mm256_set1_epi32(0x8000));
+    const __m256i a = _mm256_and_si256(u, _mm256_set1_epi32(0x7FFFFFFF));
+    const __m256i e = _mm256_and_si256(a, exp_mask);
+
+    // NAN and INF keep upper bits of mantissa, NAN is made quiet
+    const __m256i is_nan_inf = _mm256_cmpeq_epi32(e, exp_mask);
+    const __m256i is_zero_mantissa = _mm256_cmpeq_epi32(_mm256_and_si256(a, _mm256_set1_epi32(0x007FFFFF)),
+                                                        _mm256_setzero_si256());
+    const __m256i nan_inf = _mm256_or_si256(_mm256_or_si256(s, _mm256_srli_epi32(a, 23 - 10)),
+                                            _mm256_andnot_si256(is_zero_mantissa, _mm256_set1_epi32(0x0200)));
+
+    // add halfULP of f16 to round to nearest value, the product is exact
+    const __m256 ulp_scale = _mm256_castsi256_ps(_mm256_set1_epi32((127 - 11) << 23));
+    const __m256 v = _mm256_add_ps(_mm256_castsi256_ps(a), _mm256_mul_ps(_mm256_castsi256_ps(e), ulp_scale));
+
+    const __m256 min16 = _mm256_castsi256_ps(_mm256_set1_epi32((127 - 14) << 23));
+    const __m256 half_min16 = _mm256_castsi256_ps(_mm256_set1_epi32((127 - 15) << 23));
+    const __m256 max16 = _mm256_castsi256_ps(_mm256_set1_epi32(((127 + 15) << 23) | 0x007FE000));
+
+    __m256i res = _mm256_or_si256(_mm256_srli_epi32(_mm256_sub_epi32(_mm256_castps_si256(v),
+                                                                     _mm256_set1_epi32((127 - 15) << 23)), 23 - 10), s);
+    res = _mm256_blendv_epi8(res, _mm256_or_si256(s, _mm256_set1_epi32(((15 + 15) << 10) | 0x3FF)),
+                             _mm256_castps_si256(_mm256_cmp_ps(v, max16, _CMP_GE_OQ)));
+    res = _mm256_blendv_epi8(res, _mm256_or_si256(s, _mm256_set1_epi32(1 << 10)),
+                             _mm256_castps_si256(_mm256_cmp_ps(v, min16, _CMP_LT_OQ)));
+    res = _mm256_blendv_epi8(res, s, _mm256_castps_si256(_mm256_cmp_ps(v, half_min16, _CMP_LT_OQ)));
+    return _mm256_blendv_epi8(res, nan_inf, is_nan_inf);
+}
+
+}  // namespace
+
+void f16tof32Arrays_avx2(float* dst, const ie_fp16* src, size_t nelem, float scale, float bias) {
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        const __m256 v = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        _mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_mul_ps(v, vscale), vbias));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = f16tof32(src[i]) * scale + bias;
+    }
+}
+
+void f32tof16Arrays_avx2(ie_fp16* dst, const float* src, size_t nelem, float scale, float bias) {
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        const __m256 v = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(src + i), vscale), vbias);
+        store_u16(dst + i, f32tof16_avx2(v));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = f32tof16(src[i] * scale + bias);
+    }
+}
+
+void bf16tof32Arrays_avx2(float* dst, const ie_bf16* src, size_t nelem) {
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        const __m256i v = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_slli_epi32(v, 16));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = bf16tof32(src[i]);
+    }
+}
+
+void f32tobf16Arrays_avx2(ie_bf16* dst, const float* src, size_t nelem) {
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        const __m256i u = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const __m256i rounding = _mm256_srli_epi32(_mm256_and_si256(u, _mm256_set1_epi32(0x00010000)), 1);
+        store_u16(dst + i, _mm256_srli_epi32(_mm256_add_epi32(u, rounding), 16));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = f32tobf16(src[i]);
+    }
+}
+
+}  // namespace details
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
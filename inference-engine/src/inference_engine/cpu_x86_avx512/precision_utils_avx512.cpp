@@ -0,0 +1,105 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "precision_utils_avx512.hpp"
+
+#include <immintrin.h>
+#include <stdint.h>
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+namespace details {
+
+namespace {
+
+// Vector version of f32tof16: the same rounding, saturation and flushing of denormals
+inline __m256i f32tof16_avx512(__m512 x) {
+    const __m512i exp_mask = _mm512_set1_epi32(0x7F800000);
+    const __m512i u = _mm512_castps_si512(x);
+    const __m512i s = _mm512_and_si512(_mm512_srli_epi32(u, 16), _mm512_set1_epi32(0x8000));
+    const __m512i a = _mm512_and_si512(u, _mm512_set1_epi32(0x7FFFFFFF));
+    const __m512i e = _mm512_and_si512(a, exp_mask);
+
+    // NAN and INF keep upper bits of mantissa, NAN is made quiet
+    const __mmask16 is_nan_inf = _mm512_cmpeq_epi32_mask(e, exp_mask);
+    const __mmask16 is_nan = _mm512_test_epi32_mask(a, _mm512_set1_epi32(0x007FFFFF));
+    __m512i nan_inf = _mm512_or_si512(s, _mm512_srli_epi32(a, 23 - 10));
+    nan_inf = _mm512_mask_or_epi32(nan_inf, is_nan, nan_inf, _mm512_set1_epi32(0x0200));
+
+    // add halfULP of f16 to round to nearest value, the product is exact
+    const __m512 ulp_scale = _mm512_castsi512_ps(_mm512_set1_epi32((127 - 11) << 23));
+    const __m512 v = _mm512_add_ps(_mm512_castsi512_ps(a), _mm512_mul_ps(_mm512_castsi512_ps(e), ulp_scale));
+
+    const __m512 min16 = _mm512_castsi512_ps(_mm512_set1_epi32((127 - 14) << 23));
+    const __m512 half_min16 = _mm512_castsi512_ps(_mm512_set1_epi32((127 - 15) << 23));
+    const __m512 max16 = _mm512_castsi512_ps(_mm512_set1_epi32(((127 + 15) << 23) | 0x007FE000));
+
+    __m512i res = _mm512_or_si512(_mm512_srli_epi32(_mm512_sub_epi32(_mm512_castps_si512(v),
+                                                                     _mm512_set1_epi32((127 - 15) << 23)), 23 - 10), s);
+    res = _mm512_mask_mov_epi32(res, _mm512_cmp_ps_mask(v, max16, _CMP_GE_OQ),
+                                _mm512_or_si512(s, _mm512_set1_epi32(((15 + 15) << 10) | 0x3FF)));
+    res = _mm512_mask_mov_epi32(res, _mm512_cmp_ps_mask(v, min16, _CMP_LT_OQ),
+                                _mm512_or_si512(s, _mm512_set1_epi32(1 << 10)));
+    res = _mm512_mask_mov_epi32(res, _mm512_cmp_ps_mask(v, half_min16, _CMP_LT_OQ), s);
+    res = _mm512_mask_mov_epi32(res, is_nan_inf, nan_inf);
+    return _mm512_cvtepi32_epi16(res);
+}
+
+}  // namespace
+
+void f16tof32Arrays_avx512(float* dst, const ie_fp16* src, size_t nelem, float scale, float bias) {
+    const __m512 vscale = _mm512_set1_ps(scale);
+    const __m512 vbias = _mm512_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 16 <= nelem; i += 16) {
+        const __m512 v = _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+        _mm512_storeu_ps(dst + i, _mm512_add_ps(_mm512_mul_ps(v, vscale), vbias));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = f16tof32(src[i]) * scale + bias;
+    }
+}
+
+void f32tof16Arrays_avx512(ie_fp16* dst, const float* src, size_t nelem, float scale, float bias) {
+    const __m512 vscale = _mm512_set1_ps(scale);
+    const __m512 vbias = _mm512_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 16 <= nelem; i += 16) {
+        const __m512 v = _mm512_add_ps(_mm512_mul_ps(_mm512_loadu_ps(src + i), vscale), vbias);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), f32tof16_avx512(v));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = f32tof16(src[i] * scale + bias);
+    }
+}
+
+void bf16tof32Arrays_avx512(float* dst, const ie_bf16* src, size_t nelem) {
+    size_t i = 0;
+    for (; i + 16 <= nelem; i += 16) {
+        const __m512i v = _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+        _mm512_storeu_si512(dst + i, _mm512_slli_epi32(v, 16));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = bf16tof32(src[i]);
+    }
+}
+
+void f32tobf16Arrays_avx512(ie_bf16* dst, const float* src, size_t nelem) {
+    size_t i = 0;
+    for (; i + 16 <= nelem; i += 16) {
+        const __m512i u = _mm512_loadu_si512(src + i);
+        const __m512i rounding = _mm512_srli_epi32(_mm512_and_si512(u, _mm512_set1_epi32(0x00010000)), 1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+                            _mm512_cvtepi32_epi16(_mm512_srli_epi32(_mm512_add_epi32(u, rounding), 16)));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = f32tobf16(src[i]);
+    }
+}
+
+}  // namespace details
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
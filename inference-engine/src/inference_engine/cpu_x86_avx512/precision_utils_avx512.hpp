@@ -0,0 +1,31 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stddef.h>
+
+#include "precision_utils.h"
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+namespace details {
+
+//------------------------------------------------------------------------
+//
+// Precision conversion primitives manually vectored for AVX-512F (w/o threads)
+//
+//------------------------------------------------------------------------
+
+void f16tof32Arrays_avx512(float* dst, const ie_fp16* src, size_t nelem, float scale, float bias);
+
+void f32tof16Arrays_avx512(ie_fp16* dst, const float* src, size_t nelem, float scale, float bias);
+
+void bf16tof32Arrays_avx512(float* dst, const ie_bf16* src, size_t nelem);
+
+void f32tobf16Arrays_avx512(ie_bf16* dst, const float* src, size_t nelem);
+
+}  // namespace details
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
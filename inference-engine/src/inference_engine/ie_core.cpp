@@ -28,6 +28,7 @@
 #include "ie_util_internal.hpp"
 #include "ie_network_reader.hpp"
 #include "multi-device/multi_device_config.hpp"
+#include "auto_batch/auto_batch_config.hpp"
 #include "xml_parse_utils.h"
 
 using namespace InferenceEngine::PluginConfigParams;
@@ -86,6 +87,9 @@ Parsed<T> parseDeviceNameIntoConfig(const std::string& deviceName, const std::ma
     } else if (deviceName_.find("MULTI:") == 0) {
         deviceName_ = "MULTI";
         config_[InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = deviceName.substr(6);
+    } else if (deviceName_.find("BATCH:") == 0) {
+        deviceName_ = "BATCH";
+        config_[InferenceEngine::AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE] = deviceName.substr(6);
     } else {
         DeviceIDParser parser(deviceName_);
         deviceName_ = parser.getDeviceName();
@@ -368,6 +372,15 @@ public:
             }
         }
 
+        // BATCH case
+        {
+            if (deviceName.find("BATCH:") == 0) {
+                THROW_IE_EXCEPTION
+                    << "You can get specific metrics with the GetMetric only for the BATCH itself (without devices). "
+                       "To get individual devices's metrics call GetMetric for each device separately";
+            }
+        }
+
         auto parsed = parseDeviceNameIntoConfig(deviceName);
         IE_SUPPRESS_DEPRECATED_START
         InferencePlugin cppPlugin = GetCPPPluginByName(parsed._deviceName);
@@ -616,6 +629,13 @@ std::map<std::string, Version> Core::GetVersions(const std::string& deviceName)
                 deviceNames = DeviceIDParser::getMultiDevices(deviceName.substr(pos + 1));
             }
             deviceNames.push_back("MULTI");
+        } else if (deviceName.find("BATCH") == 0) {
+            auto pos = deviceName.find_first_of(":");
+            if (pos != std::string::npos) {
+                // strip the batch size given in brackets
+                deviceNames.push_back(deviceName.substr(pos + 1, deviceName.find_first_of('(') - pos - 1));
+            }
+            deviceNames.push_back("BATCH");
         } else {
             deviceNames.push_back(deviceName);
         }
@@ -689,6 +709,9 @@ RemoteContext::Ptr Core::CreateContext(const std::string& deviceName_, const Par
     if (deviceName_.find("MULTI") == 0) {
         THROW_IE_EXCEPTION << "MULTI device does not support remote contexts";
     }
+    if (deviceName_.find("BATCH") == 0) {
+        THROW_IE_EXCEPTION << "BATCH device does not support remote contexts";
+    }
 
     DeviceIDParser device(deviceName_);
     std::string deviceName = device.getDeviceName();
@@ -712,6 +735,9 @@ RemoteContext::Ptr Core::GetDefaultContext(const std::string& deviceName_) {
     if (deviceName_.find("MULTI") == 0) {
         THROW_IE_EXCEPTION << "MULTI device does not support remote contexts";
     }
+    if (deviceName_.find("BATCH") == 0) {
+        THROW_IE_EXCEPTION << "BATCH device does not support remote contexts";
+    }
 
     DeviceIDParser device(deviceName_);
     std::string deviceName = device.getDeviceName();
@@ -737,6 +763,10 @@ void Core::AddExtension(IExtensionPtr extension, const std::string& deviceName_)
         THROW_IE_EXCEPTION
             << "MULTI device does not support extensions. Please, set extensions directly to fallback devices";
     }
+    if (deviceName_.find("BATCH") == 0) {
+        THROW_IE_EXCEPTION
+            << "BATCH device does not support extensions. Please, set extensions directly to the batched device";
+    }
 
     _impl->AddExtension(extension);
 }
@@ -749,6 +779,9 @@ ExecutableNetwork Core::ImportNetwork(const std::string& modelFileName, const st
     if (deviceName.find("MULTI") == 0) {
         THROW_IE_EXCEPTION << "MULTI device does not support ImportNetwork";
     }
+    if (deviceName.find("BATCH") == 0) {
+        THROW_IE_EXCEPTION << "BATCH device does not support ImportNetwork";
+    }
 
     auto parsed = parseDeviceNameIntoConfig(deviceName, config);
 
@@ -810,6 +843,14 @@ void Core::SetConfig(const std::map<std::string, std::string>& config, const std
         }
     }
 
+    // BATCH case
+    {
+        if (deviceName.find("BATCH:") == 0) {
+            THROW_IE_EXCEPTION << "SetConfig is supported only for BATCH itself (without devices). "
+                                  "You can configure the devices with SetConfig before creating the BATCH on top.";
+        }
+    }
+
     if (deviceName.empty()) {
         _impl->SetConfigForPlugins(config, std::string());
     } else {
@@ -835,6 +876,14 @@ Parameter Core::GetConfig(const std::string& deviceName, const std::string& name
                    "GetConfig is also possible for the individual devices before creating the MULTI on top.";
         }
     }
+    // BATCH case
+    {
+        if (deviceName.find("BATCH:") == 0) {
+            THROW_IE_EXCEPTION
+                << "You can only GetConfig of the BATCH itself (without devices). "
+                   "GetConfig is also possible for the individual devices before creating the BATCH on top.";
+        }
+    }
 
     auto parsed = parseDeviceNameIntoConfig(deviceName);
     IE_SUPPRESS_DEPRECATED_START
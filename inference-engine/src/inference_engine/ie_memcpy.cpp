@@ -7,8 +7,64 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <algorithm>
+
+#include "ie_parallel.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define IE_MEMCPY_STREAMING_STORES
+#endif
+
+namespace {
+
+// Copies larger than this are split between the threads of the current stream
+constexpr size_t PARALLEL_COPY_THRESHOLD = 1 << 20;
+// Every thread gets at least this number of bytes to copy
+constexpr size_t MIN_PARALLEL_CHUNK = 1 << 18;
+// Copies larger than this do not fit into the cache, so non-temporal stores are used to avoid its pollution
+constexpr size_t NON_TEMPORAL_COPY_THRESHOLD = 1 << 23;
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+#ifdef IE_MEMCPY_STREAMING_STORES
+void copy_non_temporal(uint8_t* dst, const uint8_t* src, size_t count) {
+    // streaming stores require the aligned destination
+    const size_t head = std::min(count, (16 - (reinterpret_cast<uintptr_t>(dst) & 15)) & 15);
+    memcpy(dst, src, head);
+    dst += head;
+    src += head;
+    count -= head;
+
+    size_t i = 0;
+    for (; i + CACHE_LINE_SIZE <= count; i += CACHE_LINE_SIZE) {
+        const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 16));
+        const __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 32));
+        const __m128i v3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 48));
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i), v0);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + 16), v1);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + 32), v2);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + 48), v3);
+    }
+    // make the streaming stores visible to other threads before the copy is reported as done
+    _mm_sfence();
+    memcpy(dst + i, src + i, count - i);
+}
+#endif
+
+void copy_serial(uint8_t* dst, const uint8_t* src, size_t count, bool non_temporal) {
+#ifdef IE_MEMCPY_STREAMING_STORES
+    if (non_temporal) {
+        copy_non_temporal(dst, src, count);
+        return;
+    }
+#endif
+    memcpy(dst, src, count);
+}
+
+}  // namespace
+
 int ie_memcpy(void* dest, size_t destsz, void const* src, size_t count) {
-    size_t i;
     if (!src || count > destsz ||
         count > (dest > src ? ((uintptr_t)dest - (uintptr_t)src) : ((uintptr_t)src - (uintptr_t)dest))) {
         // zero out dest if error detected
@@ -16,6 +72,25 @@ int ie_memcpy(void* dest, size_t destsz, void const* src, size_t count) {
         return -1;
     }
 
-    for (i = 0; i < count; ++i) (reinterpret_cast<uint8_t*>(dest))[i] = (reinterpret_cast<const uint8_t*>(src))[i];
+    auto dst_ptr = reinterpret_cast<uint8_t*>(dest);
+    auto src_ptr = reinterpret_cast<const uint8_t*>(src);
+    const bool non_temporal = count >= NON_TEMPORAL_COPY_THRESHOLD;
+    const int num_threads = static_cast<int>(std::min<size_t>(parallel_get_max_threads(),
+                                                              count / MIN_PARALLEL_CHUNK));
+    if (count < PARALLEL_COPY_THRESHOLD || num_threads <= 1) {
+        copy_serial(dst_ptr, src_ptr, count, non_temporal);
+        return 0;
+    }
+
+    // chunks are made of whole cache lines to limit false sharing on their borders
+    const size_t lines = (count + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE;
+    InferenceEngine::parallel_nt(num_threads, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        InferenceEngine::splitter(lines, nthr, ithr, start, end);
+        start *= CACHE_LINE_SIZE;
+        end = std::min(end * CACHE_LINE_SIZE, count);
+        if (start < end)
+            copy_serial(dst_ptr + start, src_ptr + start, end - start, non_temporal);
+    });
     return 0;
 }
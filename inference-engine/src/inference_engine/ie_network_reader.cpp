@@ -122,8 +122,10 @@ void registerReaders() {
 
     // try to load IR reader if library exists
     auto irReader = create_if_exists("IR", std::string("inference_engine_ir_reader") + std::string(IE_BUILD_POSTFIX));
-    if (irReader)
+    if (irReader) {
         readers.emplace("xml", irReader);
+        readers.emplace("irb", irReader);
+    }
     initialized = true;
 }
 
@@ -6,7 +6,12 @@
 #include <cstring>
 #include "ie_parallel.hpp"
 #include "ie_system_conf.h"
+#include <algorithm>
 #include <iostream>
+#include <map>
+#include <set>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #ifdef ENABLE_MKL_DNN
@@ -15,6 +20,11 @@
 # include <xbyak_util.h>
 #endif
 
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+# include <xmmintrin.h>
+# define IE_HAS_MXCSR
+#endif
+
 namespace InferenceEngine {
 
 #ifdef ENABLE_MKL_DNN
@@ -60,6 +70,18 @@ bool with_cpu_x86_avx2() {
 #endif
 }
 
+bool with_cpu_x86_f16c() {
+#ifdef ENABLE_MKL_DNN
+    return get_cpu_info().has(Xbyak::util::Cpu::tF16C);
+#else
+#if defined(HAVE_AVX2)
+    return true;
+#else
+    return false;
+#endif
+#endif
+}
+
 bool with_cpu_x86_avx512f() {
 #ifdef ENABLE_MKL_DNN
     return get_cpu_info().has(Xbyak::util::Cpu::tAVX512F);
@@ -86,6 +108,15 @@ bool with_cpu_x86_avx512_core() {
 #endif
 }
 
+bool with_cpu_x86_avx512_core_vnni() {
+#ifdef ENABLE_MKL_DNN
+    return with_cpu_x86_avx512_core() && get_cpu_info().has(Xbyak::util::Cpu::tAVX512VL |
+                                                            Xbyak::util::Cpu::tAVX512_VNNI);
+#else
+    return false;
+#endif
+}
+
 bool with_cpu_x86_bfloat16() {
 #ifdef ENABLE_MKL_DNN
     return get_cpu_info().has(Xbyak::util::Cpu::tAVX512_BF16);
@@ -94,6 +125,19 @@ bool with_cpu_x86_bfloat16() {
 #endif
 }
 
+bool set_denormals_as_zero(bool on) {
+#ifdef IE_HAS_MXCSR
+    // FTZ (bit 15) flushes denormal results to zero, DAZ (bit 6) treats denormal operands as zeros
+    constexpr unsigned int FTZ_DAZ = 0x8040;
+    const unsigned int mxcsr = _mm_getcsr();
+    _mm_setcsr(on ? (mxcsr | FTZ_DAZ) : (mxcsr & ~FTZ_DAZ));
+    return (mxcsr & FTZ_DAZ) == FTZ_DAZ;
+#else
+    (void)on;
+    return false;
+#endif
+}
+
 bool checkOpenMpEnvVars(bool includeOMPNumThreads) {
     for (auto&& var : {
         "GOMP_CPU_AFFINITY",
@@ -135,6 +179,79 @@ bool checkOpenMpEnvVars(bool includeOMPNumThreads) {
     return false;
 }
 
+CPUTopology::CPUTopology(std::vector<Processor> processors) : _processors{std::move(processors)} {
+    std::sort(_processors.begin(), _processors.end(), [] (const Processor& l, const Processor& r) {
+        return l.id < r.id;
+    });
+
+    // SMT rank of a processor is its index among the siblings of the core
+    std::map<int, int> siblings;
+    std::vector<std::pair<int, const Processor*>> ranked;
+    for (auto&& processor : _processors) {
+        ranked.emplace_back(siblings[processor.core]++, &processor);
+    }
+    _cores = static_cast<int>(siblings.size());
+
+    std::stable_sort(ranked.begin(), ranked.end(), [] (const std::pair<int, const Processor*>& l,
+                                                       const std::pair<int, const Processor*>& r) {
+        return std::make_tuple(l.first, l.second->numaNode, l.second->l3, l.second->l2, l.second->core) <
+               std::make_tuple(r.first, r.second->numaNode, r.second->l3, r.second->l2, r.second->core);
+    });
+    for (auto&& processor : ranked) {
+        _placementOrder.push_back(processor.second->id);
+    }
+}
+
+const std::vector<CPUTopology::Processor>& CPUTopology::getProcessors() const {
+    return _processors;
+}
+
+const std::vector<int>& CPUTopology::getPlacementOrder() const {
+    return _placementOrder;
+}
+
+int CPUTopology::getCoresNumber() const {
+    return _cores;
+}
+
+std::vector<int> CPUTopology::getCoresPerL3Domain() const {
+    std::map<int, int> domains;
+    for (auto&& processor : _processors) {
+        domains[processor.id] = processor.l3;
+    }
+    // the first _cores entries of the placement order are distinct cores grouped by L3 domains
+    std::vector<int> cores;
+    for (int i = 0; i < _cores; i++) {
+        if (0 == i || domains[_placementOrder[i]] != domains[_placementOrder[i - 1]]) {
+            cores.push_back(0);
+        }
+        cores.back()++;
+    }
+    return cores;
+}
+
+std::vector<int> CPUTopology::getNUMANodes() const {
+    std::set<int> nodes;
+    for (auto&& processor : _processors) {
+        nodes.insert(processor.numaNode);
+    }
+    return {nodes.begin(), nodes.end()};
+}
+
+#if defined(__APPLE__) || defined(_WIN32)
+// no topology information is read on these OSes, so every logical processor is a core
+const CPUTopology& getCPUTopology() {
+    static const CPUTopology topology{[] {
+        std::vector<CPUTopology::Processor> processors(std::max(1, parallel_get_max_threads()));
+        for (int i = 0; i < static_cast<int>(processors.size()); i++) {
+            processors[i].id = processors[i].core = i;
+        }
+        return processors;
+    }()};
+    return topology;
+}
+#endif
+
 #if defined(__APPLE__)
 // for Linux and Windows the getNumberOfCPUCores (that accounts only for physical cores) implementation is OS-specific
 // (see cpp files in corresponding folders), for __APPLE__ it is default :
@@ -1,16 +1,22 @@
-// Copyright (C) 2018-2019 Intel Corporation
+// Copyright (C) 2018-2020 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <cstdlib>
 #include <fstream>
 #include <map>
+#include <sstream>
 #include <string>
+#include <tuple>
 #include <vector>
 #include <iostream>
 #include <sched.h>
 #include "ie_system_conf.h"
 #include "ie_parallel.hpp"
 #include "details/ie_exception.hpp"
+#include "os/lin/lin_system_conf.hpp"
+#include "threading/ie_thread_affinity.hpp"
 #include <numeric>
 
 
@@ -54,34 +60,140 @@ struct CPU {
     }
 };
 static CPU cpu;
+
+namespace {
+
+bool readLine(const std::string& path, std::string& line) {
+    std::ifstream file(path);
+    return file.is_open() && std::getline(file, line) && !line.empty();
+}
+
+// Returns the first processor of the list or -1 if the file can not be read
+int readFirstProcessor(const std::string& path) {
+    std::string line;
+    if (!readLine(path, line))
+        return -1;
+    auto processors = parseProcessorsList(line);
+    return processors.empty() ? -1 : processors.front();
+}
+
+}  // namespace
+
+std::vector<int> parseProcessorsList(const std::string& list) {
+    std::vector<int> processors;
+    std::istringstream stream(list);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        try {
+            auto dash = range.find('-');
+            const int first = std::stoi(range.substr(0, dash));
+            const int last = (dash == std::string::npos) ? first : std::stoi(range.substr(dash + 1));
+            for (int id = first; id <= last; id++) {
+                processors.push_back(id);
+            }
+        } catch (const std::exception&) {
+            // skip garbage like trailing new lines
+        }
+    }
+    return processors;
+}
+
+std::vector<CPUTopology::Processor> readCPUTopology(const std::string& sysfsRoot, const std::vector<int>& processors) {
+    std::map<int, int> numaNodes;
+    std::string nodesList;
+    if (readLine(sysfsRoot + "/node/online", nodesList)) {
+        for (auto node : parseProcessorsList(nodesList)) {
+            std::string cpuList;
+            if (readLine(sysfsRoot + "/node/node" + std::to_string(node) + "/cpulist", cpuList)) {
+                for (auto id : parseProcessorsList(cpuList)) {
+                    numaNodes[id] = node;
+                }
+            }
+        }
+    }
+
+    std::vector<CPUTopology::Processor> result;
+    for (auto id : processors) {
+        const std::string cpuRoot = sysfsRoot + "/cpu/cpu" + std::to_string(id);
+        CPUTopology::Processor processor;
+        processor.id = id;
+        processor.core = readFirstProcessor(cpuRoot + "/topology/thread_siblings_list");
+
+        // without the NUMA information every package is considered as a node
+        std::string package;
+        auto node = numaNodes.find(id);
+        if (node != numaNodes.end()) {
+            processor.numaNode = node->second;
+        } else if (readLine(cpuRoot + "/topology/physical_package_id", package)) {
+            processor.numaNode = std::max(0, std::atoi(package.c_str()));
+        }
+
+        // processors of the same package share the last level cache if L3 is not reported
+        const int packageDomain = readFirstProcessor(cpuRoot + "/topology/core_siblings_list");
+        processor.l3 = packageDomain < 0 ? 0 : packageDomain;
+        processor.l2 = processor.core;
+        for (int index = 0;; index++) {
+            const std::string cacheRoot = cpuRoot + "/cache/index" + std::to_string(index);
+            std::string level, type;
+            if (!readLine(cacheRoot + "/level", level))
+                break;
+            if (readLine(cacheRoot + "/type", type) && type == "Instruction")
+                continue;
+            const int domain = readFirstProcessor(cacheRoot + "/shared_cpu_list");
+            if (domain < 0)
+                continue;
+            if (level == "2") {
+                processor.l2 = domain;
+            } else if (level == "3") {
+                processor.l3 = domain;
+            }
+        }
+        result.push_back(processor);
+    }
+    return result;
+}
+
+const CPUTopology& getCPUTopology() {
+    static const CPUTopology topology{[] {
+        std::vector<int> available;
+        CpuSet mask;
+        int ncpus = 0;
+        std::tie(mask, ncpus) = GetProcessMask();
+        for (int id = 0; id < ncpus; id++) {
+            if (CPU_ISSET_S(id, CPU_ALLOC_SIZE(ncpus), mask.get()))
+                available.push_back(id);
+        }
+        if (available.empty()) {
+            available.resize(std::max(1, cpu._processors));
+            std::iota(available.begin(), available.end(), 0);
+        }
+
+        auto processors = readCPUTopology("/sys/devices/system", available);
+        const int cores = std::max(1, cpu._cores);
+        for (auto&& processor : processors) {
+            if (processor.core < 0) {
+                // sysfs is not available, so assume that SMT siblings are enumerated after all cores
+                processor.core = processor.l2 = processor.id % cores;
+            }
+        }
+        return processors;
+    }()};
+    return topology;
+}
+
 #if !((IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO))
 std::vector<int> getAvailableNUMANodes() {
-    std::vector<int> nodes((0 == cpu._sockets) ? 1 : cpu._sockets);
-    std::iota(std::begin(nodes), std::end(nodes), 0);
+    auto nodes = getCPUTopology().getNUMANodes();
+    if (nodes.empty())
+        nodes.push_back(0);
     return nodes;
 }
 #endif
+
 int getNumberOfCPUCores() {
-    unsigned numberOfProcessors = cpu._processors;
-    unsigned totalNumberOfCpuCores = cpu._cores;
-    IE_ASSERT(totalNumberOfCpuCores != 0);
-    cpu_set_t usedCoreSet, currentCoreSet, currentCpuSet;
-    CPU_ZERO(&currentCpuSet);
-    CPU_ZERO(&usedCoreSet);
-    CPU_ZERO(&currentCoreSet);
-
-    sched_getaffinity(0, sizeof(currentCpuSet), &currentCpuSet);
-
-    for (int processorId = 0; processorId < numberOfProcessors; processorId++) {
-        if (CPU_ISSET(processorId, &currentCpuSet)) {
-            unsigned coreId = processorId % totalNumberOfCpuCores;
-            if (!CPU_ISSET(coreId, &usedCoreSet)) {
-                CPU_SET(coreId, &usedCoreSet);
-                CPU_SET(processorId, &currentCoreSet);
-            }
-        }
-    }
-    return CPU_COUNT(&currentCoreSet);
+    const int cores = getCPUTopology().getCoresNumber();
+    IE_ASSERT(cores != 0);
+    return cores;
 }
 
 }  // namespace InferenceEngine
@@ -0,0 +1,29 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "ie_system_conf.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief      Parses a list of processors in the sysfs format (e.g. "0-3,8,10-11")
+ * @param[in]  list  The list
+ * @return     Processor ids
+ */
+std::vector<int> parseProcessorsList(const std::string& list);
+
+/**
+ * @brief      Reads topology of the given processors from the sysfs
+ * @param[in]  sysfsRoot   A root of the sysfs devices tree, usually /sys/devices/system
+ * @param[in]  processors  Processor ids to read topology of
+ * @return     Processors, `core` is -1 if the topology of the processor is not available
+ */
+std::vector<CPUTopology::Processor> readCPUTopology(const std::string& sysfsRoot, const std::vector<int>& processors);
+
+}  // namespace InferenceEngine
@@ -7,23 +7,169 @@
 
 #include <stdint.h>
 
+#include <algorithm>
+
+#include "ie_parallel.hpp"
+#include "ie_system_conf.h"
+
+#ifdef HAVE_AVX2
+#include "cpu_x86_avx2/precision_utils_avx2.hpp"
+#endif
+
+#ifdef HAVE_AVX512
+#include "cpu_x86_avx512/precision_utils_avx512.hpp"
+#endif
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define IE_PRECISION_UTILS_NEON
+#endif
+
 namespace InferenceEngine {
 namespace PrecisionUtils {
 
-void f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
-    const ie_fp16* _src = reinterpret_cast<const ie_fp16*>(src);
+namespace {
 
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f16tof32(_src[i]) * scale + bias;
+// Arrays shorter than this are converted by the calling thread only
+constexpr size_t PARALLEL_CONVERT_THRESHOLD = 1 << 16;
+// Every thread gets at least this number of elements to convert
+constexpr size_t MIN_PARALLEL_CHUNK = 1 << 14;
+// Chunks are made of whole vectors, so only the last one has a scalar tail
+constexpr size_t VECTOR_BLOCK = 16;
+
+template <typename Convert>
+void convert_parallel(size_t nelem, const Convert& convert) {
+    const int num_threads = static_cast<int>(std::min<size_t>(parallel_get_max_threads(),
+                                                              nelem / MIN_PARALLEL_CHUNK));
+    if (nelem < PARALLEL_CONVERT_THRESHOLD || num_threads <= 1) {
+        convert(0, nelem);
+        return;
     }
+
+    const size_t blocks = (nelem + VECTOR_BLOCK - 1) / VECTOR_BLOCK;
+    parallel_nt(num_threads, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(blocks, nthr, ithr, start, end);
+        start *= VECTOR_BLOCK;
+        end = std::min(end * VECTOR_BLOCK, nelem);
+        if (start < end)
+            convert(start, end - start);
+    });
 }
 
-void f32tof16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias) {
+void f16tof32Arrays_ref(float* dst, const ie_fp16* src, size_t nelem, float scale, float bias) {
+    size_t i = 0;
+#ifdef IE_PRECISION_UTILS_NEON
+    // f16 -> f32 conversion is exact, so the hardware one gives the same values
+    const float32x4_t vscale = vdupq_n_f32(scale);
+    const float32x4_t vbias = vdupq_n_f32(bias);
+    for (; i + 4 <= nelem; i += 4) {
+        const float32x4_t v = vcvt_f32_f16(vreinterpret_f16_s16(vld1_s16(src + i)));
+        vst1q_f32(dst + i, vaddq_f32(vmulq_f32(v, vscale), vbias));
+    }
+#endif
+    for (; i < nelem; i++) {
+        dst[i] = PrecisionUtils::f16tof32(src[i]) * scale + bias;
+    }
+}
+
+void f32tof16Arrays_ref(ie_fp16* dst, const float* src, size_t nelem, float scale, float bias) {
     for (size_t i = 0; i < nelem; i++) {
         dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
     }
 }
 
+void bf16tof32Arrays_ref(float* dst, const ie_bf16* src, size_t nelem) {
+    size_t i = 0;
+#ifdef IE_PRECISION_UTILS_NEON
+    for (; i + 4 <= nelem; i += 4) {
+        const uint32x4_t v = vshll_n_u16(vreinterpret_u16_s16(vld1_s16(src + i)), 16);
+        vst1q_f32(dst + i, vreinterpretq_f32_u32(v));
+    }
+#endif
+    for (; i < nelem; i++) {
+        dst[i] = PrecisionUtils::bf16tof32(src[i]);
+    }
+}
+
+void f32tobf16Arrays_ref(ie_bf16* dst, const float* src, size_t nelem) {
+    size_t i = 0;
+#ifdef IE_PRECISION_UTILS_NEON
+    for (; i + 4 <= nelem; i += 4) {
+        const uint32x4_t u = vreinterpretq_u32_f32(vld1q_f32(src + i));
+        const uint32x4_t rounding = vshrq_n_u32(vandq_u32(u, vdupq_n_u32(0x00010000)), 1);
+        vst1_s16(dst + i, vreinterpret_s16_u16(vshrn_n_u32(vaddq_u32(u, rounding), 16)));
+    }
+#endif
+    for (; i < nelem; i++) {
+        dst[i] = PrecisionUtils::f32tobf16(src[i]);
+    }
+}
+
+using f16tof32_kernel_t = void (*)(float*, const ie_fp16*, size_t, float, float);
+using f32tof16_kernel_t = void (*)(ie_fp16*, const float*, size_t, float, float);
+using bf16tof32_kernel_t = void (*)(float*, const ie_bf16*, size_t);
+using f32tobf16_kernel_t = void (*)(ie_bf16*, const float*, size_t);
+
+// Selects the widest implementation supported by the CPU, all of them give the same results
+template <typename Kernel>
+Kernel select_kernel(Kernel ref, Kernel avx2, Kernel avx512, bool avx2UsesF16C = false) {
+    if (avx512 && with_cpu_x86_avx512f())
+        return avx512;
+    if (avx2 && with_cpu_x86_avx2() && (!avx2UsesF16C || with_cpu_x86_f16c()))
+        return avx2;
+    return ref;
+}
+
+#ifdef HAVE_AVX2
+#define AVX2_KERNEL(name) details::name##_avx2
+#else
+#define AVX2_KERNEL(name) nullptr
+#endif
+
+#ifdef HAVE_AVX512
+#define AVX512_KERNEL(name) details::name##_avx512
+#else
+#define AVX512_KERNEL(name) nullptr
+#endif
+
+}  // namespace
+
+void f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
+    static const auto kernel = select_kernel<f16tof32_kernel_t>(f16tof32Arrays_ref, AVX2_KERNEL(f16tof32Arrays),
+                                                                AVX512_KERNEL(f16tof32Arrays), true);
+    convert_parallel(nelem, [&](size_t start, size_t count) {
+        kernel(dst + start, src + start, count, scale, bias);
+    });
+}
+
+void f32tof16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias) {
+    static const auto kernel = select_kernel<f32tof16_kernel_t>(f32tof16Arrays_ref, AVX2_KERNEL(f32tof16Arrays),
+                                                                AVX512_KERNEL(f32tof16Arrays));
+    convert_parallel(nelem, [&](size_t start, size_t count) {
+        kernel(dst + start, src + start, count, scale, bias);
+    });
+}
+
+void bf16tof32Arrays(float* dst, const ie_bf16* src, size_t nelem) {
+    static const auto kernel = select_kernel<bf16tof32_kernel_t>(bf16tof32Arrays_ref, AVX2_KERNEL(bf16tof32Arrays),
+                                                                 AVX512_KERNEL(bf16tof32Arrays));
+    convert_parallel(nelem, [&](size_t start, size_t count) {
+        kernel(dst + start, src + start, count);
+    });
+}
+
+void f32tobf16Arrays(ie_bf16* dst, const float* src, size_t nelem) {
+    static const auto kernel = select_kernel<f32tobf16_kernel_t>(f32tobf16Arrays_ref, AVX2_KERNEL(f32tobf16Arrays),
+                                                                 AVX512_KERNEL(f32tobf16Arrays));
+    convert_parallel(nelem, [&](size_t start, size_t count) {
+        kernel(dst + start, src + start, count);
+    });
+}
+
+#undef AVX512_KERNEL
+#undef AVX2_KERNEL
+
 // Function to convert F32 into F16
 // F32: exp_bias:127 SEEEEEEE EMMMMMMM MMMMMMMM MMMMMMMM.
 // F16: exp_bias:15  SEEEEEMM MMMMMMMM
@@ -164,5 +310,19 @@ ie_fp16 f32tof16(float x) {
     return v.u | s;
 }
 
+// bfloat16 is the upper half of f32, rounding is the same as in ngraph::bfloat16
+ie_bf16 f32tobf16(float x) {
+    union {
+        float f;
+        uint32_t u;
+    } v;
+    v.f = x;
+    return static_cast<ie_bf16>((v.u + ((v.u & 0x00010000) >> 1)) >> 16);
+}
+
+float bf16tof32(ie_bf16 x) {
+    return asfloat(static_cast<uint32_t>(static_cast<uint16_t>(x)) << 16);
+}
+
 }  // namespace PrecisionUtils
 }  // namespace InferenceEngine
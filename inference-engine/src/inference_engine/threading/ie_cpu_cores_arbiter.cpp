@@ -0,0 +1,98 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "threading/ie_cpu_cores_arbiter.hpp"
+
+#include <algorithm>
+
+#include "details/ie_exception.hpp"
+#include "ie_system_conf.h"
+
+namespace InferenceEngine {
+
+CPUCoresArbiter::CPUCoresArbiter(int cores) :
+    _cores{cores > 0 ? cores : std::max(1, getNumberOfCPUCores())} {
+}
+
+int CPUCoresArbiter::acquire(int weight) {
+    if (weight <= 0)
+        THROW_IE_EXCEPTION << "CPU cores share weight should be positive, got " << weight;
+
+    std::lock_guard<std::mutex> lock{_mutex};
+    const int id = _nextId++;
+    _shares.emplace(id, Share{weight, {}});
+    rebalance();
+    return id;
+}
+
+void CPUCoresArbiter::release(int id) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    if (_shares.erase(id))
+        rebalance();
+}
+
+CPUCoresArbiter::Partition CPUCoresArbiter::getPartition(int id) const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto found = _shares.find(id);
+    if (found == _shares.end()) {
+        Partition all;
+        all.size = _cores;
+        return all;
+    }
+    return found->second.partition;
+}
+
+int CPUCoresArbiter::quote(int weight) const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    long long totalWeight = std::max(weight, 1);
+    for (const auto& share : _shares)
+        totalWeight += share.second.weight;
+    return std::max(1, static_cast<int>(static_cast<long long>(_cores) * std::max(weight, 1) / totalWeight));
+}
+
+unsigned CPUCoresArbiter::getGeneration() const {
+    return _generation.load(std::memory_order_acquire);
+}
+
+int CPUCoresArbiter::nextOffset(int threads) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    const int offset = _nextOffset;
+    _nextOffset = (_nextOffset + std::max(threads, 1)) % _cores;
+    return offset;
+}
+
+int CPUCoresArbiter::getCoresNumber() const {
+    return _cores;
+}
+
+void CPUCoresArbiter::rebalance() {
+    _generation.fetch_add(1, std::memory_order_release);
+    if (_shares.empty())
+        return;
+
+    long long totalWeight = 0;
+    for (const auto& share : _shares)
+        totalWeight += share.second.weight;
+
+    // Proportional sizes rounded down, the remaining cores go to the oldest shares
+    int distributed = 0;
+    for (auto& share : _shares) {
+        share.second.partition.size = std::max(1, static_cast<int>(static_cast<long long>(_cores) * share.second.weight / totalWeight));
+        distributed += share.second.partition.size;
+    }
+    for (auto it = _shares.begin(); distributed < _cores; ++distributed) {
+        it->second.partition.size++;
+        if (++it == _shares.end())
+            it = _shares.begin();
+    }
+
+    // More shares than cores: the partitions wrap around and overlap
+    int offset = 0;
+    for (auto& share : _shares) {
+        share.second.partition.offset = offset % _cores;
+        offset += share.second.partition.size;
+    }
+}
+
+}  // namespace InferenceEngine
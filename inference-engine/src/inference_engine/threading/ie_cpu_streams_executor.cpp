@@ -21,34 +21,50 @@
 #include "details/ie_exception.hpp"
 #include "ie_util_internal.hpp"
 #include "threading/ie_cpu_streams_executor.hpp"
+#include "threading/ie_executor_manager.hpp"
 
 namespace InferenceEngine {
 struct CPUStreamsExecutor::Impl {
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         struct Observer: public tbb::task_scheduler_observer {
+            Impl*   _impl                   = nullptr;
             CpuSet  _mask;
             int     _ncpus                  = 0;
             int     _threadBindingStep      = 0;
             int     _offset                 = 0;
             Observer(tbb::task_arena&    arena,
+                     Impl*               impl,
                      CpuSet              mask,
                      int                 ncpus,
                      const int           streamId,
                      const int           threadsPerStream,
-                     const int           threadBindingStep,
-                     const int           threadBindingOffset) :
+                     const int           threadBindingStep) :
                 tbb::task_scheduler_observer(arena),
+                _impl{impl},
                 _mask{std::move(mask)},
                 _ncpus(ncpus),
                 _threadBindingStep(threadBindingStep),
-                _offset{streamId * threadsPerStream  + threadBindingOffset} {
+                _offset{streamId * threadsPerStream} {
             }
             void on_scheduler_entry(bool) override {
-                PinThreadToVacantCore(_offset + tbb::task_arena::current_thread_index(), _threadBindingStep, _ncpus, _mask);
+                if (nullptr != _mask) {
+                    // The binding index is evaluated on each entry, so threads follow rebalanced cores partitions
+                    PinThreadToVacantCore(_impl->GetThreadBindingIndex(_offset + tbb::task_arena::current_thread_index()),
+                                          _threadBindingStep, _ncpus, _mask);
+                }
+                if (_impl->_config._denormalsAsZero) {
+                    set_denormals_as_zero(true);
+                }
             }
-            void on_scheduler_exit(bool) override {
-                PinCurrentThreadByMask(_ncpus, _mask);
+            void on_scheduler_exit(bool isWorker) override {
+                if (nullptr != _mask) {
+                    PinCurrentThreadByMask(_ncpus, _mask);
+                }
+                // Workers go back to the global TBB pool, so they should not keep the modes of this executor
+                if (isWorker && _impl->_config._denormalsAsZero) {
+                    set_denormals_as_zero(false);
+                }
             }
             ~Observer() override = default;
         };
@@ -71,50 +87,76 @@ struct CPUStreamsExecutor::Impl {
             auto concurrency = (0 == _impl->_config._threadsPerStream) ? tbb::task_arena::automatic : _impl->_config._threadsPerStream;
             if (ThreadBindingType::NUMA == _impl->_config._threadBindingType) {
                 _taskArena.reset(new tbb::task_arena{tbb::task_arena::constraints{_numaNodeId, concurrency}});
-            } else if ((0 != _impl->_config._threadsPerStream) || (ThreadBindingType::CORES == _impl->_config._threadBindingType)) {
+            } else if ((0 != _impl->_config._threadsPerStream) || (ThreadBindingType::CORES == _impl->_config._threadBindingType) ||
+                       _impl->_config._denormalsAsZero) {
+                // Threads of the default arena can't be observed, so an own arena is needed to set their modes
                 _taskArena.reset(new tbb::task_arena{concurrency});
+            }
+            if (nullptr != _taskArena) {
+                CpuSet processMask;
+                int    ncpus = 0;
                 if (ThreadBindingType::CORES == _impl->_config._threadBindingType) {
-                    CpuSet processMask;
-                    int    ncpus = 0;
                     std::tie(processMask, ncpus) = GetProcessMask();
-                    if (nullptr != processMask) {
-                        _observer.reset(new Observer{*_taskArena,
-                                                     std::move(processMask),
-                                                     ncpus,
-                                                     _streamId,
-                                                     _impl->_config._threadsPerStream,
-                                                     _impl->_config._threadBindingStep,
-                                                     _impl->_config._threadBindingOffset});
-                        _observer->observe(true);
-                    }
+                }
+                if ((nullptr != processMask) || _impl->_config._denormalsAsZero) {
+                    _observer.reset(new Observer{*_taskArena,
+                                                 _impl,
+                                                 std::move(processMask),
+                                                 ncpus,
+                                                 _streamId,
+                                                 _impl->_config._threadsPerStream,
+                                                 _impl->_config._threadBindingStep});
+                    _observer->observe(true);
                 }
             }
 #elif IE_THREAD == IE_THREAD_OMP
             omp_set_num_threads(_impl->_config._threadsPerStream);
             if (!checkOpenMpEnvVars(false) && (ThreadBindingType::NONE != _impl->_config._threadBindingType)) {
-                CpuSet processMask;
-                int    ncpus = 0;
-                std::tie(processMask, ncpus) = GetProcessMask();
-                if (nullptr != processMask) {
-                    parallel_nt(_impl->_config._threadsPerStream, [&] (int threadIndex, int threadsPerStream) {
-                        int thrIdx = _streamId * _impl->_config._threadsPerStream + threadIndex + _impl->_config._threadBindingOffset;
-                        PinThreadToVacantCore(thrIdx, _impl->_config._threadBindingStep, ncpus, processMask);
-                    });
-                }
+                PinThreads();
+            }
+            if (_impl->_config._denormalsAsZero) {
+                // OpenMP threads of the stream thread are reused, so the modes are set once
+                parallel_nt(_impl->_config._threadsPerStream, [] (int, int) {
+                    set_denormals_as_zero(true);
+                });
             }
 #elif IE_THREAD == IE_THREAD_SEQ
             if (ThreadBindingType::NUMA == _impl->_config._threadBindingType) {
                 PinCurrentThreadToSocket(_numaNodeId);
             } else if (ThreadBindingType::CORES == _impl->_config._threadBindingType) {
-                CpuSet processMask;
-                int    ncpus = 0;
-                std::tie(processMask, ncpus) = GetProcessMask();
-                if (nullptr != processMask) {
-                    PinThreadToVacantCore(_streamId + _impl->_config._threadBindingOffset, _impl->_config._threadBindingStep, ncpus, processMask);
-                }
+                PinThreads();
             }
 #endif
         }
+#if IE_THREAD == IE_THREAD_OMP || IE_THREAD == IE_THREAD_SEQ
+        // Threads of the stream are pinned to the cores of the current partition once
+        void PinThreads() {
+            _pinned = true;
+            _bindingGeneration = ExecutorManager::getInstance()->getCoresArbiter().getGeneration();
+            CpuSet processMask;
+            int    ncpus = 0;
+            std::tie(processMask, ncpus) = GetProcessMask();
+            if (nullptr == processMask) {
+                return;
+            }
+#if IE_THREAD == IE_THREAD_OMP
+            parallel_nt(_impl->_config._threadsPerStream, [&] (int threadIndex, int threadsPerStream) {
+                int thrIdx = _impl->GetThreadBindingIndex(_streamId * _impl->_config._threadsPerStream + threadIndex);
+                PinThreadToVacantCore(thrIdx, _impl->_config._threadBindingStep, ncpus, processMask);
+            });
+#else
+            PinThreadToVacantCore(_impl->GetThreadBindingIndex(_streamId), _impl->_config._threadBindingStep, ncpus, processMask);
+#endif
+        }
+        // Unlike TBB arenas, OpenMP and sequential streams have no hook on thread entry,
+        // so their threads are pinned again before a task if the partitions were rebalanced since
+        void UpdateBinding() {
+            if (_pinned && (_impl->_coresShareId >= 0) &&
+                (_bindingGeneration != ExecutorManager::getInstance()->getCoresArbiter().getGeneration())) {
+                PinThreads();
+            }
+        }
+#endif
         ~Stream() {
             {
                 std::lock_guard<std::mutex> lock{_impl->_streamIdMutex};
@@ -135,6 +177,9 @@ struct CPUStreamsExecutor::Impl {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         std::unique_ptr<tbb::task_arena>    _taskArena;
         std::unique_ptr<Observer>           _observer;
+#else
+        bool        _pinned             = false;
+        unsigned    _bindingGeneration  = 0;
 #endif
     };
 
@@ -143,6 +188,16 @@ struct CPUStreamsExecutor::Impl {
         _streams([this] {
             return std::make_shared<Impl::Stream>(this);
         }) {
+        _threadBindingOffset = _config._threadBindingOffset;
+        if (ThreadBindingType::CORES == _config._threadBindingType) {
+            auto& arbiter = ExecutorManager::getInstance()->getCoresArbiter();
+            if (_config._coresWeight > 0) {
+                _coresShareId = arbiter.acquire(_config._coresWeight);
+            } else if (0 == _config._threadBindingOffset) {
+                // Executors without a share start at different cores unless the offset is set explicitly
+                _threadBindingOffset = arbiter.nextOffset(std::max(1, _config._streams) * std::max(1, _config._threadsPerStream));
+            }
+        }
         auto numaNodes = getAvailableNUMANodes();
         std::copy_n(std::begin(numaNodes),
                     std::min(std::max(static_cast<std::size_t>(1),
@@ -152,6 +207,9 @@ struct CPUStreamsExecutor::Impl {
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 annotateSetThreadName((_config._name + "_" + std::to_string(streamId)).c_str());
+                if (_config._denormalsAsZero) {
+                    set_denormals_as_zero(true);
+                }
                 for (bool stopped = false; !stopped;) {
                     Task task;
                     {
@@ -170,6 +228,15 @@ struct CPUStreamsExecutor::Impl {
         }
     }
 
+    // Maps the index of a thread within the executor to the index of a core to bind to
+    int GetThreadBindingIndex(int threadIndex) const {
+        if (_coresShareId < 0) {
+            return threadIndex + _threadBindingOffset;
+        }
+        auto partition = ExecutorManager::getInstance()->getCoresArbiter().getPartition(_coresShareId);
+        return partition.offset + threadIndex % partition.size;
+    }
+
     void Enqueue(Task task) {
         {
             std::lock_guard<std::mutex> lock(_mutex);
@@ -187,6 +254,7 @@ struct CPUStreamsExecutor::Impl {
             task();
         }
 #else
+        stream.UpdateBinding();
         task();
 #endif
     }
@@ -196,12 +264,17 @@ struct CPUStreamsExecutor::Impl {
         stream._taskQueue.push(std::move(task));
         if (!stream._execute) {
             stream._execute = true;
+            // Deferred tasks may run in a thread of the caller, so its modes are restored afterwards
+            const bool denormalsAsZero = _config._denormalsAsZero && set_denormals_as_zero(true);
             try {
                 while (!stream._taskQueue.empty()) {
                     Execute(stream._taskQueue.front(), stream);
                     stream._taskQueue.pop();
                 }
             } catch(...) {}
+            if (_config._denormalsAsZero) {
+                set_denormals_as_zero(denormalsAsZero);
+            }
             stream._execute = false;
         }
     }
@@ -216,6 +289,8 @@ struct CPUStreamsExecutor::Impl {
     std::queue<Task>                        _taskQueue;
     bool                                    _isStopped = false;
     std::vector<int>                        _usedNumaNodes;
+    int                                     _coresShareId = -1;
+    int                                     _threadBindingOffset = 0;
     ThreadLocal<std::shared_ptr<Stream>>    _streams;
 };
 
@@ -245,6 +320,9 @@ CPUStreamsExecutor::~CPUStreamsExecutor() {
             thread.join();
         }
     }
+    if (_impl->_coresShareId >= 0) {
+        ExecutorManager::getInstance()->getCoresArbiter().release(_impl->_coresShareId);
+    }
 }
 
 void CPUStreamsExecutor::Execute(Task task) {
@@ -23,6 +23,10 @@ ITaskExecutor::Ptr ExecutorManagerImpl::getExecutor(std::string id) {
 }
 
 IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config) {
+    // An executor with a cores share keeps it for its whole life, so it is not cached when idle
+    if (config._coresWeight > 0 && config._threadBindingType == IStreamsExecutor::ThreadBindingType::CORES)
+        return std::make_shared<CPUStreamsExecutor>(config);
+
     std::lock_guard<std::mutex> guard(streamExecutorMutex);
     for (const auto& it : cpuStreamsExecutors) {
         const auto& executor = it.second;
@@ -35,7 +39,8 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
             executorConfig._threadsPerStream == config._threadsPerStream &&
             executorConfig._threadBindingType == config._threadBindingType &&
             executorConfig._threadBindingStep == config._threadBindingStep &&
-            executorConfig._threadBindingOffset == config._threadBindingOffset)
+            executorConfig._threadBindingOffset == config._threadBindingOffset &&
+            executorConfig._denormalsAsZero == config._denormalsAsZero)
             return executor;
     }
     auto newExec = std::make_shared<CPUStreamsExecutor>(config);
@@ -43,6 +48,10 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
     return newExec;
 }
 
+CPUCoresArbiter& ExecutorManagerImpl::getCoresArbiter() {
+    return coresArbiter;
+}
+
 // for tests purposes
 size_t ExecutorManagerImpl::getExecutorsNumber() {
     return executors.size();
@@ -131,4 +140,8 @@ IStreamsExecutor::Ptr ExecutorManager::getIdleCPUStreamsExecutor(const IStreamsE
     return _impl.getIdleCPUStreamsExecutor(config);
 }
 
+CPUCoresArbiter& ExecutorManager::getCoresArbiter() {
+    return _impl.getCoresArbiter();
+}
+
 }  // namespace InferenceEngine
@@ -12,7 +12,6 @@
 #include <string>
 #include <algorithm>
 #include <vector>
-#include <thread>
 
 
 namespace InferenceEngine {
@@ -47,9 +46,9 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
             if (value == CONFIG_VALUE(CPU_THROUGHPUT_NUMA)) {
                 _streams = getAvailableNUMANodes().size();
             } else if (value == CONFIG_VALUE(CPU_THROUGHPUT_AUTO)) {
-                const int sockets = getAvailableNUMANodes().size();
+                // one thread per physical core, SMT siblings are not counted
+                const int num_cores = getNumberOfCPUCores();
                 // bare minimum of streams (that evenly divides available number of core)
-                const int num_cores = sockets == 1 ? std::thread::hardware_concurrency() : getNumberOfCPUCores();
                 if (0 == num_cores % 4)
                     _streams = std::max(4, num_cores / 4);
                 else if (0 == num_cores % 5)
@@ -58,6 +57,16 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
                     _streams = std::max(3, num_cores / 3);
                 else  // if user disables some cores say in BIOS, so we got weird #cores which is not easy to divide
                     _streams = 1;
+                // every L3 cache domain of the same size gets the same number of streams,
+                // so the streams do not span several domains
+                const auto coresPerL3Domain = getCPUTopology().getCoresPerL3Domain();
+                const int domains = coresPerL3Domain.size();
+                if (_streams > 1 && domains > 1 &&
+                    std::all_of(coresPerL3Domain.begin(), coresPerL3Domain.end(), [&] (int cores) {
+                        return cores == coresPerL3Domain.front();
+                    })) {
+                    _streams = std::min(num_cores, (_streams + domains - 1) / domains * domains);
+                }
             } else {
                 int val_i;
                 try {
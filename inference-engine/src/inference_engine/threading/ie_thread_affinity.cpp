@@ -1,4 +1,4 @@
-// Copyright (C) 2018-2019 Intel Corporation
+// Copyright (C) 2018-2020 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
 
@@ -8,6 +8,7 @@
 #include <cerrno>
 #include <utility>
 #include <tuple>
+#include <vector>
 
 
 #if !(defined(__APPLE__) || defined(_WIN32))
@@ -46,7 +47,25 @@ bool PinThreadToVacantCore(int thrIdx, int hyperthreads, int ncores, const CpuSe
     if (procMask == nullptr)
         return false;
     const size_t size = CPU_ALLOC_SIZE(ncores);
-    const int num_cpus = CPU_COUNT_S(size, procMask.get());
+
+    // Processors of the process mask in the placement order, so consecutive threads go to distinct
+    // physical cores sharing the same L3 cache before any SMT sibling is used
+    std::vector<int> processors;
+    for (auto id : getCPUTopology().getPlacementOrder()) {
+        if (id < ncores && CPU_ISSET_S(id, size, procMask.get()))
+            processors.push_back(id);
+    }
+    // the mask was changed after the topology detection, so just use its processors in order
+    if (processors.empty() || static_cast<int>(processors.size()) != CPU_COUNT_S(size, procMask.get())) {
+        processors.clear();
+        for (int id = 0; id < ncores; id++) {
+            if (CPU_ISSET_S(id, size, procMask.get()))
+                processors.push_back(id);
+        }
+    }
+    const int num_cpus = processors.size();
+    if (0 == num_cpus)
+        return false;
     thrIdx %= num_cpus;  // To limit unique number in [; num_cpus-1] range
     // Place threads with specified step
     int cpu_idx = 0;
@@ -56,34 +75,26 @@ bool PinThreadToVacantCore(int thrIdx, int hyperthreads, int ncores, const CpuSe
             cpu_idx = ++offset;
     }
 
-    // Find index of 'cpu_idx'-th bit that equals to 1
-    int mapped_idx = -1;
-    while (cpu_idx >= 0) {
-        if (CPU_ISSET_S(++mapped_idx, size, procMask.get()))
-            --cpu_idx;
-    }
-
     CpuSet targetMask{CPU_ALLOC(ncores)};
     CPU_ZERO_S(size, targetMask.get());
-    CPU_SET_S(mapped_idx, size, targetMask.get());
+    CPU_SET_S(processors[cpu_idx], size, targetMask.get());
     bool res = PinCurrentThreadByMask(ncores, targetMask);
     return res;
 }
 
 bool PinCurrentThreadToSocket(int socket) {
-    const int sockets = InferenceEngine::getAvailableNUMANodes().size();
-    const int cores = InferenceEngine::getNumberOfCPUCores();
-    const int cores_per_socket = cores/sockets;
-
     int ncpus = 0;
     CpuSet mask;
     std::tie(mask, ncpus) = GetProcessMask();
+    if (nullptr == mask)
+        return false;
     CpuSet targetMask{CPU_ALLOC(ncpus)};
     const size_t size = CPU_ALLOC_SIZE(ncpus);
     CPU_ZERO_S(size, targetMask.get());
 
-    for (int core = socket*cores_per_socket; core < (socket+1)*cores_per_socket; core++) {
-        CPU_SET_S(core, size, targetMask.get());
+    for (auto&& processor : getCPUTopology().getProcessors()) {
+        if (processor.numaNode == socket && processor.id < ncpus)
+            CPU_SET_S(processor.id, size, targetMask.get());
     }
     // respect the user-defined mask for the entire process
     CPU_AND_S(size, targetMask.get(), targetMask.get(), mask.get());
@@ -11,7 +11,7 @@
 #include <chrono>
 #include "details/ie_cnn_network_tools.h"
 #include "ie_util_internal.hpp"
-#include "ngraph/type/bfloat16.hpp"
+#include "precision_utils.h"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -115,7 +115,7 @@ void BF16Transformer::optimizeToFloat(InferenceEngine::CNNNetwork &network) {
         if (_skipmarking.find(iter->type) != _skipmarking.end()) {
             continue;
         }
-        if (_initbf16.find(iter->type) == _initbf16.end()
+        if (!isInitLayer(iter)
             && _complementbf16.find(iter->type) == _complementbf16.end()
             && _multiinput.find(iter->type) == _multiinput.end()) {
             // try to mark inputs of the unknown layer
@@ -137,7 +137,7 @@ void BF16Transformer::optimizeToFloat(InferenceEngine::CNNNetwork &network) {
                 }
             }
         }
-        if (_initbf16.find(iter->type) != _initbf16.end()) {
+        if (isInitLayer(iter)) {
             // verify if input activation tensor is not bf16 - add to toAnalyzeTensors as well
             // we are assuming here that _initbf16 contain only layers having one dynamic input
             // in other case algorithm should be changed to care about two dynamic input tensors
@@ -164,7 +164,7 @@ void BF16Transformer::optimizeToFloat(InferenceEngine::CNNNetwork &network) {
         // look into producer of the tensor
         auto layer = tensor->getCreatorLayer().lock();
         // if this layer is not from _initbf16 - analyze inputs
-        if (_initbf16.find(layer->type) == _initbf16.end()) {
+        if (!isInitLayer(layer)) {
             // for all inputs investigate and modify tensor precision if required
             for (size_t i = 0; i < layer->insData.size(); i++) {
                 bool marked = tryToMarkFP32(layer->insData[i].lock(), immutable);
@@ -200,6 +200,10 @@ void BF16Transformer::optimizeToFloat(InferenceEngine::CNNNetwork &network) {
 #endif
 }
 
+bool BF16Transformer::isInitLayer(const InferenceEngine::CNNLayerPtr& layer) const {
+    return _initbf16.find(layer->type) != _initbf16.end() && layer->params.find("weights_precision") == layer->params.end();
+}
+
 bool BF16Transformer::tryToMarkFP32(InferenceEngine::DataPtr data, const std::set<InferenceEngine::DataPtr>& immutable) {
     bool marked = false;
     if (immutable.find(data) == immutable.end() && data->getPrecision() == Precision::BF16) {
@@ -208,14 +212,14 @@ bool BF16Transformer::tryToMarkFP32(InferenceEngine::DataPtr data, const std::se
         // in other cases we need to mark tensor which is passed to several l ayers as FP32 only if there is at least one conusmer
         // produces data in FP32. I.e. there should be a way fo getting FP32 from output data to this point
         if (data->getInputTo().size() == 1) {
-            if (_initbf16.find(data->getInputTo().begin()->second->type) == _initbf16.end()) {
+            if (!isInitLayer(data->getInputTo().begin()->second)) {
                 marked = true;
             }
         } else {
             // get all consumers
             for (auto o : data->getInputTo()) {
                 // if tensor goes to several layers, we will mark it by FP32 only if one of the layer is unknown
-                if (_initbf16.find(o.second->type) == _initbf16.end() &&
+                if (!isInitLayer(o.second) &&
                     _complementbf16.find(o.second->type) == _complementbf16.end() &&
                     _multiinput.find(o.second->type) == _multiinput.end()) {
                     marked = true;
@@ -237,8 +241,6 @@ InferenceEngine::MemoryBlob::Ptr BF16Transformer::convertBF16ToFloat(InferenceEn
     short *bf16data = lmbf16.as<short *>();
     auto lmfp32 = weightsFP32->wmap();
     float *fp32data = lmfp32.as<float *>();
-    for (size_t i = 0; i < weightsFP32->size(); i++) {
-        fp32data[i] = ngraph::bfloat16::from_bits(bf16data[i]);
-    }
+    PrecisionUtils::bf16tof32Arrays(fp32data, bf16data, weightsFP32->size());
     return weightsFP32;
 }
@@ -32,6 +32,12 @@ class BF16Transformer {
     */
     bool tryToMarkFP32(InferenceEngine::DataPtr data, const std::set<InferenceEngine::DataPtr> &immutable);
 
+    /**
+    * Checks whether the layer belongs to _initbf16. FullyConnected layers with compressed weights
+    * compute in FP32, so they are treated as unknown layers
+    */
+    bool isInitLayer(const InferenceEngine::CNNLayerPtr& layer) const;
+
 public:
     /**
      * Restores Float point data types on edges which goes to non supported layers
@@ -12,6 +12,7 @@
 #include <algorithm>
 
 #include "ie_plugin_config.hpp"
+#include "cpu/cpu_config.hpp"
 #include "ie_common.h"
 
 #include <cpp_interfaces/exception2status.hpp>
@@ -84,6 +85,59 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_ENFORCE_BF16
                     << ". Expected only YES/NO";
             }
+        } else if (key == CPUConfigParams::KEY_CPU_EMBEDDING_TABLE_PRECISION) {
+            if (val == "FP32")
+                embeddingTablePrecision = Precision::FP32;
+            else if (val == "FP16")
+                embeddingTablePrecision = Precision::FP16;
+            else if (val == "BF16")
+                embeddingTablePrecision = Precision::BF16;
+            else if (val == "U8")
+                embeddingTablePrecision = Precision::U8;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_EMBEDDING_TABLE_PRECISION
+                    << ". Expected only FP32/FP16/BF16/U8";
+        } else if (key == CPUConfigParams::KEY_CPU_FC_WEIGHTS_PRECISION) {
+            if (val == "FP32" || val == "I8" || val == "I4")
+                fcWeightsPrecision = val;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_FC_WEIGHTS_PRECISION
+                    << ". Expected only FP32/I8/I4";
+        } else if (key == CPUConfigParams::KEY_CPU_DYNAMIC_QUANTIZATION) {
+            if (val == PluginConfigParams::NO || val == CPUConfigParams::CPU_PER_TENSOR || val == CPUConfigParams::CPU_PER_ROW)
+                dynamicQuantization = val;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_DYNAMIC_QUANTIZATION
+                    << ". Expected only NO/CPU_PER_TENSOR/CPU_PER_ROW";
+        } else if (key == CPUConfigParams::KEY_CPU_CORES_WEIGHT) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_CORES_WEIGHT
+                                   << ". Expected only non negative numbers";
+            }
+            if (val_i < 0) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_CORES_WEIGHT
+                                   << ". Expected only non negative numbers";
+            }
+            streamExecutorConfig._coresWeight = val_i;
+        } else if (key == CPUConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION) {
+            if (val == PluginConfigParams::YES)
+                streamExecutorConfig._denormalsAsZero = true;
+            else if (val == PluginConfigParams::NO)
+                streamExecutorConfig._denormalsAsZero = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION
+                    << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_COUNT_DENORMALS) {
+            if (val == PluginConfigParams::YES)
+                countDenormals = true;
+            else if (val == PluginConfigParams::NO)
+                countDenormals = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_COUNT_DENORMALS
+                    << ". Expected only YES/NO";
         } else {
             THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property " << key << " by CPU plugin";
         }
@@ -130,6 +184,13 @@ void Config::updateProperties() {
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES });
         else
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO });
+        _config.insert({ CPUConfigParams::KEY_CPU_EMBEDDING_TABLE_PRECISION, embeddingTablePrecision.name() });
+        _config.insert({ CPUConfigParams::KEY_CPU_FC_WEIGHTS_PRECISION, fcWeightsPrecision });
+        _config.insert({ CPUConfigParams::KEY_CPU_DYNAMIC_QUANTIZATION, dynamicQuantization });
+        _config.insert({ CPUConfigParams::KEY_CPU_CORES_WEIGHT, std::to_string(streamExecutorConfig._coresWeight) });
+        _config.insert({ CPUConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION,
+                         streamExecutorConfig._denormalsAsZero ? PluginConfigParams::YES : PluginConfigParams::NO });
+        _config.insert({ CPUConfigParams::KEY_CPU_COUNT_DENORMALS, countDenormals ? PluginConfigParams::YES : PluginConfigParams::NO });
     }
 }
 
@@ -7,6 +7,7 @@
 #include <string>
 #include <map>
 #include <threading/ie_istreams_executor.hpp>
+#include <ie_precision.hpp>
 
 namespace MKLDNNPlugin {
 
@@ -26,6 +27,7 @@ struct Config {
     };
 
     bool collectPerfCounters = false;
+    bool countDenormals = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
     std::string dumpToDot = "";
@@ -33,6 +35,9 @@ struct Config {
     std::string dumpQuantizedGraphToIr = "";
     int batchLimit = 0;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
+    InferenceEngine::Precision embeddingTablePrecision = InferenceEngine::Precision::FP32;
+    std::string fcWeightsPrecision = "FP32";
+    std::string dynamicQuantization = "NO";
 
 #if defined(__arm__) || defined(__aarch64__)
     // Currently INT8 mode is not optimized on ARM, fallback to FP32 mode.
@@ -0,0 +1,58 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "embedding_table_compressor.h"
+#include "nodes/embedding_bag_sum.hpp"
+#include "details/ie_cnn_network_tools.h"
+#include <string>
+#include <vector>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+using namespace InferenceEngine::Extensions::Cpu;
+
+void EmbeddingTableCompressor::compress(InferenceEngine::CNNNetwork &network) {
+    if (_precision == Precision::FP32)
+        return;
+
+    const auto format = MKLDNNEmbeddingBagSum::tableFormatFromString(_precision.name());
+    std::vector<CNNLayerPtr> sortedLayers = CNNNetSortTopologically(network);
+    for (auto& layer : sortedLayers) {
+        if (_embeddingLayers.find(layer->type) == _embeddingLayers.end() || layer->insData.empty())
+            continue;
+
+        auto tableData = layer->insData[0].lock();
+        if (!tableData || tableData->getPrecision() != Precision::FP32 || tableData->getDims().size() < 2)
+            continue;
+        // the table can be packed only if nobody else reads it
+        if (tableData->getInputTo().size() != 1)
+            continue;
+
+        auto constLayer = tableData->getCreatorLayer().lock();
+        if (!constLayer || !CaselessEq<std::string>()(constLayer->type, "Const") || constLayer->blobs.size() != 1)
+            continue;
+        auto srcBlob = constLayer->blobs.begin()->second;
+        if (!srcBlob || srcBlob->getTensorDesc().getPrecision() != Precision::FP32)
+            continue;
+
+        const auto& dims = tableData->getDims();
+        const size_t rows = dims[0];
+        size_t depth = 1lu;
+        for (size_t i = 1lu; i < dims.size(); i++)
+            depth *= dims[i];
+        const size_t rowSize = MKLDNNEmbeddingBagSum::getTableRowSize(format, depth);
+
+        TensorDesc packedDesc(Precision::U8, {rows, rowSize}, Layout::NC);
+        auto packedBlob = make_shared_blob<uint8_t>(packedDesc);
+        packedBlob->allocate();
+        MKLDNNEmbeddingBagSum::packTable(srcBlob->cbuffer().as<const float*>(), rows, depth, format,
+                                         packedBlob->buffer().as<uint8_t*>());
+
+        constLayer->blobs.begin()->second = packedBlob;
+        tableData->setPrecision(Precision::U8);
+        tableData->reshape({rows, rowSize}, Layout::NC);
+        layer->params["table_precision"] = _precision.name();
+    }
+}
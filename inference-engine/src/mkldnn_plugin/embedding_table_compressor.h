@@ -0,0 +1,31 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <details/caseless.hpp>
+#include <string>
+#include "inference_engine.hpp"
+
+namespace MKLDNNPlugin {
+
+/**
+ * Packs constant FP32 embedding tables of EmbeddingBag* and EmbeddingSegmentsSum layers into a compact
+ * row-wise format (FP16, BF16 or U8 with per-row scale and bias). The table constant is replaced with
+ * a U8 blob [rows, row_size] and the consuming layer gets "table_precision" parameter describing the rows.
+ */
+class EmbeddingTableCompressor {
+    const InferenceEngine::details::caseless_set<std::string> _embeddingLayers =
+        { "EmbeddingBagOffsetsSum", "EmbeddingBagPackedSum", "EmbeddingSegmentsSum" };
+
+public:
+    explicit EmbeddingTableCompressor(InferenceEngine::Precision precision) : _precision(precision) {}
+
+    void compress(InferenceEngine::CNNNetwork &network);
+
+private:
+    InferenceEngine::Precision _precision;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,68 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fc_weights_compressor.h"
+#include "nodes/mkldnn_fullyconnected_node.h"
+#include "details/ie_cnn_network_tools.h"
+#include <cpu/cpu_config.hpp>
+#include <string>
+#include <vector>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+using namespace InferenceEngine::Extensions::Cpu;
+
+void FullyConnectedWeightsCompressor::compress(InferenceEngine::CNNNetwork &network) {
+    const auto format = MKLDNNFullyConnectedNode::weightsFormatFromString(_precision);
+    if (format == fc_weights_format::FP32)
+        return;
+
+    std::string activationsQuantization;
+    if (format == fc_weights_format::I8 && _dynamicQuantization == CPUConfigParams::CPU_PER_TENSOR)
+        activationsQuantization = "PER_TENSOR";
+    else if (format == fc_weights_format::I8 && _dynamicQuantization == CPUConfigParams::CPU_PER_ROW)
+        activationsQuantization = "PER_ROW";
+
+    std::vector<CNNLayerPtr> sortedLayers = CNNNetSortTopologically(network);
+    for (auto& layer : sortedLayers) {
+        if (!CaselessEq<std::string>()(layer->type, "FullyConnected") &&
+            !CaselessEq<std::string>()(layer->type, "InnerProduct"))
+            continue;
+
+        auto* fcLayer = dynamic_cast<FullyConnectedLayer*>(layer.get());
+        if (fcLayer == nullptr || layer->precision != Precision::FP32 || layer->insData.size() != 1 ||
+            layer->outData.size() != 1 || layer->blobs.find("w-scale") != layer->blobs.end())
+            continue;
+
+        auto inData = layer->insData[0].lock();
+        if (!inData || inData->getPrecision() != Precision::FP32 ||
+            layer->outData[0]->getPrecision() != Precision::FP32)
+            continue;
+
+        auto srcBlob = fcLayer->_weights;
+        if (!srcBlob || srcBlob->getTensorDesc().getPrecision() != Precision::FP32 || fcLayer->_out_num == 0)
+            continue;
+        if (fcLayer->_biases && fcLayer->_biases->getTensorDesc().getPrecision() != Precision::FP32)
+            continue;
+
+        const size_t oc = fcLayer->_out_num;
+        const size_t ic = srcBlob->size() / oc;
+        if (ic * oc != srcBlob->size())
+            continue;
+        const size_t rowSize = MKLDNNFullyConnectedNode::getCompressedRowSize(format, ic);
+
+        TensorDesc packedDesc(Precision::U8, {oc, rowSize}, Layout::NC);
+        auto packedBlob = make_shared_blob<uint8_t>(packedDesc);
+        packedBlob->allocate();
+        MKLDNNFullyConnectedNode::packWeights(srcBlob->cbuffer().as<const float*>(), oc, ic, format,
+                                              packedBlob->buffer().as<uint8_t*>());
+
+        fcLayer->_weights = packedBlob;
+        layer->blobs["weights"] = packedBlob;
+        layer->params["weights_precision"] = _precision;
+        if (!activationsQuantization.empty())
+            layer->params["activations_quantization"] = activationsQuantization;
+    }
+}
@@ -0,0 +1,31 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include "inference_engine.hpp"
+
+namespace MKLDNNPlugin {
+
+/**
+ * Packs constant FP32 weights of FullyConnected layers into INT8 or INT4 rows with a per output channel
+ * scale. The "weights" blob is replaced with a U8 blob [out_num, row_size] and the layer gets
+ * "weights_precision" parameter describing the rows. Layers which are quantized or have weights
+ * coming from other layers are left intact.
+ * With dynamic quantization INT8 layers also get "activations_quantization" parameter (PER_TENSOR or PER_ROW).
+ */
+class FullyConnectedWeightsCompressor {
+public:
+    FullyConnectedWeightsCompressor(const std::string& precision, const std::string& dynamicQuantization)
+        : _precision(precision), _dynamicQuantization(dynamicQuantization) {}
+
+    void compress(InferenceEngine::CNNNetwork &network);
+
+private:
+    std::string _precision;
+    std::string _dynamicQuantization;
+};
+
+}  // namespace MKLDNNPlugin
@@ -11,6 +11,8 @@
 #include "mkldnn_infer_request.h"
 #include "mkldnn_memory_state.h"
 #include "bf16transformer.h"
+#include "embedding_table_compressor.h"
+#include "fc_weights_compressor.h"
 #include <ie_util_internal.hpp>
 #include <graph_tools.hpp>
 #include <cnn_network_int8_normalizer.hpp>
@@ -65,52 +67,69 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
     NetPass::ConvertPrecision(*_clonedNetwork, Precision::FP16, Precision::FP32);
     NetPass::ConvertPrecision(*_clonedNetwork, Precision::BOOL, Precision::U8);
 
-    if (s == StatusCode::OK && pstats && !pstats->isEmpty()) {
+    const bool withStatistics = s == StatusCode::OK && pstats && !pstats->isEmpty();
+    if (withStatistics) {
         CNNNetworkInt8Normalizer cnnorm;
         cnnorm.NormalizeNetwork(*_clonedNetwork, *pstats);
-    } else {
-        if (_cfg.lpTransformsMode == Config::LPTransformsMode::On) {
-            auto params = LayerTransformation::Params(true,  // updatePrecisions
-                                                      true,  // quantizeOutputs
-                                                      true,  // weightsToConst
-                                                      LayerTransformation::QuantizedTensorAlignment::UpdateLevel,  // quantizedTensorAlignmentOnActivations
-                                                      LayerTransformation::QuantizedTensorAlignment::None,  // quantizedTensorAlignmentOnWeights
-                                                      true,  // roundQuantizedValues
-                                                      true,  // updateBiases
-                                                      true);  // supportAsymmetricQuantization
-            LowPrecisionTransformer transformer(LowPrecisionTransformer::getAllTransformations(params).
-                add<ConvolutionTransformation>(LayerTransformation::Params(params).setPrecisionsOnActivations({ Precision::U8 }), "Convolution").
-                addCleanup<ScaleShiftToConvolutionTransformation>(
-                    LayerTransformation::Params(params).setPrecisionsOnActivations({ Precision::U8 }),
-                    "ScaleShift"));
-            transformer.transform(*_clonedNetwork);
-
-            // Check if network is INT8 or Binary.
-            // BF16 transformations were disabled since CPU plug-in doesn't support mixed precision execution:
-            // BF16 + INT8 or BF16 + BIN.
-            bool isFloatModel = true;
-            CNNNetworkIterator i(&network);
-            while (i != CNNNetworkIterator()) {
-                if (CaselessEq<std::string>()((*i)->type, "FakeQuantize")) {
-                    isFloatModel = false;
-                    break;
-                }
-                i++;
-            }
+    } else if (_cfg.lpTransformsMode == Config::LPTransformsMode::On) {
+        auto params = LayerTransformation::Params(true,  // updatePrecisions
+                                                  true,  // quantizeOutputs
+                                                  true,  // weightsToConst
+                                                  LayerTransformation::QuantizedTensorAlignment::UpdateLevel,  // quantizedTensorAlignmentOnActivations
+                                                  LayerTransformation::QuantizedTensorAlignment::None,  // quantizedTensorAlignmentOnWeights
+                                                  true,  // roundQuantizedValues
+                                                  true,  // updateBiases
+                                                  true);  // supportAsymmetricQuantization
+        LowPrecisionTransformer transformer(LowPrecisionTransformer::getAllTransformations(params).
+            add<ConvolutionTransformation>(LayerTransformation::Params(params).setPrecisionsOnActivations({ Precision::U8 }), "Convolution").
+            addCleanup<ScaleShiftToConvolutionTransformation>(
+                LayerTransformation::Params(params).setPrecisionsOnActivations({ Precision::U8 }),
+                "ScaleShift"));
+        transformer.transform(*_clonedNetwork);
+    }
+
+    // Compression goes before BF16 transformations: they expect FP32 layers, and BF16Transformer
+    // keeps layers with compressed weights in FP32
+    if (_cfg.embeddingTablePrecision != Precision::FP32) {
+        EmbeddingTableCompressor tableCompressor(_cfg.embeddingTablePrecision);
+        CNNNetwork cnnetwork(_clonedNetwork);
+        tableCompressor.compress(cnnetwork);
+    }
 
-            if (with_cpu_x86_bfloat16() && isFloatModel) {
-                BF16Transformer bf16Transformer;
-                CNNNetwork cnnetwork(_clonedNetwork);
-                // If enforceBF16 flag was set, BF16 transformation applies for all layers supported by CPU plugin.
-                // Overwise, only layers marked as BF16 in 'cnnetwork' will be performed in bfloat16 mode.
-                // CPU plugin throws an exception, if marked as BF16 layers have not supported by CPU plugin.
-                if (cfg.enforceBF16 == true)
-                    bf16Transformer.convertToBFloat16(cnnetwork);
-            } else {
-                BF16Transformer bf16Transformer;
-                CNNNetwork cnnetwork(_clonedNetwork);
-                bf16Transformer.convertToFloat(cnnetwork);
+    if (_cfg.fcWeightsPrecision != "FP32" || _cfg.dynamicQuantization != PluginConfigParams::NO) {
+        // integer dot products of dynamic quantization need INT8 weights
+        auto weightsPrecision = _cfg.fcWeightsPrecision == "FP32" ? std::string("I8") : _cfg.fcWeightsPrecision;
+        FullyConnectedWeightsCompressor weightsCompressor(weightsPrecision, _cfg.dynamicQuantization);
+        CNNNetwork cnnetwork(_clonedNetwork);
+        weightsCompressor.compress(cnnetwork);
+    }
+
+    if (!withStatistics && _cfg.lpTransformsMode == Config::LPTransformsMode::On) {
+        // Check if network is INT8 or Binary.
+        // BF16 transformations were disabled since CPU plug-in doesn't support mixed precision execution:
+        // BF16 + INT8 or BF16 + BIN.
+        bool isFloatModel = true;
+        CNNNetworkIterator i(&network);
+        while (i != CNNNetworkIterator()) {
+            if (CaselessEq<std::string>()((*i)->type, "FakeQuantize")) {
+                isFloatModel = false;
+                break;
             }
+            i++;
+        }
+
+        if (with_cpu_x86_bfloat16() && isFloatModel) {
+            BF16Transformer bf16Transformer;
+            CNNNetwork cnnetwork(_clonedNetwork);
+            // If enforceBF16 flag was set, BF16 transformation applies for all layers supported by CPU plugin.
+            // Overwise, only layers marked as BF16 in 'cnnetwork' will be performed in bfloat16 mode.
+            // CPU plugin throws an exception, if marked as BF16 layers have not supported by CPU plugin.
+            if (cfg.enforceBF16 == true)
+                bf16Transformer.convertToBFloat16(cnnetwork);
+        } else {
+            BF16Transformer bf16Transformer;
+            CNNNetwork cnnetwork(_clonedNetwork);
+            bf16Transformer.convertToFloat(cnnetwork);
         }
     }
 
@@ -128,12 +147,15 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         _taskExecutor = ExecutorManager::getInstance()->getExecutor("CPU");
     } else {
         const int env_threads = parallel_get_env_threads();
-        const auto& numa_nodes = getAvailableNUMANodes();
-        const auto numa_nodes_num = numa_nodes.size();
         auto streamExecutorConfig = cfg.streamExecutorConfig;
-        // use logical cores only for single-socket targets in throughput mode
-        const int hw_cores = streamExecutorConfig._streams > 1 && numa_nodes_num == 1 ? parallel_get_max_threads() : getNumberOfCPUCores();
-        const int threads = streamExecutorConfig._threads ? streamExecutorConfig._threads : (env_threads ? env_threads : hw_cores);
+        // one thread per physical core, so the streams do not compete for SMT siblings
+        const int hw_cores = getNumberOfCPUCores();
+        int threads = streamExecutorConfig._threads ? streamExecutorConfig._threads : (env_threads ? env_threads : hw_cores);
+        if (!streamExecutorConfig._threads && !env_threads && streamExecutorConfig._coresWeight > 0 &&
+            streamExecutorConfig._threadBindingType == IStreamsExecutor::ThreadBindingType::CORES) {
+            // size the executor to the share of cores the network is going to get
+            threads = std::min(threads, ExecutorManager::getInstance()->getCoresArbiter().quote(streamExecutorConfig._coresWeight));
+        }
         streamExecutorConfig._threadsPerStream = streamExecutorConfig._streams
                                                 ? std::max(1, threads/streamExecutorConfig._streams)
                                                 : threads;
@@ -637,6 +637,9 @@ void MKLDNNGraph::AllocateWithReuse() {
             // WA. MemoryOutput will keep data in that edge
             // So need to make it immortal..
             isConst |= edge->getParent()->getType() == MemoryInput;
+            // MemoryOutput swaps memory of its input with the state memory instead of copying,
+            // so the input is immortal too
+            isConst |= edge->getChild()->getType() == MemoryOutput;
         }
 
         if (reuse_io_tensors) {
@@ -788,24 +791,50 @@ void MKLDNNGraph::Infer(int batch) {
 
     mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
     for (int i = 0; i < graphNodes.size(); i++) {
-        PERF(graphNodes[i]);
+        {
+            PERF(graphNodes[i]);
+
+            if (batch > 0)
+                graphNodes[i]->setDynamicBatchLim(batch);
 
-        if (batch > 0)
-            graphNodes[i]->setDynamicBatchLim(batch);
+            ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[i]));
 
-        ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[i]));
+            if (!graphNodes[i]->isConstant()) {
+                IE_PROFILING_AUTO_SCOPE_TASK(graphNodes[i]->profilingTask)
+                graphNodes[i]->execute(stream);
+            }
 
-        if (!graphNodes[i]->isConstant()) {
-            IE_PROFILING_AUTO_SCOPE_TASK(graphNodes[i]->profilingTask)
-            graphNodes[i]->execute(stream);
+            ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
         }
 
-        ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
+        // outside of the PERF scope, so the execution time is not affected
+        if (config.countDenormals && !graphNodes[i]->isConstant())
+            CountOutputDenormals(graphNodes[i]);
     }
 
     if (infer_count != -1) infer_count++;
 }
 
+void MKLDNNGraph::CountOutputDenormals(const MKLDNNNodePtr& node) {
+    std::unordered_set<const void*> visited;
+    uint64_t denormals = 0;
+    uint64_t values = 0;
+    for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+        const MKLDNNMemory& memory = node->getChildEdgeAt(i)->getMemory();
+        if (memory.GetDataType() != memory::f32 || !visited.insert(memory.GetData()).second)
+            continue;
+
+        // a denormal has zero exponent and non-zero mantissa
+        const auto* data = static_cast<const uint32_t*>(memory.GetData());
+        const size_t size = memory.GetSize() / sizeof(float);
+        denormals += parallel_sum(size, uint64_t(0), [&](size_t j) -> uint64_t {
+            return (data[j] & 0x7f800000) == 0 && (data[j] & 0x007fffff) != 0;
+        });
+        values += size;
+    }
+    node->PerfCounter().count_denormals(denormals, values);
+}
+
 void MKLDNNGraph::VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes) {
     if (node->temporary) {
         return;
@@ -898,7 +927,7 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
         pc.execution_index = i++;
         // TODO: Why time counter is signed?
         pc.cpu_uSec = pc.realTime_uSec = (long long) node->PerfCounter().avg();
-        pc.status = pc.cpu_uSec > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
+        pc.status = node->PerfCounter().avg_ns() > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
                                     : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
         std::string pdType = node->getPrimitiveDescriptorType();
         size_t typeLen = sizeof(pc.exec_type) / sizeof(pc.exec_type[0]);
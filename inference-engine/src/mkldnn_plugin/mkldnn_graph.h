@@ -94,6 +94,7 @@ public:
 
 protected:
     void VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes);
+    void CountOutputDenormals(const MKLDNNNodePtr& node);
 
     void ForgetGraphData() {
         status = NotReady;
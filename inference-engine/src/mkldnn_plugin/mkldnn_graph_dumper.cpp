@@ -12,6 +12,8 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <iomanip>
+#include <sstream>
 
 using namespace InferenceEngine;
 
@@ -141,6 +143,13 @@ void copy_node_metadata(const MKLDNNNodePtr &node, CNNLayer::Ptr &layer) {
     }
     layer->params[ExecGraphInfoSerialization::OUTPUT_PRECISIONS] = outputPrecisionsStr;
 
+    layer->params[ExecGraphInfoSerialization::RUNTIME_PRECISION] = node->getRuntimePrecision().name();
+
+    auto weightsPrecision = node->getWeightsPrecision();
+    if (!weightsPrecision.empty()) {
+        layer->params[ExecGraphInfoSerialization::WEIGHTS_PRECISION] = weightsPrecision;
+    }
+
     std::string outputLayoutsStr;
     auto outLayouts = node->getSelectedPrimitiveDescriptor()->getOutputLayouts();
     if (!outLayouts.empty()) {
@@ -165,11 +174,18 @@ void copy_node_metadata(const MKLDNNNodePtr &node, CNNLayer::Ptr &layer) {
     layer->params[ExecGraphInfoSerialization::OUTPUT_LAYOUTS] = outputLayoutsStr;
 
     // Performance
-    if (node->PerfCounter().avg() != 0) {
-        layer->params[ExecGraphInfoSerialization::PERF_COUNTER] = std::to_string(node->PerfCounter().avg());
+    if (node->PerfCounter().avg_ns() > 0) {
+        // microseconds with nanosecond resolution, perf counters of the public API are truncated to microseconds
+        std::ostringstream execTime;
+        execTime << std::fixed << std::setprecision(3) << node->PerfCounter().avg_ns() / 1000.;
+        layer->params[ExecGraphInfoSerialization::PERF_COUNTER] = execTime.str();
     } else {
         layer->params[ExecGraphInfoSerialization::PERF_COUNTER] = "not_executed";  // it means it was not calculated yet
     }
+    // layers producing many denormals slow down their consumers unless CPU_DENORMALS_OPTIMIZATION is enabled
+    if (node->PerfCounter().denormals_counted()) {
+        layer->params[ExecGraphInfoSerialization::OUTPUT_DENORMALS_SHARE] = std::to_string(node->PerfCounter().denormals_share());
+    }
 
     layer->params[ExecGraphInfoSerialization::EXECUTION_ORDER] = std::to_string(node->getExecIndex());
 }
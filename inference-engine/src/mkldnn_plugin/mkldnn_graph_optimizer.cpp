@@ -13,6 +13,7 @@
 #include "nodes/mkldnn_concat_node.h"
 #include "nodes/mkldnn_reorder_node.h"
 #include "nodes/mkldnn_conv_node.h"
+#include "nodes/mkldnn_fullyconnected_node.h"
 #include "nodes/mkldnn_bin_conv_node.h"
 #include "nodes/mkldnn_quantize_node.h"
 #include "nodes/mkldnn_mvn_node.h"
@@ -776,8 +777,11 @@ void MKLDNNGraphOptimizer::FuseFullyConnectedAndSimpleOperation(MKLDNNGraph &gra
     auto& graphNodes = graph.GetNodes();
 
     auto isSutableParentNode = [](MKLDNNNodePtr node) {
-        return node->getType() == FullyConnected &&
-               node->getChildEdges().size() == 1;
+        if (node->getType() != FullyConnected || node->getChildEdges().size() != 1)
+            return false;
+        // compressed weights kernel has no post ops
+        auto* fcNode = dynamic_cast<MKLDNNFullyConnectedNode*>(node.get());
+        return fcNode != nullptr && !fcNode->isWeightsCompressed();
     };
 
     auto isSutableChildNode = [&](MKLDNNNodePtr node) {
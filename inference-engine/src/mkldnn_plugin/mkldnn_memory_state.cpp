@@ -4,6 +4,8 @@
 
 #include "mkldnn_memory_state.h"
 #include "mkldnn_extension_utils.h"
+#include "blob_factory.hpp"
+#include "ie_memcpy.h"
 
 using namespace InferenceEngine;
 
@@ -28,8 +30,20 @@ void  MKLDNNMemoryState::SetState(Blob::Ptr newState) {
 }
 
 InferenceEngine::Blob::CPtr MKLDNNMemoryState::GetLastState() const {
-    THROW_IE_EXCEPTION << "GetLastState method is not implemented for MemoryState";
-    return nullptr;
+    // The state memory is overwritten or swapped by the next infer, so the caller gets a copy of it
+    TensorDesc desc = MKLDNNMemoryDesc(storage->GetDescriptor());
+    auto lastState = make_blob_with_precision(desc);
+    lastState->allocate();
+    SaveState(lastState);
+    return lastState;
+}
+
+void MKLDNNMemoryState::SaveState(Blob::Ptr state) const {
+    if (state->byteSize() != storage->GetSize()) {
+        THROW_IE_EXCEPTION << "Cannot save memory state " << name << " of " << storage->GetSize()
+                           << " bytes to a blob of " << state->byteSize() << " bytes";
+    }
+    ie_memcpy(state->buffer(), state->byteSize(), storage->GetData(), storage->GetSize());
 }
 
 }  // namespace MKLDNNPlugin
\ No newline at end of file
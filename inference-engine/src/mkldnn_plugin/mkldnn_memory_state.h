@@ -20,6 +20,7 @@ public:
     void Reset() override;
     void SetState(InferenceEngine::Blob::Ptr newState) override;
     InferenceEngine::Blob::CPtr GetLastState() const override;
+    void SaveState(InferenceEngine::Blob::Ptr state) const override;
 
 private:
     std::string name;
@@ -441,6 +441,13 @@ std::string MKLDNNNode::getPrimitiveDescriptorType() {
     return str_type;
 }
 
+InferenceEngine::Precision MKLDNNNode::getRuntimePrecision() const {
+    auto selectedPrimitiveDesc = getSelectedPrimitiveDescriptor();
+    if (selectedPrimitiveDesc && !selectedPrimitiveDesc->getConfig().inConfs.empty())
+        return selectedPrimitiveDesc->getConfig().inConfs[0].desc.getPrecision();
+    return InferenceEngine::Precision::UNSPECIFIED;
+}
+
 const MKLDNNEdgePtr MKLDNNNode::getParentEdgeAt(size_t idx) const {
     if (idx >= parentEdges.size())
         THROW_IE_EXCEPTION << "Node " << getName() << " contains less parent edges than " << idx;
@@ -327,6 +327,19 @@ public:
 
     std::string getPrimitiveDescriptorType();
 
+    /**
+     * @brief Returns the precision the node computes in, the precision of the first input by default
+     */
+    virtual InferenceEngine::Precision getRuntimePrecision() const;
+
+    /**
+     * @brief Returns the precision constant weights are stored in if it differs from the input precision,
+     * an empty string otherwise
+     */
+    virtual std::string getWeightsPrecision() const {
+        return {};
+    }
+
     PerfCount &PerfCounter() { return perfCounter; }
 
     virtual void setDynamicBatchLim(int lim);
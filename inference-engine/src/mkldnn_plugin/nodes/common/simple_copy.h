@@ -6,6 +6,7 @@
 
 #include <stdlib.h>
 #include "ie_api.h"
+#include "ie_memcpy.h"
 
 /**
  * @brief Copies bytes between buffers with security enhancements
@@ -24,15 +25,5 @@
  */
 
 inline int simple_copy(void* dest, size_t destsz, void const* src, size_t count) {
-    size_t i;
-    if (!src || count > destsz ||
-        count > (dest > src ? ((uintptr_t)dest - (uintptr_t)src)
-                            : ((uintptr_t)src - (uintptr_t)dest))) {
-        // zero out dest if error detected
-        memset(dest, 0, destsz);
-        return -1;
-    }
-
-    for (i = 0; i < count; ++i) (reinterpret_cast<uint8_t*>(dest))[i] = (reinterpret_cast<const uint8_t*>(src))[i];
-    return 0;
+    return ie_memcpy(dest, destsz, src, count);
 }
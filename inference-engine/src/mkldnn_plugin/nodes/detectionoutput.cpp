@@ -3,6 +3,7 @@
 //
 
 #include "base.hpp"
+#include "detectionoutput_imp.hpp"
 
 #include <cfloat>
 #include <vector>
@@ -54,6 +55,11 @@ public:
             _code_type = (code_type_str == "caffe.PriorBoxParameter.CENTER_SIZE" ? CodeType::CENTER_SIZE
                                                                                  : CodeType::CORNER);
 
+            _decode_conf = {_prior_size, _offset, 4*_num_loc_classes, _normalized,
+                            static_cast<float>(_image_width), static_cast<float>(_image_height),
+                            _code_type == CodeType::CENTER_SIZE, _variance_encoded_in_target != 0, _clip_before_nms};
+            _kernels = XARCH::detection_output_get_kernels();
+
             _num_priors = static_cast<int>(layer->insData[idx_priors].lock()->getDims().back() / _prior_size);
             _priors_batches = layer->insData[idx_priors].lock()->getDims().front() != 1;
 
@@ -135,72 +141,93 @@ public:
         int *indices_data          = _indices->buffer();
         int *num_priors_actual     = _num_priors_actual->buffer();
 
-        for (int n = 0; n < N; ++n) {
-            const float *ppriors = prior_data;
-            const float *prior_variances = prior_data + _num_priors*_prior_size;
-            if (_priors_batches) {
-                ppriors += _variance_encoded_in_target ? n*_num_priors*_prior_size : 2*n*_num_priors*_prior_size;
-                prior_variances += _variance_encoded_in_target ? 0 : n*_num_priors*_prior_size;
-            }
+        // prior boxes of the image followed by their variances unless they are encoded in target
+        auto priors = [&](int n) {
+            return _priors_batches ? prior_data + (_variance_encoded_in_target ? n : 2*n)*_num_priors*_prior_size
+                                   : prior_data;
+        };
 
-            if (_share_location) {
-                const float *ploc = loc_data + n*4*_num_priors;
-                float *pboxes = decoded_bboxes_data + n*4*_num_priors;
-                float *psizes = bbox_sizes_data + n*_num_priors;
-                decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, num_priors_actual, n);
-            } else {
-                for (int c = 0; c < _num_loc_classes; ++c) {
-                    if (c == _background_label_id) {
-                        continue;
+        parallel_for(N, [&](int n) {
+            num_priors_actual[n] = _num_priors;
+            if (!_normalized) {
+                const float *ppriors = priors(n);
+                for (int p = 0; p < _num_priors; ++p) {
+                    if (ppriors[p*_prior_size] == -1.f) {
+                        num_priors_actual[n] = p;
+                        break;
                     }
-
-                    const float *ploc = loc_data + n*4*_num_loc_classes*_num_priors + c*4;
-                    float *pboxes = decoded_bboxes_data + n*4*_num_loc_classes*_num_priors + c*4*_num_priors;
-                    float *psizes = bbox_sizes_data + n*_num_loc_classes*_num_priors + c*_num_priors;
-                    decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, num_priors_actual, n);
                 }
             }
-        }
-
-        for (int n = 0; n < N; ++n) {
-            for (int c = 0; c < _num_classes; ++c) {
-                for (int p = 0; p < _num_priors; ++p) {
-                    reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
-                }
+        });
+
+        const int num_prior_blocks = (_num_priors + prior_block - 1) / prior_block;
+        parallel_for3d(N, _num_loc_classes, num_prior_blocks, [&](int n, int c, int b) {
+            if (!_share_location && c == _background_label_id)
+                return;
+
+            const int begin = b*prior_block;
+            const int end = (std::min)(begin + prior_block, num_priors_actual[n]);
+            if (begin >= end)
+                return;
+
+            const float *ppriors = priors(n);
+            const float *ploc = loc_data + n*4*_num_loc_classes*_num_priors + c*4;
+            float *pboxes = decoded_bboxes_data + n*4*_num_loc_classes*_num_priors + c*4*_num_priors;
+            float *psizes = bbox_sizes_data + n*_num_loc_classes*_num_priors + c*_num_priors;
+            _kernels.decode(ppriors, ploc, ppriors + _num_priors*_prior_size, _decode_conf, begin, end, pboxes, psizes);
+        });
+
+        parallel_for2d(N, _num_classes, [&](int n, int c) {
+            const float *pconf = conf_data + n*_num_priors*_num_classes + c;
+            float *preordered = reordered_conf_data + n*_num_priors*_num_classes + c*_num_priors;
+            for (int p = 0; p < _num_priors; ++p) {
+                preordered[p] = pconf[p*_num_classes];
             }
-        }
+        });
 
         memset(detections_data, 0, N*_num_classes*sizeof(int));
 
-        for (int n = 0; n < N; ++n) {
-            int detections_total = 0;
-
-            if (!_decrease_label_id) {
-                // Caffe style
-                parallel_for(_num_classes, [&](int c) {
-                    if (c != _background_label_id) {  // Ignore background class
-                        int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
-                        int *pbuffer     = buffer_data + c*_num_priors;
-                        int *pdetections = detections_data + n*_num_classes + c;
-
-                        const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
-                        const float *pboxes;
-                        const float *psizes;
-                        if (_share_location) {
-                            pboxes = decoded_bboxes_data + n*4*_num_priors;
-                            psizes = bbox_sizes_data + n*_num_priors;
-                        } else {
-                            pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
-                            psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
-                        }
-
-                        nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
+        if (!_decrease_label_id) {
+            // Caffe style
+            const int max_detections = _top_k == -1 ? _num_priors : (std::min)(_top_k, _num_priors);
+            parallel_nt(0, [&](const int ithr, const int nthr) {
+                int start = 0, end = 0;
+                splitter(N*_num_classes, nthr, ithr, start, end);
+                if (start >= end)
+                    return;
+
+                // kept boxes of the current class stored by components for the vectorized overlap check
+                std::vector<float> kept(5*max_detections);
+                for (int i = start; i < end; ++i) {
+                    const int n = i / _num_classes;
+                    const int c = i % _num_classes;
+                    if (c == _background_label_id)  // Ignore background class
+                        continue;
+
+                    int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
+                    int *pbuffer     = buffer_data + n*_num_classes*_num_priors + c*_num_priors;
+                    int *pdetections = detections_data + n*_num_classes + c;
+
+                    const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
+                    const float *pboxes;
+                    const float *psizes;
+                    if (_share_location) {
+                        pboxes = decoded_bboxes_data + n*4*_num_priors;
+                        psizes = bbox_sizes_data + n*_num_priors;
+                    } else {
+                        pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
+                        psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
                     }
-                });
-            } else {
-                // MXNet style
+
+                    nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n],
+                           kept.data(), max_detections);
+                }
+            });
+        } else {
+            // MXNet style
+            parallel_for(N, [&](int n) {
                 int *pindices = indices_data + n*_num_classes*_num_priors;
-                int *pbuffer = buffer_data;
+                int *pbuffer = buffer_data + n*_num_classes*_num_priors;
                 int *pdetections = detections_data + n*_num_classes;
 
                 const float *pconf = reordered_conf_data + n*_num_classes*_num_priors;
@@ -208,14 +235,18 @@ public:
                 const float *psizes = bbox_sizes_data + n*_num_priors;
 
                 nms_mx(pconf, pboxes, psizes, pbuffer, pindices, pdetections, _num_priors);
-            }
+            });
+        }
 
+        std::vector<int> detections_total(N, 0);
+        parallel_for(N, [&](int n) {
             for (int c = 0; c < _num_classes; ++c) {
-                detections_total += detections_data[n*_num_classes + c];
+                detections_total[n] += detections_data[n*_num_classes + c];
             }
 
-            if (_keep_top_k > -1 && detections_total > _keep_top_k) {
+            if (_keep_top_k > -1 && detections_total[n] > _keep_top_k) {
                 std::vector<std::pair<float, std::pair<int, int>>> conf_index_class_map;
+                conf_index_class_map.reserve(detections_total[n]);
 
                 for (int c = 0; c < _num_classes; ++c) {
                     int detections = detections_data[n*_num_classes + c];
@@ -228,9 +259,12 @@ public:
                     }
                 }
 
+                // only the order of the kept detections matters, so select them before sorting
+                std::nth_element(conf_index_class_map.begin(), conf_index_class_map.begin() + _keep_top_k,
+                                 conf_index_class_map.end(), SortScorePairDescend<std::pair<int, int>>);
+                conf_index_class_map.resize(_keep_top_k);
                 std::sort(conf_index_class_map.begin(), conf_index_class_map.end(),
                           SortScorePairDescend<std::pair<int, int>>);
-                conf_index_class_map.resize(_keep_top_k);
 
                 // Store the new indices.
                 memset(detections_data + n*_num_classes, 0, _num_classes * sizeof(int));
@@ -242,8 +276,9 @@ public:
                     pindices[detections_data[n*_num_classes + label]] = idx;
                     detections_data[n*_num_classes + label]++;
                 }
+                detections_total[n] = _keep_top_k;
             }
-        }
+        });
 
         const int DETECTION_SIZE = outputs[0]->getTensorDesc().getDims()[3];
         if (DETECTION_SIZE != 7) {
@@ -258,12 +293,18 @@ public:
 
         memset(dst_data, 0, dst_data_size);
 
-        int count = 0;
+        // detections of every image start right after the ones of the previous image
+        std::vector<int> detections_offset(N + 1, 0);
         for (int n = 0; n < N; ++n) {
+            detections_offset[n + 1] = detections_offset[n] + detections_total[n];
+        }
+
+        parallel_for(N, [&](int n) {
             const float *pconf   = reordered_conf_data + n * _num_priors * _num_classes;
             const float *pboxes  = decoded_bboxes_data + n*_num_priors*4*_num_loc_classes;
             const int *pindices  = indices_data + n*_num_classes*_num_priors;
 
+            int count = detections_offset[n];
             for (int c = 0; c < _num_classes; ++c) {
                 for (int i = 0; i < detections_data[n*_num_classes + c]; ++i) {
                     int idx = pindices[c*_num_priors + i];
@@ -296,8 +337,9 @@ public:
                     ++count;
                 }
             }
-        }
+        });
 
+        const int count = detections_offset[N];
         if (count < N*_keep_top_k) {
             // marker at end of boxes list
             dst_data[count * DETECTION_SIZE + 0] = -1;
@@ -343,11 +385,15 @@ private:
         CENTER_SIZE = 2,
     };
 
-    void decodeBBoxes(const float *prior_data, const float *loc_data, const float *variance_data,
-                      float *decoded_bboxes, float *decoded_bbox_sizes, int* num_priors_actual, int n);
+    // number of priors decoded by one task
+    static constexpr int prior_block = 64;
+
+    detection_output_decode_conf _decode_conf;
+    detection_output_kernels _kernels;
 
     void nms_cf(const float *conf_data, const float *bboxes, const float *sizes,
-                int *buffer, int *indices, int &detections, int num_priors_actual);
+                int *buffer, int *indices, int &detections, int num_priors_actual,
+                float *kept, int kept_stride);
 
     void nms_mx(const float *conf_data, const float *bboxes, const float *sizes,
                 int *buffer, int *indices, int *detections, int num_priors_actual);
@@ -410,113 +456,15 @@ static inline float JaccardOverlap(const float *decoded_bbox,
     return intersect_size / (bbox1_size + bbox2_size - intersect_size);
 }
 
-void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
-                                   const float *loc_data,
-                                   const float *variance_data,
-                                   float *decoded_bboxes,
-                                   float *decoded_bbox_sizes,
-                                   int* num_priors_actual,
-                                   int n) {
-    num_priors_actual[n] = _num_priors;
-    if (!_normalized) {
-        int num = 0;
-        for (; num < _num_priors; ++num) {
-            float batch_id = prior_data[num * _prior_size + 0];
-            if (batch_id == -1.f) {
-                num_priors_actual[n] = num;
-                break;
-            }
-        }
-    }
-
-    parallel_for(num_priors_actual[n], [&](int p) {
-        float new_xmin = 0.0f;
-        float new_ymin = 0.0f;
-        float new_xmax = 0.0f;
-        float new_ymax = 0.0f;
-
-        float prior_xmin = prior_data[p*_prior_size + 0 + _offset];
-        float prior_ymin = prior_data[p*_prior_size + 1 + _offset];
-        float prior_xmax = prior_data[p*_prior_size + 2 + _offset];
-        float prior_ymax = prior_data[p*_prior_size + 3 + _offset];
-
-        float loc_xmin = loc_data[4*p*_num_loc_classes + 0];
-        float loc_ymin = loc_data[4*p*_num_loc_classes + 1];
-        float loc_xmax = loc_data[4*p*_num_loc_classes + 2];
-        float loc_ymax = loc_data[4*p*_num_loc_classes + 3];
-
-        if (!_normalized) {
-            prior_xmin /= _image_width;
-            prior_ymin /= _image_height;
-            prior_xmax /= _image_width;
-            prior_ymax /= _image_height;
-        }
-
-        if (_code_type == CodeType::CORNER) {
-            if (_variance_encoded_in_target) {
-                // variance is encoded in target, we simply need to add the offset predictions.
-                new_xmin = prior_xmin + loc_xmin;
-                new_ymin = prior_ymin + loc_ymin;
-                new_xmax = prior_xmax + loc_xmax;
-                new_ymax = prior_ymax + loc_ymax;
-            } else {
-                new_xmin = prior_xmin + variance_data[p*4 + 0] * loc_xmin;
-                new_ymin = prior_ymin + variance_data[p*4 + 1] * loc_ymin;
-                new_xmax = prior_xmax + variance_data[p*4 + 2] * loc_xmax;
-                new_ymax = prior_ymax + variance_data[p*4 + 3] * loc_ymax;
-            }
-        } else if (_code_type == CodeType::CENTER_SIZE) {
-            float prior_width    =  prior_xmax - prior_xmin;
-            float prior_height   =  prior_ymax - prior_ymin;
-            float prior_center_x = (prior_xmin + prior_xmax) / 2.0f;
-            float prior_center_y = (prior_ymin + prior_ymax) / 2.0f;
-
-            float decode_bbox_center_x, decode_bbox_center_y;
-            float decode_bbox_width, decode_bbox_height;
-
-            if (_variance_encoded_in_target) {
-                // variance is encoded in target, we simply need to restore the offset predictions.
-                decode_bbox_center_x = loc_xmin * prior_width  + prior_center_x;
-                decode_bbox_center_y = loc_ymin * prior_height + prior_center_y;
-                decode_bbox_width  = std::exp(loc_xmax) * prior_width;
-                decode_bbox_height = std::exp(loc_ymax) * prior_height;
-            } else {
-                // variance is encoded in bbox, we need to scale the offset accordingly.
-                decode_bbox_center_x = variance_data[p*4 + 0] * loc_xmin * prior_width + prior_center_x;
-                decode_bbox_center_y = variance_data[p*4 + 1] * loc_ymin * prior_height + prior_center_y;
-                decode_bbox_width    = std::exp(variance_data[p*4 + 2] * loc_xmax) * prior_width;
-                decode_bbox_height   = std::exp(variance_data[p*4 + 3] * loc_ymax) * prior_height;
-            }
-
-            new_xmin = decode_bbox_center_x - decode_bbox_width  / 2.0f;
-            new_ymin = decode_bbox_center_y - decode_bbox_height / 2.0f;
-            new_xmax = decode_bbox_center_x + decode_bbox_width  / 2.0f;
-            new_ymax = decode_bbox_center_y + decode_bbox_height / 2.0f;
-        }
-
-        if (_clip_before_nms) {
-            new_xmin = (std::max)(0.0f, (std::min)(1.0f, new_xmin));
-            new_ymin = (std::max)(0.0f, (std::min)(1.0f, new_ymin));
-            new_xmax = (std::max)(0.0f, (std::min)(1.0f, new_xmax));
-            new_ymax = (std::max)(0.0f, (std::min)(1.0f, new_ymax));
-        }
-
-        decoded_bboxes[p*4 + 0] = new_xmin;
-        decoded_bboxes[p*4 + 1] = new_ymin;
-        decoded_bboxes[p*4 + 2] = new_xmax;
-        decoded_bboxes[p*4 + 3] = new_ymax;
-
-        decoded_bbox_sizes[p] = (new_xmax - new_xmin) * (new_ymax - new_ymin);
-    });
-}
-
 void DetectionOutputImpl::nms_cf(const float* conf_data,
                           const float* bboxes,
                           const float* sizes,
                           int* buffer,
                           int* indices,
                           int& detections,
-                          int num_priors_actual) {
+                          int num_priors_actual,
+                          float* kept,
+                          int kept_stride) {
     int count = 0;
     for (int i = 0; i < num_priors_actual; ++i) {
         if (conf_data[i] > _confidence_threshold) {
@@ -533,17 +481,13 @@ void DetectionOutputImpl::nms_cf(const float* conf_data,
 
     for (int i = 0; i < num_output_scores; ++i) {
         const int idx = buffer[i];
+        const float *bbox = bboxes + idx*4;
 
-        bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int kept_idx = indices[k];
-            float overlap = JaccardOverlap(bboxes, sizes, idx, kept_idx);
-            if (overlap > _nms_threshold) {
-                keep = false;
-                break;
+        if (!_kernels.overlaps(bbox, sizes[idx], kept, detections, kept_stride, _nms_threshold)) {
+            for (int j = 0; j < 4; ++j) {
+                kept[j*kept_stride + detections] = bbox[j];
             }
-        }
-        if (keep) {
+            kept[4*kept_stride + detections] = sizes[idx];
             indices[detections] = idx;
             detections++;
         }
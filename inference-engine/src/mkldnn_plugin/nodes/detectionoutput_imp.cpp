@@ -0,0 +1,282 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "detectionoutput_imp.hpp"
+
+#include <algorithm>
+#include <cmath>
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+namespace {
+
+#if defined(HAVE_AVX512F)
+constexpr int vlen = 16;
+typedef __m512 vec_type;
+
+inline vec_type vec_load(const float* src) { return _mm512_loadu_ps(src); }
+inline vec_type vec_set1(float value) { return _mm512_set1_ps(value); }
+inline vec_type vec_min(vec_type a, vec_type b) { return _mm512_min_ps(a, b); }
+inline vec_type vec_max(vec_type a, vec_type b) { return _mm512_max_ps(a, b); }
+inline vec_type vec_add(vec_type a, vec_type b) { return _mm512_add_ps(a, b); }
+inline vec_type vec_sub(vec_type a, vec_type b) { return _mm512_sub_ps(a, b); }
+inline vec_type vec_mul(vec_type a, vec_type b) { return _mm512_mul_ps(a, b); }
+inline vec_type vec_div(vec_type a, vec_type b) { return _mm512_div_ps(a, b); }
+inline unsigned vec_gt_mask(vec_type a, vec_type b) { return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); }
+#elif defined(HAVE_AVX2)
+constexpr int vlen = 8;
+typedef __m256 vec_type;
+
+inline vec_type vec_load(const float* src) { return _mm256_loadu_ps(src); }
+inline vec_type vec_set1(float value) { return _mm256_set1_ps(value); }
+inline vec_type vec_min(vec_type a, vec_type b) { return _mm256_min_ps(a, b); }
+inline vec_type vec_max(vec_type a, vec_type b) { return _mm256_max_ps(a, b); }
+inline vec_type vec_add(vec_type a, vec_type b) { return _mm256_add_ps(a, b); }
+inline vec_type vec_sub(vec_type a, vec_type b) { return _mm256_sub_ps(a, b); }
+inline vec_type vec_mul(vec_type a, vec_type b) { return _mm256_mul_ps(a, b); }
+inline vec_type vec_div(vec_type a, vec_type b) { return _mm256_div_ps(a, b); }
+inline unsigned vec_gt_mask(vec_type a, vec_type b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_GT_OQ)); }
+#elif defined(HAVE_SSE42)
+constexpr int vlen = 4;
+typedef __m128 vec_type;
+
+inline vec_type vec_load(const float* src) { return _mm_loadu_ps(src); }
+inline vec_type vec_set1(float value) { return _mm_set1_ps(value); }
+inline vec_type vec_min(vec_type a, vec_type b) { return _mm_min_ps(a, b); }
+inline vec_type vec_max(vec_type a, vec_type b) { return _mm_max_ps(a, b); }
+inline vec_type vec_add(vec_type a, vec_type b) { return _mm_add_ps(a, b); }
+inline vec_type vec_sub(vec_type a, vec_type b) { return _mm_sub_ps(a, b); }
+inline vec_type vec_mul(vec_type a, vec_type b) { return _mm_mul_ps(a, b); }
+inline vec_type vec_div(vec_type a, vec_type b) { return _mm_div_ps(a, b); }
+inline unsigned vec_gt_mask(vec_type a, vec_type b) { return _mm_movemask_ps(_mm_cmpgt_ps(a, b)); }
+#endif
+
+inline float clip(float value) {
+    return (std::max)(0.0f, (std::min)(1.0f, value));
+}
+
+void decode_prior(const float* prior, const float* loc, const float* variance,
+                  const detection_output_decode_conf& conf, float* bbox, float* bbox_size) {
+    float prior_xmin = prior[0];
+    float prior_ymin = prior[1];
+    float prior_xmax = prior[2];
+    float prior_ymax = prior[3];
+
+    if (!conf.normalized) {
+        prior_xmin /= conf.image_width;
+        prior_ymin /= conf.image_height;
+        prior_xmax /= conf.image_width;
+        prior_ymax /= conf.image_height;
+    }
+
+    float new_xmin, new_ymin, new_xmax, new_ymax;
+    if (!conf.center_size) {
+        if (conf.variance_encoded_in_target) {
+            new_xmin = prior_xmin + loc[0];
+            new_ymin = prior_ymin + loc[1];
+            new_xmax = prior_xmax + loc[2];
+            new_ymax = prior_ymax + loc[3];
+        } else {
+            new_xmin = prior_xmin + variance[0] * loc[0];
+            new_ymin = prior_ymin + variance[1] * loc[1];
+            new_xmax = prior_xmax + variance[2] * loc[2];
+            new_ymax = prior_ymax + variance[3] * loc[3];
+        }
+    } else {
+        float prior_width    =  prior_xmax - prior_xmin;
+        float prior_height   =  prior_ymax - prior_ymin;
+        float prior_center_x = (prior_xmin + prior_xmax) / 2.0f;
+        float prior_center_y = (prior_ymin + prior_ymax) / 2.0f;
+
+        float center_x, center_y, width, height;
+        if (conf.variance_encoded_in_target) {
+            center_x = loc[0] * prior_width  + prior_center_x;
+            center_y = loc[1] * prior_height + prior_center_y;
+            width  = std::exp(loc[2]) * prior_width;
+            height = std::exp(loc[3]) * prior_height;
+        } else {
+            center_x = variance[0] * loc[0] * prior_width + prior_center_x;
+            center_y = variance[1] * loc[1] * prior_height + prior_center_y;
+            width  = std::exp(variance[2] * loc[2]) * prior_width;
+            height = std::exp(variance[3] * loc[3]) * prior_height;
+        }
+
+        new_xmin = center_x - width  / 2.0f;
+        new_ymin = center_y - height / 2.0f;
+        new_xmax = center_x + width  / 2.0f;
+        new_ymax = center_y + height / 2.0f;
+    }
+
+    if (conf.clip) {
+        new_xmin = clip(new_xmin);
+        new_ymin = clip(new_ymin);
+        new_xmax = clip(new_xmax);
+        new_ymax = clip(new_ymax);
+    }
+
+    bbox[0] = new_xmin;
+    bbox[1] = new_ymin;
+    bbox[2] = new_xmax;
+    bbox[3] = new_ymax;
+    *bbox_size = (new_xmax - new_xmin) * (new_ymax - new_ymin);
+}
+
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+/**
+ * Decodes 4 priors at once: the boxes are transposed into vectors of the same coordinate of every prior,
+ * so the arithmetic follows the scalar code operation by operation.
+ */
+void decode_4_priors(const float* priors, const float* loc, const float* variances,
+                     const detection_output_decode_conf& conf, float* bboxes, float* bbox_sizes) {
+    __m128 xmin = _mm_loadu_ps(priors);
+    __m128 ymin = _mm_loadu_ps(priors + conf.prior_size);
+    __m128 xmax = _mm_loadu_ps(priors + 2 * conf.prior_size);
+    __m128 ymax = _mm_loadu_ps(priors + 3 * conf.prior_size);
+    _MM_TRANSPOSE4_PS(xmin, ymin, xmax, ymax);
+
+    if (!conf.normalized) {
+        const __m128 width = _mm_set1_ps(conf.image_width);
+        const __m128 height = _mm_set1_ps(conf.image_height);
+        xmin = _mm_div_ps(xmin, width);
+        ymin = _mm_div_ps(ymin, height);
+        xmax = _mm_div_ps(xmax, width);
+        ymax = _mm_div_ps(ymax, height);
+    }
+
+    __m128 loc0 = _mm_loadu_ps(loc);
+    __m128 loc1 = _mm_loadu_ps(loc + conf.loc_stride);
+    __m128 loc2 = _mm_loadu_ps(loc + 2 * conf.loc_stride);
+    __m128 loc3 = _mm_loadu_ps(loc + 3 * conf.loc_stride);
+    _MM_TRANSPOSE4_PS(loc0, loc1, loc2, loc3);
+
+    if (!conf.variance_encoded_in_target) {
+        __m128 var0 = _mm_loadu_ps(variances);
+        __m128 var1 = _mm_loadu_ps(variances + 4);
+        __m128 var2 = _mm_loadu_ps(variances + 8);
+        __m128 var3 = _mm_loadu_ps(variances + 12);
+        _MM_TRANSPOSE4_PS(var0, var1, var2, var3);
+
+        loc0 = _mm_mul_ps(var0, loc0);
+        loc1 = _mm_mul_ps(var1, loc1);
+        loc2 = _mm_mul_ps(var2, loc2);
+        loc3 = _mm_mul_ps(var3, loc3);
+    }
+
+    if (!conf.center_size) {
+        xmin = _mm_add_ps(xmin, loc0);
+        ymin = _mm_add_ps(ymin, loc1);
+        xmax = _mm_add_ps(xmax, loc2);
+        ymax = _mm_add_ps(ymax, loc3);
+    } else {
+        const __m128 half = _mm_set1_ps(0.5f);
+        const __m128 prior_width = _mm_sub_ps(xmax, xmin);
+        const __m128 prior_height = _mm_sub_ps(ymax, ymin);
+        const __m128 center_x = _mm_add_ps(_mm_mul_ps(loc0, prior_width),
+                                           _mm_mul_ps(_mm_add_ps(xmin, xmax), half));
+        const __m128 center_y = _mm_add_ps(_mm_mul_ps(loc1, prior_height),
+                                           _mm_mul_ps(_mm_add_ps(ymin, ymax), half));
+
+        float scale[8];
+        _mm_storeu_ps(scale, loc2);
+        _mm_storeu_ps(scale + 4, loc3);
+        for (int i = 0; i < 8; i++)
+            scale[i] = std::exp(scale[i]);
+        const __m128 half_width = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(scale), prior_width), half);
+        const __m128 half_height = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(scale + 4), prior_height), half);
+
+        xmin = _mm_sub_ps(center_x, half_width);
+        ymin = _mm_sub_ps(center_y, half_height);
+        xmax = _mm_add_ps(center_x, half_width);
+        ymax = _mm_add_ps(center_y, half_height);
+    }
+
+    if (conf.clip) {
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.0f);
+        xmin = _mm_max_ps(zero, _mm_min_ps(one, xmin));
+        ymin = _mm_max_ps(zero, _mm_min_ps(one, ymin));
+        xmax = _mm_max_ps(zero, _mm_min_ps(one, xmax));
+        ymax = _mm_max_ps(zero, _mm_min_ps(one, ymax));
+    }
+
+    _mm_storeu_ps(bbox_sizes, _mm_mul_ps(_mm_sub_ps(xmax, xmin), _mm_sub_ps(ymax, ymin)));
+
+    _MM_TRANSPOSE4_PS(xmin, ymin, xmax, ymax);
+    _mm_storeu_ps(bboxes, xmin);
+    _mm_storeu_ps(bboxes + 4, ymin);
+    _mm_storeu_ps(bboxes + 8, xmax);
+    _mm_storeu_ps(bboxes + 12, ymax);
+}
+#endif
+
+void decode(const float* priors, const float* loc, const float* variances,
+            const detection_output_decode_conf& conf, int begin, int end,
+            float* decoded_bboxes, float* decoded_bbox_sizes) {
+    priors += conf.prior_offset;
+    int p = begin;
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    for (; p + 4 <= end; p += 4) {
+        decode_4_priors(priors + p * conf.prior_size, loc + p * conf.loc_stride, variances + p * 4, conf,
+                        decoded_bboxes + p * 4, decoded_bbox_sizes + p);
+    }
+#endif
+    for (; p < end; p++) {
+        decode_prior(priors + p * conf.prior_size, loc + p * conf.loc_stride, variances + p * 4, conf,
+                     decoded_bboxes + p * 4, decoded_bbox_sizes + p);
+    }
+}
+
+bool overlaps(const float* box, float box_size, const float* kept, int num, int stride, float threshold) {
+    const float* kept_xmin = kept;
+    const float* kept_ymin = kept + stride;
+    const float* kept_xmax = kept + 2 * stride;
+    const float* kept_ymax = kept + 3 * stride;
+    const float* kept_sizes = kept + 4 * stride;
+
+    int k = 0;
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    const vec_type xmin = vec_set1(box[0]);
+    const vec_type ymin = vec_set1(box[1]);
+    const vec_type xmax = vec_set1(box[2]);
+    const vec_type ymax = vec_set1(box[3]);
+    const vec_type size = vec_set1(box_size);
+    const vec_type thr = vec_set1(threshold);
+    const vec_type zero = vec_set1(0.0f);
+    for (; k + vlen <= num; k += vlen) {
+        const vec_type width = vec_sub(vec_min(xmax, vec_load(kept_xmax + k)), vec_max(xmin, vec_load(kept_xmin + k)));
+        const vec_type height = vec_sub(vec_min(ymax, vec_load(kept_ymax + k)), vec_max(ymin, vec_load(kept_ymin + k)));
+        const vec_type intersection = vec_mul(width, height);
+        const vec_type iou = vec_div(intersection, vec_sub(vec_add(size, vec_load(kept_sizes + k)), intersection));
+        if (vec_gt_mask(width, zero) & vec_gt_mask(height, zero) & vec_gt_mask(iou, thr))
+            return true;
+    }
+#endif
+    for (; k < num; k++) {
+        const float width = (std::min)(box[2], kept_xmax[k]) - (std::max)(box[0], kept_xmin[k]);
+        const float height = (std::min)(box[3], kept_ymax[k]) - (std::max)(box[1], kept_ymin[k]);
+        if (width <= 0 || height <= 0)
+            continue;
+        const float intersection = width * height;
+        if (intersection / (box_size + kept_sizes[k] - intersection) > threshold)
+            return true;
+    }
+    return false;
+}
+
+}  // namespace
+
+detection_output_kernels detection_output_get_kernels() {
+    return {decode, overlaps};
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,50 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+struct detection_output_decode_conf {
+    int prior_size;        // 4 for normalized priors, 5 if every prior starts with a batch index
+    int prior_offset;      // position of xmin in a prior
+    int loc_stride;        // distance between location predictions of neighbouring priors
+    bool normalized;       // prior coordinates are divided by the image size if not set
+    float image_width;
+    float image_height;
+    bool center_size;      // CENTER_SIZE code type, CORNER otherwise
+    bool variance_encoded_in_target;
+    bool clip;             // clip decoded boxes to [0, 1]
+};
+
+struct detection_output_kernels {
+    /**
+     * Decodes boxes of priors [begin, end) into decoded_bboxes (xmin, ymin, xmax, ymax of every prior)
+     * and their areas into decoded_bbox_sizes. Variances are not read if they are encoded in target.
+     */
+    void (*decode)(const float* priors, const float* loc, const float* variances,
+                   const detection_output_decode_conf& conf, int begin, int end,
+                   float* decoded_bboxes, float* decoded_bbox_sizes);
+    /**
+     * Returns true if the intersection over union of the box with any of num kept boxes exceeds threshold.
+     * Kept boxes are stored by components: num values of xmin, then of ymin, xmax, ymax and areas,
+     * every component starts stride values after the previous one.
+     */
+    bool (*overlaps)(const float* box, float box_size, const float* kept, int num, int stride, float threshold);
+};
+
+namespace XARCH {
+
+/**
+ * Returns DetectionOutput kernels vectorized for the target instruction set
+ */
+detection_output_kernels detection_output_get_kernels();
+
+}  // namespace XARCH
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
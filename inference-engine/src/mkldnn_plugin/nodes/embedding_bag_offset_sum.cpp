@@ -5,6 +5,8 @@
 #include "embedding_bag_sum.hpp"
 #include "ie_parallel.hpp"
 
+#include <algorithm>
+#include <string>
 #include <vector>
 
 
@@ -36,10 +38,10 @@ public:
                 std::vector<Blob::Ptr>& inputs,
                 std::vector<Blob::Ptr>& outputs,
                 ResponseDesc* resp) noexcept override {
+        if (useRowKernel(inputs[0]))
+            return processData<PrecisionTrait<Precision::FP32>::value_type>(inputs, outputs, resp);
+
         switch (inputs[0]->getTensorDesc().getPrecision()) {
-            case Precision::FP32: {
-                return processData<PrecisionTrait<Precision::FP32>::value_type>(inputs, outputs, resp);
-            }
             case Precision::I8: {
                 return processData<PrecisionTrait<Precision::I8>::value_type>(inputs, outputs, resp);
             }
@@ -95,6 +97,8 @@ protected:
         std::string errorMsg;
         std::string msgPrefix = std::string("Layer EmbeddingBagOffsetsSum with name '") + _layerName + "' ";
 
+        const bool rowKernel = useRowKernel(inputs[0]);
+        const uint8_t* table = inputs[0]->cbuffer().as<const uint8_t*>();
         const T* srcData = inputs[0]->cbuffer().as<const T*>() +
             inputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
         T* dstData = outputs[0]->buffer().as<T*>() +
@@ -158,9 +162,21 @@ protected:
                 weightsIdx = offsetsData[embIndex];
         };
 
+        // Bags may have very different sizes, so they are distributed between threads by the number of rows
+        std::vector<size_t> workPrefix(OUTPUT_BAGS_NUM + 1lu, 0lu);
+        for (size_t obi = 0lu; obi < OUTPUT_BAGS_NUM; obi++) {
+            size_t bagSize = 0lu;
+            if (obi < _offsetsLen) {
+                const size_t bagEnd = obi == _offsetsLen - 1lu ? _indicesLen : static_cast<size_t>(offsetsData[obi + 1lu]);
+                const size_t bagStart = static_cast<size_t>(offsetsData[obi]);
+                bagSize = bagEnd > bagStart ? std::min(bagEnd - bagStart, _indicesLen) : 0lu;
+            }
+            workPrefix[obi + 1lu] = workPrefix[obi] + bagSize + 1lu;
+        }
+
         auto threadBody = [&](const int ithr, const int nthr) {
             size_t start(0lu), end(0lu);
-            splitter(OUTPUT_BAGS_NUM, nthr, ithr, start, end);
+            splitByWork(workPrefix, nthr, ithr, start, end);
             if (start >= end)
                 return;
 
@@ -172,7 +188,18 @@ protected:
             for (size_t obi = start; obi < end; obi++) {
                 size_t dstIndex = obi * _embDepth;
                 get_idx(obi, indices, indicesSize, weightsIdx, withWeights);
-                if (indices != nullptr) {
+                if (indices != nullptr && rowKernel) {
+                    withWeights = withWeights & _withWeights;
+                    // T is float on this path
+                    const float* bagWeights = withWeights ?
+                        reinterpret_cast<const float*>(weightsData) + weightsIdx : nullptr;
+                    size_t invalidIndex = 0lu;
+                    if (!accumulateBag(table, inDataDims[0], indices, indicesSize, bagWeights,
+                                       reinterpret_cast<float*>(dstData) + dstIndex, invalidIndex)) {
+                        errorMsg = msgPrefix + "has invalid embedding bag index: " + std::to_string(invalidIndex);
+                        return;
+                    }
+                } else if (indices != nullptr) {
                     withWeights = withWeights & _withWeights;
 
                     size_t inIdx = 0lu;
@@ -6,7 +6,13 @@
 #include "ie_parallel.hpp"
 #include "jit_generator.hpp"
 #include "list.hpp"
+#include "ngraph/type/float16.hpp"
+#include "precision_utils.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
 #include <set>
 #include <string>
 #include <vector>
@@ -14,6 +20,7 @@
 using namespace InferenceEngine;
 using namespace InferenceEngine::Extensions::Cpu;
 
+constexpr size_t MKLDNNEmbeddingBagSum::PREFETCH_DISTANCE;
 
 const std::set<size_t> MKLDNNEmbeddingBagSum::_supportedIndicesTypeSize = {sizeof(INT32), sizeof(INT64)};
 
@@ -41,7 +48,13 @@ MKLDNNEmbeddingBagSum::MKLDNNEmbeddingBagSum(
         auto dataPrecision = inData->getTensorDesc().getPrecision();
         if (dataPrecision == Precision::BF16)
             dataPrecision = Precision::FP32;
-        if (!supportedPrecisions.empty()) {
+        // The table may be packed at network loading time, rows are stored as raw bytes then
+        _tableFormat = tableFormatFromString(layer->GetParamAsString("table_precision", "FP32"));
+        if (_tableFormat != emb_table_format::FP32) {
+            if (dataPrecision != Precision::U8 || inData->getTensorDesc().getDims().size() != 2)
+                THROW_IE_EXCEPTION << logPrefix << "has packed embedding table with unexpected layout.";
+            dataPrecision = Precision::FP32;
+        } else if (!supportedPrecisions.empty()) {
             if (supportedPrecisions.find(dataPrecision) == supportedPrecisions.end())
                 THROW_IE_EXCEPTION << logPrefix << "has unsupported precision: " << dataPrecision.name();
         } else {
@@ -85,11 +98,14 @@ MKLDNNEmbeddingBagSum::MKLDNNEmbeddingBagSum(
 
         confs.push_back(config);
 
-        const auto& inDataDims = inData->getTensorDesc().getDims();
         _embDepth = 1lu;
-        for (size_t i = 1lu; i < inDataDims.size(); i++) {
-            _embDepth *= inDataDims[i];
+        for (size_t i = 1lu; i < outDims.size(); i++) {
+            _embDepth *= outDims[i];
         }
+        _tableRowSize = getTableRowSize(_tableFormat, _embDepth);
+        if (_tableFormat != emb_table_format::FP32 && inData->getTensorDesc().getDims()[1] != _tableRowSize)
+            THROW_IE_EXCEPTION << logPrefix << "has packed embedding table with unexpected row size.";
+        _rowKernel = XARCH::emb_get_row_kernel(_tableFormat);
     } catch (InferenceEngine::details::InferenceEngineException &ex) {
         errorMsg = ex.what();
     }
@@ -99,22 +115,18 @@ StatusCode MKLDNNEmbeddingBagSum::execute(
             std::vector<Blob::Ptr>& inputs,
             std::vector<Blob::Ptr>& outputs,
             ResponseDesc *resp) noexcept {
+    if (useRowKernel(inputs[0]))
+        return processRows(inputs, outputs, resp);
+
     switch (inputs[0]->getTensorDesc().getPrecision()) {
-        case Precision::FP32: {
-            processData<PrecisionTrait<Precision::FP32>::value_type>(inputs, outputs);
-            break;
-        }
         case Precision::I8: {
-            processData<PrecisionTrait<Precision::I8>::value_type>(inputs, outputs);
-            break;
+            return processData<PrecisionTrait<Precision::I8>::value_type>(inputs, outputs, resp);
         }
         case Precision::U8: {
-            processData<PrecisionTrait<Precision::U8>::value_type>(inputs, outputs);
-            break;
+            return processData<PrecisionTrait<Precision::U8>::value_type>(inputs, outputs, resp);
         }
         case Precision::I32: {
-            processData<PrecisionTrait<Precision::I32>::value_type>(inputs, outputs);
-            break;
+            return processData<PrecisionTrait<Precision::I32>::value_type>(inputs, outputs, resp);
         }
         default: {
             if (resp) {
@@ -125,27 +137,38 @@ StatusCode MKLDNNEmbeddingBagSum::execute(
             return GENERAL_ERROR;
         }
     }
+}
 
-    return OK;
+StatusCode MKLDNNEmbeddingBagSum::invalidIndexError(size_t invalidIndex, ResponseDesc *resp) const noexcept {
+    if (resp) {
+        std::string errorMsg = "EmbeddingBagSum layer '" + _layerName
+                + "' has invalid embedding bag index: " + std::to_string(invalidIndex);
+        errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
+    }
+    return GENERAL_ERROR;
 }
 
 template<typename T>
-void MKLDNNEmbeddingBagSum::processData(
+StatusCode MKLDNNEmbeddingBagSum::processData(
             std::vector<Blob::Ptr>& inputs,
-            std::vector<Blob::Ptr>& outputs) noexcept {
+            std::vector<Blob::Ptr>& outputs,
+            ResponseDesc *resp) noexcept {
     const T* srcData = inputs[0]->cbuffer().as<const T*>() +
         inputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
     T* dstData = outputs[0]->buffer().as<T*>() +
         outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
     const T* weightsData = nullptr;
     if (_withWeights)
-        weightsData = inputs[PER_SAMPLE_WEIGHTS_IDX]->cbuffer().as<const T*>();
+        weightsData = inputs[PER_SAMPLE_WEIGHTS_IDX]->cbuffer().as<const T*>() +
+            inputs[PER_SAMPLE_WEIGHTS_IDX]->getTensorDesc().getBlockingDesc().getOffsetPadding();
     initFromInputs(inputs);
 
     const auto& inDataDims = inputs[0]->getTensorDesc().getDims();
 
     const size_t outputBagsNum = outputs[0]->getTensorDesc().getDims()[0];
 
+    std::atomic<bool> failed(false);
+    std::atomic<size_t> invalidIndex(0lu);
     auto threadBody = [&](const int ithr, const int nthr) {
         size_t start(0lu), end(0lu);
         splitter(outputBagsNum, nthr, ithr, start, end);
@@ -165,9 +188,11 @@ void MKLDNNEmbeddingBagSum::processData(
                 withWeights = withWeights & _withWeights;
 
                 size_t inIdx = 0lu;
-                if (indices[inIdx] >= inDataDims[0])
-                    THROW_IE_EXCEPTION << "EmbeddingBagSum layer '" << _layerName
-                        << "' has invalid embedding bag index: " << indices[inIdx];
+                if (indices[inIdx] >= inDataDims[0]) {
+                    invalidIndex = indices[inIdx];
+                    failed = true;
+                    return;
+                }
                 size_t srcIndex = indices[inIdx] * _embDepth;
 
                 if (withWeights) {
@@ -182,9 +207,11 @@ void MKLDNNEmbeddingBagSum::processData(
                 }
 
                 for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
-                    if (indices[inIdx] >= inDataDims[0])
-                        THROW_IE_EXCEPTION << "EmbeddingBagSum layer '" << _layerName
-                            << "' has invalid embedding bag index: " << indices[inIdx];
+                    if (indices[inIdx] >= inDataDims[0]) {
+                        invalidIndex = indices[inIdx];
+                        failed = true;
+                        return;
+                    }
                     size_t srcIndex = indices[inIdx] * _embDepth;
 
                     if (withWeights) {
@@ -207,4 +234,158 @@ void MKLDNNEmbeddingBagSum::processData(
     };
 
     parallel_nt(0, threadBody);
+
+    return failed ? invalidIndexError(invalidIndex, resp) : OK;
+}
+
+StatusCode MKLDNNEmbeddingBagSum::processRows(
+            std::vector<Blob::Ptr>& inputs,
+            std::vector<Blob::Ptr>& outputs,
+            ResponseDesc *resp) noexcept {
+    const auto& tableDesc = inputs[0]->getTensorDesc();
+    const uint8_t* table = inputs[0]->cbuffer().as<const uint8_t*>() +
+        tableDesc.getBlockingDesc().getOffsetPadding() * tableDesc.getPrecision().size();
+    float* dstData = outputs[0]->buffer().as<float*>() +
+        outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+    const float* weightsData = nullptr;
+    if (_withWeights)
+        weightsData = inputs[PER_SAMPLE_WEIGHTS_IDX]->cbuffer().as<const float*>() +
+            inputs[PER_SAMPLE_WEIGHTS_IDX]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+    initFromInputs(inputs);
+
+    const size_t tableRows = tableDesc.getDims()[0];
+    const size_t outputBagsNum = outputs[0]->getTensorDesc().getDims()[0];
+
+    // Bags may have very different sizes, so they are distributed between threads by the number of rows
+    std::vector<size_t> workPrefix(outputBagsNum + 1lu, 0lu);
+    for (size_t obi = 0lu; obi < outputBagsNum; obi++) {
+        size_t indicesSize = 0lu;
+        const size_t* indices = nullptr;
+        size_t weightsIdx = 0lu;
+        bool withWeights = _withWeights;
+        getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+        workPrefix[obi + 1lu] = workPrefix[obi] + (indices != nullptr ? indicesSize : 0lu) + 1lu;
+    }
+
+    std::atomic<bool> failed(false);
+    std::atomic<size_t> invalidIndex(0lu);
+    auto threadBody = [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitByWork(workPrefix, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        size_t indicesSize = 0lu;
+        const size_t* indices = nullptr;
+        size_t weightsIdx = 0lu;
+        bool withWeights = _withWeights;
+
+        for (size_t obi = start; obi < end; obi++) {
+            float* dst = dstData + obi * _embDepth;
+            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+
+            if (indices != nullptr) {
+                withWeights = withWeights & _withWeights;
+                size_t bagInvalidIndex = 0lu;
+                if (!accumulateBag(table, tableRows, indices, indicesSize,
+                                   withWeights ? weightsData + weightsIdx : nullptr, dst, bagInvalidIndex)) {
+                    invalidIndex = bagInvalidIndex;
+                    failed = true;
+                    return;
+                }
+            } else {
+                std::fill(dst, dst + _embDepth, 0.f);
+            }
+        }
+    };
+
+    parallel_nt(0, threadBody);
+
+    return failed ? invalidIndexError(invalidIndex, resp) : OK;
+}
+
+void MKLDNNEmbeddingBagSum::splitByWork(const std::vector<size_t>& workPrefix, int nthr, int ithr,
+                                        size_t& start, size_t& end) {
+    const size_t bagsNum = workPrefix.size() - 1lu;
+    if (nthr <= 1) {
+        start = 0lu;
+        end = bagsNum;
+        return;
+    }
+    const size_t totalWork = workPrefix.back();
+    const size_t workStart = totalWork * ithr / nthr;
+    const size_t workEnd = totalWork * (ithr + 1) / nthr;
+    // A bag belongs to the thread which work range contains the beginning of the bag
+    start = std::lower_bound(workPrefix.begin(), workPrefix.end() - 1, workStart) - workPrefix.begin();
+    end = ithr == nthr - 1 ? bagsNum :
+          std::lower_bound(workPrefix.begin(), workPrefix.end() - 1, workEnd) - workPrefix.begin();
+}
+
+size_t MKLDNNEmbeddingBagSum::getTableRowSize(emb_table_format format, size_t depth) {
+    switch (format) {
+        case emb_table_format::FP16:
+        case emb_table_format::BF16:
+            return depth * sizeof(uint16_t);
+        case emb_table_format::U8:
+            return 2lu * sizeof(float) + depth * sizeof(uint8_t);
+        default:
+            return depth * sizeof(float);
+    }
+}
+
+emb_table_format MKLDNNEmbeddingBagSum::tableFormatFromString(const std::string& name) {
+    if (name == "FP32")
+        return emb_table_format::FP32;
+    if (name == "FP16")
+        return emb_table_format::FP16;
+    if (name == "BF16")
+        return emb_table_format::BF16;
+    if (name == "U8")
+        return emb_table_format::U8;
+    THROW_IE_EXCEPTION << "Unsupported embedding table precision: " << name;
+}
+
+void MKLDNNEmbeddingBagSum::packTable(const float* src, size_t rows, size_t depth,
+                                      emb_table_format format, uint8_t* dst) {
+    const size_t rowSize = getTableRowSize(format, depth);
+    parallel_for(rows, [&](size_t r) {
+        const float* srcRow = src + r * depth;
+        uint8_t* dstRow = dst + r * rowSize;
+        switch (format) {
+            case emb_table_format::FP16: {
+                uint16_t* dstValues = reinterpret_cast<uint16_t*>(dstRow);
+                for (size_t i = 0lu; i < depth; i++)
+                    dstValues[i] = ngraph::float16(srcRow[i]).to_bits();
+                break;
+            }
+            case emb_table_format::BF16: {
+                PrecisionUtils::f32tobf16Arrays(reinterpret_cast<ie_bf16*>(dstRow), srcRow, depth);
+                break;
+            }
+            case emb_table_format::U8: {
+                // Asymmetric row-wise quantization: value = q * scale + bias, q in [0, 255]
+                float minVal = std::numeric_limits<float>::max();
+                float maxVal = std::numeric_limits<float>::lowest();
+                for (size_t i = 0lu; i < depth; i++) {
+                    minVal = std::min(minVal, srcRow[i]);
+                    maxVal = std::max(maxVal, srcRow[i]);
+                }
+                if (depth == 0lu)
+                    minVal = maxVal = 0.f;
+                const float scale = (maxVal - minVal) / 255.f;
+                const float invScale = scale > 0.f ? 1.f / scale : 0.f;
+                const float header[2] = {scale, minVal};
+                std::memcpy(dstRow, header, sizeof(header));
+                uint8_t* dstValues = dstRow + sizeof(header);
+                for (size_t i = 0lu; i < depth; i++) {
+                    const float q = (srcRow[i] - minVal) * invScale + 0.5f;
+                    dstValues[i] = static_cast<uint8_t>(std::min(255.f, std::max(0.f, q)));
+                }
+                break;
+            }
+            default:
+                std::memcpy(dstRow, srcRow, rowSize);
+                break;
+        }
+    });
 }
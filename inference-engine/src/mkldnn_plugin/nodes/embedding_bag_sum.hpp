@@ -5,9 +5,11 @@
 #pragma once
 
 #include "base.hpp"
+#include "embedding_bag_sum_imp.hpp"
 
 #include <memory>
 #include <set>
+#include <string>
 #include <vector>
 
 namespace InferenceEngine {
@@ -29,6 +31,18 @@ public:
         std::vector<Blob::Ptr>& outputs,
         ResponseDesc *resp) noexcept override;
 
+    /**
+     * Returns the size in bytes of one table row with depth elements stored in the given format.
+     */
+    static size_t getTableRowSize(emb_table_format format, size_t depth);
+
+    /**
+     * Packs FP32 table rows into the given format. dst must hold rows * getTableRowSize(format, depth) bytes.
+     */
+    static void packTable(const float* src, size_t rows, size_t depth, emb_table_format format, uint8_t* dst);
+
+    static emb_table_format tableFormatFromString(const std::string& name);
+
 protected:
     virtual void initFromInputs(std::vector<Blob::Ptr>& inputs) = 0;
     virtual void getIndices(
@@ -39,7 +53,49 @@ protected:
         bool& withWeights) = 0;
 
     template<typename T>
-    void processData(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs) noexcept;
+    StatusCode processData(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept;
+
+    // FP32 or compressed table path: vectorized row accumulation with bags split by the amount of work
+    StatusCode processRows(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept;
+
+    // Reports an index out of the table found by one of the threads, exceptions must not leave parallel regions
+    StatusCode invalidIndexError(size_t invalidIndex, ResponseDesc *resp) const noexcept;
+
+    bool useRowKernel(const Blob::Ptr& table) const {
+        return _tableFormat != emb_table_format::FP32 || table->getTensorDesc().getPrecision() == Precision::FP32;
+    }
+
+    /**
+     * Splits bags between threads so that every thread gets approximately the same number of rows to accumulate.
+     * workPrefix[i] holds the total amount of work of bags [0, i).
+     */
+    static void splitByWork(const std::vector<size_t>& workPrefix, int nthr, int ithr, size_t& start, size_t& end);
+
+    /**
+     * Writes the weighted sum of the table rows referenced by indices into dst. Rows of the upcoming
+     * indices are prefetched. Returns false if some index is out of the table, invalidIndex holds it then.
+     */
+    template<typename I>
+    bool accumulateBag(const uint8_t* table, size_t tableRows, const I* indices, size_t indicesNum,
+                       const float* weights, float* dst, size_t& invalidIndex) const noexcept {
+        std::fill(dst, dst + _embDepth, 0.f);
+        for (size_t k = 0lu; k < indicesNum; k++) {
+            const size_t idx = static_cast<size_t>(indices[k]);
+            if (idx >= tableRows) {
+                invalidIndex = idx;
+                return false;
+            }
+            const uint8_t* prefetchRow = nullptr;
+            if (k + PREFETCH_DISTANCE < indicesNum) {
+                const size_t prefetchIdx = static_cast<size_t>(indices[k + PREFETCH_DISTANCE]);
+                if (prefetchIdx < tableRows)
+                    prefetchRow = table + prefetchIdx * _tableRowSize;
+            }
+            _rowKernel(table + idx * _tableRowSize, prefetchRow, weights ? weights[k] : 1.f,
+                       dst, _embDepth, _tableRowSize);
+        }
+        return true;
+    }
 
     std::set<Precision> _supportedPrecisions;
 
@@ -51,6 +107,12 @@ protected:
     size_t _embDepth = 0;
     std::string _layerName;
 
+    emb_table_format _tableFormat = emb_table_format::FP32;
+    size_t _tableRowSize = 0;
+    emb_row_accumulate_t _rowKernel = nullptr;
+
+    static constexpr size_t PREFETCH_DISTANCE = 4lu;
+
     using INT32 = PrecisionTrait<Precision::I32>::value_type;
     using INT64 = PrecisionTrait<Precision::I64>::value_type;
     using UINT64 = PrecisionTrait<Precision::U64>::value_type;
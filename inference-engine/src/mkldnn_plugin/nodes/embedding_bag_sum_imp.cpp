@@ -0,0 +1,214 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "embedding_bag_sum_imp.hpp"
+
+#include <cstring>
+#include "common/fp16_utils.h"
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+namespace {
+
+constexpr size_t cache_line_size = 64;
+
+#if defined(HAVE_AVX512F)
+constexpr size_t vlen = 16;
+typedef __m512 vec_type;
+
+inline vec_type vec_load_f32(const float* src) { return _mm512_loadu_ps(src); }
+inline vec_type vec_load_f16(const uint16_t* src) {
+    return _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)));
+}
+inline vec_type vec_load_bf16(const uint16_t* src) {
+    __m512i v = _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)));
+    return _mm512_castsi512_ps(_mm512_slli_epi32(v, 16));
+}
+inline vec_type vec_load_u8(const uint8_t* src) {
+    return _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src))));
+}
+inline vec_type vec_set1(float value) { return _mm512_set1_ps(value); }
+inline vec_type vec_add(vec_type a, vec_type b) { return _mm512_add_ps(a, b); }
+inline vec_type vec_fmadd(vec_type a, vec_type b, vec_type c) { return _mm512_fmadd_ps(a, b, c); }
+inline void vec_store(float* dst, vec_type v) { _mm512_storeu_ps(dst, v); }
+#elif defined(HAVE_AVX2)
+constexpr size_t vlen = 8;
+typedef __m256 vec_type;
+
+inline vec_type vec_load_f32(const float* src) { return _mm256_loadu_ps(src); }
+#if defined(__F16C__) || defined(_MSC_VER)
+#define EMB_HAVE_VEC_F16
+inline vec_type vec_load_f16(const uint16_t* src) {
+    return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+}
+#endif
+inline vec_type vec_load_bf16(const uint16_t* src) {
+    __m256i v = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+    return _mm256_castsi256_ps(_mm256_slli_epi32(v, 16));
+}
+inline vec_type vec_load_u8(const uint8_t* src) {
+    return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src))));
+}
+inline vec_type vec_set1(float value) { return _mm256_set1_ps(value); }
+inline vec_type vec_add(vec_type a, vec_type b) { return _mm256_add_ps(a, b); }
+inline vec_type vec_fmadd(vec_type a, vec_type b, vec_type c) { return _mm256_fmadd_ps(a, b, c); }
+inline void vec_store(float* dst, vec_type v) { _mm256_storeu_ps(dst, v); }
+#elif defined(HAVE_SSE42)
+constexpr size_t vlen = 4;
+typedef __m128 vec_type;
+
+inline vec_type vec_load_f32(const float* src) { return _mm_loadu_ps(src); }
+inline vec_type vec_load_bf16(const uint16_t* src) {
+    __m128i v = _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)));
+    return _mm_castsi128_ps(_mm_slli_epi32(v, 16));
+}
+inline vec_type vec_load_u8(const uint8_t* src) {
+    int32_t packed;
+    std::memcpy(&packed, src, sizeof(packed));
+    return _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(packed)));
+}
+inline vec_type vec_set1(float value) { return _mm_set1_ps(value); }
+inline vec_type vec_add(vec_type a, vec_type b) { return _mm_add_ps(a, b); }
+inline vec_type vec_fmadd(vec_type a, vec_type b, vec_type c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+inline void vec_store(float* dst, vec_type v) { _mm_storeu_ps(dst, v); }
+#endif
+
+inline float bf16_to_f32(uint16_t value) {
+    uint32_t bits = static_cast<uint32_t>(value) << 16;
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+template <emb_table_format format>
+struct emb_row;
+
+template <>
+struct emb_row<emb_table_format::FP32> {
+    static constexpr size_t header_size = 0;
+    static inline float get(const uint8_t* values, size_t i) {
+        return reinterpret_cast<const float*>(values)[i];
+    }
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    static constexpr bool vectorized = true;
+    static inline vec_type load(const uint8_t* values, size_t i) {
+        return vec_load_f32(reinterpret_cast<const float*>(values) + i);
+    }
+#endif
+};
+
+template <>
+struct emb_row<emb_table_format::FP16> {
+    static constexpr size_t header_size = 0;
+    static inline float get(const uint8_t* values, size_t i) {
+        return f16tof32(reinterpret_cast<const ie_fp16*>(values)[i]);
+    }
+#if defined(HAVE_AVX512F) || defined(EMB_HAVE_VEC_F16)
+    static constexpr bool vectorized = true;
+    static inline vec_type load(const uint8_t* values, size_t i) {
+        return vec_load_f16(reinterpret_cast<const uint16_t*>(values) + i);
+    }
+#elif defined(HAVE_SSE42) || defined(HAVE_AVX2)
+    static constexpr bool vectorized = false;
+    static inline vec_type load(const uint8_t*, size_t) {
+        return vec_set1(0.f);
+    }
+#endif
+};
+
+template <>
+struct emb_row<emb_table_format::BF16> {
+    static constexpr size_t header_size = 0;
+    static inline float get(const uint8_t* values, size_t i) {
+        return bf16_to_f32(reinterpret_cast<const uint16_t*>(values)[i]);
+    }
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    static constexpr bool vectorized = true;
+    static inline vec_type load(const uint8_t* values, size_t i) {
+        return vec_load_bf16(reinterpret_cast<const uint16_t*>(values) + i);
+    }
+#endif
+};
+
+template <>
+struct emb_row<emb_table_format::U8> {
+    static constexpr size_t header_size = 2 * sizeof(float);
+    static inline float get(const uint8_t* values, size_t i) {
+        return static_cast<float>(values[i]);
+    }
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    static constexpr bool vectorized = true;
+    static inline vec_type load(const uint8_t* values, size_t i) {
+        return vec_load_u8(values + i);
+    }
+#endif
+};
+
+inline void prefetch_row(const uint8_t* row, size_t row_size) {
+    if (row == nullptr)
+        return;
+    for (size_t offset = 0; offset < row_size; offset += cache_line_size) {
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        _mm_prefetch(reinterpret_cast<const char*>(row + offset), _MM_HINT_T0);
+#elif defined(__GNUC__)
+        __builtin_prefetch(row + offset);
+#endif
+    }
+}
+
+template <emb_table_format format>
+void accumulate_row(const uint8_t* row, const uint8_t* prefetch, float weight,
+                    float* dst, size_t depth, size_t row_size) {
+    using row_type = emb_row<format>;
+    prefetch_row(prefetch, row_size);
+
+    // For U8 rows: weight * (q * scale + bias) == q * (weight * scale) + weight * bias
+    float scale = weight;
+    float shift = 0.f;
+    if (format == emb_table_format::U8) {
+        float header[2];
+        std::memcpy(header, row, sizeof(header));
+        scale = weight * header[0];
+        shift = weight * header[1];
+    }
+    const uint8_t* values = row + row_type::header_size;
+
+    size_t i = 0;
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    if (row_type::vectorized) {
+        const vec_type vscale = vec_set1(scale);
+        const vec_type vshift = vec_set1(shift);
+        for (; i + vlen <= depth; i += vlen) {
+            vec_type vdst = vec_fmadd(row_type::load(values, i), vscale, vec_load_f32(dst + i));
+            if (format == emb_table_format::U8)
+                vdst = vec_add(vdst, vshift);
+            vec_store(dst + i, vdst);
+        }
+    }
+#endif
+    for (; i < depth; i++)
+        dst[i] += row_type::get(values, i) * scale + shift;
+}
+
+}  // namespace
+
+emb_row_accumulate_t emb_get_row_kernel(emb_table_format format) {
+    switch (format) {
+        case emb_table_format::FP16: return accumulate_row<emb_table_format::FP16>;
+        case emb_table_format::BF16: return accumulate_row<emb_table_format::BF16>;
+        case emb_table_format::U8:   return accumulate_row<emb_table_format::U8>;
+        default:                     return accumulate_row<emb_table_format::FP32>;
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,42 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+/**
+ * Row storage formats of an embedding table:
+ *  - FP32: plain float row
+ *  - FP16/BF16: row of 16-bit floating point values
+ *  - U8: [float scale][float bias][uint8_t values...], value = q * scale + bias
+ */
+enum class emb_table_format {
+    FP32,
+    FP16,
+    BF16,
+    U8
+};
+
+/**
+ * Accumulates one table row multiplied by weight into dst (dst[i] += weight * row[i]).
+ * prefetch_row points to a row which will be accumulated soon and may be nullptr.
+ */
+typedef void (*emb_row_accumulate_t)(const uint8_t* row, const uint8_t* prefetch_row, float weight,
+                                     float* dst, size_t depth, size_t row_size);
+
+namespace XARCH {
+
+emb_row_accumulate_t emb_get_row_kernel(emb_table_format format);
+
+}  // namespace XARCH
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
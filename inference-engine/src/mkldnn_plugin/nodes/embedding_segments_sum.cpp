@@ -85,6 +85,18 @@ public:
                 _defaultIndices.push_back(*src);
             }
         }
+
+        // Segments are contiguous ranges of indices, so remember the first position and the size of every segment
+        _segmentStarts.assign(_numSegments, 0lu);
+        _segmentSizes.assign(_numSegments, 0lu);
+        for (size_t si = 0; si < _segmentIds.size(); si++) {
+            const size_t segmentId = _segmentIds[si];
+            if (segmentId >= _numSegments)
+                continue;
+            if (_segmentSizes[segmentId] == 0lu)
+                _segmentStarts[segmentId] = si;
+            _segmentSizes[segmentId]++;
+        }
     }
 
     void getIndices(size_t embIndex, const size_t*& indices, size_t& size, size_t& weightsIdx, bool& withWeight) override {
@@ -92,19 +104,9 @@ public:
             THROW_IE_EXCEPTION << "Invalid embedding bag index.";
 
         indices = nullptr;
-        size = 0lu;
+        size = _segmentSizes[embIndex];
         withWeight = true;
 
-        for (size_t si = 0; si < _indices.size(); si++) {
-            if (_segmentIds[si] == embIndex) {
-                size++;
-                if (indices == nullptr) {
-                    indices = _indices.data() + si;
-                    weightsIdx = si;
-                }
-            }
-        }
-
         // Empty bag
         if (size == 0) {
             size = 1lu;
@@ -113,6 +115,9 @@ public:
                 indices = _defaultIndices.data();
             return;
         }
+
+        indices = _indices.data() + _segmentStarts[embIndex];
+        weightsIdx = _segmentStarts[embIndex];
     }
 
 protected:
@@ -124,6 +129,8 @@ protected:
     std::vector<size_t> _indices;
     std::vector<size_t> _segmentIds;
     std::vector<size_t> _defaultIndices;
+    std::vector<size_t> _segmentStarts;
+    std::vector<size_t> _segmentSizes;
 };
 
 REG_FACTORY_FOR(EmbeddingSegmentsSumImpl, EmbeddingSegmentsSum);
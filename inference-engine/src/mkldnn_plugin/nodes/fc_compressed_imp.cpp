@@ -0,0 +1,185 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fc_compressed_imp.hpp"
+
+#include <algorithm>
+#include <cstring>
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+namespace {
+
+// number of src rows which share one load of the weights
+constexpr size_t batch_block = 4;
+
+#if defined(HAVE_AVX512F)
+constexpr size_t vlen = 16;
+typedef __m512 vec_type;
+
+inline vec_type vec_load_f32(const float* src) { return _mm512_loadu_ps(src); }
+inline vec_type vec_load_i8(const uint8_t* src) {
+    return _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src))));
+}
+inline vec_type vec_load_i4(const uint8_t* src) {
+    __m256i bytes = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)));
+    __m256i lo = _mm256_and_si256(bytes, _mm256_set1_epi32(0xF));
+    __m256i hi = _mm256_srli_epi32(bytes, 4);
+    // unpack interleaves values inside 128-bit lanes, permute restores the element order
+    __m256i even = _mm256_unpacklo_epi32(lo, hi);
+    __m256i odd = _mm256_unpackhi_epi32(lo, hi);
+    __m512i v = _mm512_inserti64x4(_mm512_castsi256_si512(_mm256_permute2x128_si256(even, odd, 0x20)),
+                                   _mm256_permute2x128_si256(even, odd, 0x31), 1);
+    return _mm512_cvtepi32_ps(_mm512_sub_epi32(v, _mm512_set1_epi32(8)));
+}
+inline vec_type vec_set1(float value) { return _mm512_set1_ps(value); }
+inline vec_type vec_fmadd(vec_type a, vec_type b, vec_type c) { return _mm512_fmadd_ps(a, b, c); }
+inline void vec_store(float* dst, vec_type v) { _mm512_storeu_ps(dst, v); }
+#elif defined(HAVE_AVX2)
+constexpr size_t vlen = 8;
+typedef __m256 vec_type;
+
+inline vec_type vec_load_f32(const float* src) { return _mm256_loadu_ps(src); }
+inline vec_type vec_load_i8(const uint8_t* src) {
+    return _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src))));
+}
+inline vec_type vec_load_i4(const uint8_t* src) {
+    int32_t packed;
+    std::memcpy(&packed, src, sizeof(packed));
+    __m128i bytes = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(packed));
+    __m128i lo = _mm_and_si128(bytes, _mm_set1_epi32(0xF));
+    __m128i hi = _mm_srli_epi32(bytes, 4);
+    __m256i v = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_unpacklo_epi32(lo, hi)),
+                                        _mm_unpackhi_epi32(lo, hi), 1);
+    return _mm256_cvtepi32_ps(_mm256_sub_epi32(v, _mm256_set1_epi32(8)));
+}
+inline vec_type vec_set1(float value) { return _mm256_set1_ps(value); }
+inline vec_type vec_fmadd(vec_type a, vec_type b, vec_type c) { return _mm256_fmadd_ps(a, b, c); }
+inline void vec_store(float* dst, vec_type v) { _mm256_storeu_ps(dst, v); }
+#elif defined(HAVE_SSE42)
+constexpr size_t vlen = 4;
+typedef __m128 vec_type;
+
+inline vec_type vec_load_f32(const float* src) { return _mm_loadu_ps(src); }
+inline vec_type vec_load_i8(const uint8_t* src) {
+    int32_t packed;
+    std::memcpy(&packed, src, sizeof(packed));
+    return _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_cvtsi32_si128(packed)));
+}
+inline vec_type vec_load_i4(const uint8_t* src) {
+    uint16_t packed;
+    std::memcpy(&packed, src, sizeof(packed));
+    __m128i bytes = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(packed));
+    __m128i lo = _mm_and_si128(bytes, _mm_set1_epi32(0xF));
+    __m128i hi = _mm_srli_epi32(bytes, 4);
+    __m128i v = _mm_unpacklo_epi32(lo, hi);
+    return _mm_cvtepi32_ps(_mm_sub_epi32(v, _mm_set1_epi32(8)));
+}
+inline vec_type vec_set1(float value) { return _mm_set1_ps(value); }
+inline vec_type vec_fmadd(vec_type a, vec_type b, vec_type c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+inline void vec_store(float* dst, vec_type v) { _mm_storeu_ps(dst, v); }
+#endif
+
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+inline float vec_reduce(vec_type v) {
+    float values[vlen];
+    vec_store(values, v);
+    float sum = 0.f;
+    for (size_t i = 0; i < vlen; i++)
+        sum += values[i];
+    return sum;
+}
+#endif
+
+template <fc_weights_format format>
+struct fc_row;
+
+template <>
+struct fc_row<fc_weights_format::I8> {
+    static inline float get(const uint8_t* values, size_t i) {
+        return static_cast<float>(reinterpret_cast<const int8_t*>(values)[i]);
+    }
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    static inline vec_type load(const uint8_t* values, size_t i) {
+        return vec_load_i8(values + i);
+    }
+#endif
+};
+
+template <>
+struct fc_row<fc_weights_format::I4> {
+    static inline float get(const uint8_t* values, size_t i) {
+        const uint8_t packed = values[i / 2];
+        return static_cast<float>(((i % 2) ? (packed >> 4) : (packed & 0xF)) - 8);
+    }
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    // i is always a multiple of vlen, so the vector starts at a byte boundary
+    static inline vec_type load(const uint8_t* values, size_t i) {
+        return vec_load_i4(values + i / 2);
+    }
+#endif
+};
+
+template <fc_weights_format format>
+void compressed_gemm(const float* src, size_t batch, size_t ic,
+                     const uint8_t* weights, size_t row_size, const float* bias,
+                     float* dst, size_t oc, size_t oc_begin, size_t oc_end) {
+    using row_type = fc_row<format>;
+
+    for (size_t o = oc_begin; o < oc_end; o++) {
+        const uint8_t* row = weights + o * row_size;
+        float scale;
+        std::memcpy(&scale, row, sizeof(scale));
+        const uint8_t* values = row + sizeof(float);
+        const float shift = bias ? bias[o] : 0.f;
+
+        for (size_t b = 0; b < batch; b += batch_block) {
+            const size_t nb = std::min(batch_block, batch - b);
+            const float* src_b = src + b * ic;
+            float sums[batch_block] = {};
+
+            size_t i = 0;
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+            vec_type acc[batch_block];
+            for (size_t k = 0; k < batch_block; k++)
+                acc[k] = vec_set1(0.f);
+            for (; i + vlen <= ic; i += vlen) {
+                const vec_type w = row_type::load(values, i);
+                for (size_t k = 0; k < nb; k++)
+                    acc[k] = vec_fmadd(vec_load_f32(src_b + k * ic + i), w, acc[k]);
+            }
+            for (size_t k = 0; k < nb; k++)
+                sums[k] = vec_reduce(acc[k]);
+#endif
+            for (; i < ic; i++) {
+                const float w = row_type::get(values, i);
+                for (size_t k = 0; k < nb; k++)
+                    sums[k] += src_b[k * ic + i] * w;
+            }
+
+            for (size_t k = 0; k < nb; k++)
+                dst[(b + k) * oc + o] = sums[k] * scale + shift;
+        }
+    }
+}
+
+}  // namespace
+
+fc_compressed_gemm_t fc_get_compressed_kernel(fc_weights_format format) {
+    switch (format) {
+        case fc_weights_format::I4: return compressed_gemm<fc_weights_format::I4>;
+        default:                    return compressed_gemm<fc_weights_format::I8>;
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
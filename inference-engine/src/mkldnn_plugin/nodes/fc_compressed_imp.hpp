@@ -0,0 +1,42 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+/**
+ * Row storage formats of compressed FullyConnected weights. Every output channel is stored as
+ * [float scale][values...] and the weight is q * scale:
+ *  - I8: ic int8_t values
+ *  - I4: (ic + 1) / 2 bytes, two values per byte stored as q + 8, the even element in the low nibble
+ */
+enum class fc_weights_format {
+    FP32,
+    I8,
+    I4
+};
+
+/**
+ * Computes dst[b * oc + o] = sum_i(src[b * ic + i] * w[o][i]) + bias[o] for all batch rows
+ * and output channels o in [oc_begin, oc_end). bias may be nullptr.
+ */
+typedef void (*fc_compressed_gemm_t)(const float* src, size_t batch, size_t ic,
+                                     const uint8_t* weights, size_t row_size, const float* bias,
+                                     float* dst, size_t oc, size_t oc_begin, size_t oc_end);
+
+namespace XARCH {
+
+fc_compressed_gemm_t fc_get_compressed_kernel(fc_weights_format format);
+
+}  // namespace XARCH
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,206 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fc_dynamic_quant_imp.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+namespace {
+
+// number of src rows which share one load of the weights
+constexpr size_t batch_block = 4;
+
+#if defined(HAVE_AVX512F)
+constexpr size_t vlen = 16;
+typedef __m512 vec_type;
+
+inline vec_type vec_load(const float* src) { return _mm512_loadu_ps(src); }
+inline vec_type vec_set1(float value) { return _mm512_set1_ps(value); }
+inline vec_type vec_min(vec_type a, vec_type b) { return _mm512_min_ps(a, b); }
+inline vec_type vec_max(vec_type a, vec_type b) { return _mm512_max_ps(a, b); }
+inline void vec_store(float* dst, vec_type v) { _mm512_storeu_ps(dst, v); }
+inline void vec_quantize(const float* src, vec_type inv_scale, int32_t zero_point, uint8_t* dst) {
+    __m512i v = _mm512_add_epi32(_mm512_cvtps_epi32(_mm512_mul_ps(vec_load(src), inv_scale)),
+                                 _mm512_set1_epi32(zero_point));
+    v = _mm512_min_epi32(_mm512_max_epi32(v, _mm512_setzero_si512()), _mm512_set1_epi32(fc_activations_max_level));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm512_cvtepi32_epi8(v));
+}
+#elif defined(HAVE_AVX2)
+constexpr size_t vlen = 8;
+typedef __m256 vec_type;
+
+inline vec_type vec_load(const float* src) { return _mm256_loadu_ps(src); }
+inline vec_type vec_set1(float value) { return _mm256_set1_ps(value); }
+inline vec_type vec_min(vec_type a, vec_type b) { return _mm256_min_ps(a, b); }
+inline vec_type vec_max(vec_type a, vec_type b) { return _mm256_max_ps(a, b); }
+inline void vec_store(float* dst, vec_type v) { _mm256_storeu_ps(dst, v); }
+inline void vec_quantize(const float* src, vec_type inv_scale, int32_t zero_point, uint8_t* dst) {
+    __m256i v = _mm256_add_epi32(_mm256_cvtps_epi32(_mm256_mul_ps(vec_load(src), inv_scale)),
+                                 _mm256_set1_epi32(zero_point));
+    v = _mm256_min_epi32(v, _mm256_set1_epi32(fc_activations_max_level));
+    // packus saturates negative values to zero
+    __m128i v16 = _mm_packus_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(v16, v16));
+}
+#elif defined(HAVE_SSE42)
+constexpr size_t vlen = 4;
+typedef __m128 vec_type;
+
+inline vec_type vec_load(const float* src) { return _mm_loadu_ps(src); }
+inline vec_type vec_set1(float value) { return _mm_set1_ps(value); }
+inline vec_type vec_min(vec_type a, vec_type b) { return _mm_min_ps(a, b); }
+inline vec_type vec_max(vec_type a, vec_type b) { return _mm_max_ps(a, b); }
+inline void vec_store(float* dst, vec_type v) { _mm_storeu_ps(dst, v); }
+inline void vec_quantize(const float* src, vec_type inv_scale, int32_t zero_point, uint8_t* dst) {
+    __m128i v = _mm_add_epi32(_mm_cvtps_epi32(_mm_mul_ps(vec_load(src), inv_scale)), _mm_set1_epi32(zero_point));
+    v = _mm_min_epi32(v, _mm_set1_epi32(fc_activations_max_level));
+    __m128i v16 = _mm_packus_epi32(v, v);
+    const int32_t packed = _mm_cvtsi128_si32(_mm_packus_epi16(v16, v16));
+    std::memcpy(dst, &packed, sizeof(packed));
+}
+#endif
+
+// u8 * s8 dot products: AVX512F has no 512-bit pmaddubsw (it is AVX512BW), so AVX2 is used there too
+#if defined(HAVE_AVX2)
+constexpr size_t ivlen = 32;
+typedef __m256i ivec_type;
+
+inline ivec_type ivec_zero() { return _mm256_setzero_si256(); }
+inline ivec_type ivec_dot(ivec_type acc, const uint8_t* src, ivec_type weights) {
+    const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+    const __m256i pairs = _mm256_maddubs_epi16(x, weights);
+    return _mm256_add_epi32(acc, _mm256_madd_epi16(pairs, _mm256_set1_epi16(1)));
+}
+inline ivec_type ivec_load(const uint8_t* src) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)); }
+inline int32_t ivec_reduce(ivec_type v) {
+    __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    sum = _mm_hadd_epi32(sum, sum);
+    sum = _mm_hadd_epi32(sum, sum);
+    return _mm_cvtsi128_si32(sum);
+}
+#elif defined(HAVE_SSE42)
+constexpr size_t ivlen = 16;
+typedef __m128i ivec_type;
+
+inline ivec_type ivec_zero() { return _mm_setzero_si128(); }
+inline ivec_type ivec_dot(ivec_type acc, const uint8_t* src, ivec_type weights) {
+    const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    const __m128i pairs = _mm_maddubs_epi16(x, weights);
+    return _mm_add_epi32(acc, _mm_madd_epi16(pairs, _mm_set1_epi16(1)));
+}
+inline ivec_type ivec_load(const uint8_t* src) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)); }
+inline int32_t ivec_reduce(ivec_type v) {
+    v = _mm_hadd_epi32(v, v);
+    v = _mm_hadd_epi32(v, v);
+    return _mm_cvtsi128_si32(v);
+}
+#endif
+
+void minmax(const float* src, size_t size, float* min_value, float* max_value) {
+    float mn = *min_value;
+    float mx = *max_value;
+    size_t i = 0;
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    if (size >= vlen) {
+        vec_type vmin = vec_set1(mn);
+        vec_type vmax = vec_set1(mx);
+        for (; i + vlen <= size; i += vlen) {
+            const vec_type v = vec_load(src + i);
+            vmin = vec_min(vmin, v);
+            vmax = vec_max(vmax, v);
+        }
+        float mins[vlen], maxs[vlen];
+        vec_store(mins, vmin);
+        vec_store(maxs, vmax);
+        for (size_t k = 0; k < vlen; k++) {
+            mn = std::min(mn, mins[k]);
+            mx = std::max(mx, maxs[k]);
+        }
+    }
+#endif
+    for (; i < size; i++) {
+        mn = std::min(mn, src[i]);
+        mx = std::max(mx, src[i]);
+    }
+    *min_value = mn;
+    *max_value = mx;
+}
+
+void quantize(const float* src, size_t size, float inv_scale, int32_t zero_point, uint8_t* dst) {
+    size_t i = 0;
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    const vec_type vinv_scale = vec_set1(inv_scale);
+    for (; i + vlen <= size; i += vlen)
+        vec_quantize(src + i, vinv_scale, zero_point, dst + i);
+#endif
+    for (; i < size; i++) {
+        const int32_t q = static_cast<int32_t>(std::nearbyint(src[i] * inv_scale)) + zero_point;
+        dst[i] = static_cast<uint8_t>(std::min(std::max(q, 0), fc_activations_max_level));
+    }
+}
+
+void gemm_i8(const uint8_t* src, size_t batch, size_t ic, const float* src_scales, const int32_t* src_zero_points,
+             const uint8_t* weights, size_t row_size, const int32_t* weights_sums, const float* bias,
+             float* dst, size_t oc, size_t oc_begin, size_t oc_end) {
+    for (size_t o = oc_begin; o < oc_end; o++) {
+        const uint8_t* row = weights + o * row_size;
+        float w_scale;
+        std::memcpy(&w_scale, row, sizeof(w_scale));
+        const int8_t* values = reinterpret_cast<const int8_t*>(row + sizeof(float));
+        const float shift = bias ? bias[o] : 0.f;
+
+        for (size_t b = 0; b < batch; b += batch_block) {
+            const size_t nb = std::min(batch_block, batch - b);
+            const uint8_t* src_b = src + b * ic;
+            int32_t sums[batch_block] = {};
+
+            size_t i = 0;
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+            ivec_type acc[batch_block];
+            for (size_t k = 0; k < batch_block; k++)
+                acc[k] = ivec_zero();
+            for (; i + ivlen <= ic; i += ivlen) {
+                const ivec_type w = ivec_load(reinterpret_cast<const uint8_t*>(values + i));
+                for (size_t k = 0; k < nb; k++)
+                    acc[k] = ivec_dot(acc[k], src_b + k * ic + i, w);
+            }
+            for (size_t k = 0; k < nb; k++)
+                sums[k] = ivec_reduce(acc[k]);
+#endif
+            for (; i < ic; i++) {
+                const int32_t w = values[i];
+                for (size_t k = 0; k < nb; k++)
+                    sums[k] += static_cast<int32_t>(src_b[k * ic + i]) * w;
+            }
+
+            for (size_t k = 0; k < nb; k++) {
+                const int32_t acc_value = sums[k] - src_zero_points[b + k] * weights_sums[o];
+                dst[(b + k) * oc + o] = static_cast<float>(acc_value) * src_scales[b + k] * w_scale + shift;
+            }
+        }
+    }
+}
+
+}  // namespace
+
+fc_dynamic_quant_kernels fc_get_dynamic_quant_kernels(fc_weights_format format) {
+    if (format != fc_weights_format::I8)
+        return {0, nullptr, nullptr, nullptr};
+    return {fc_activations_max_level, minmax, quantize, gemm_i8};
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,77 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "fc_compressed_imp.hpp"
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+/**
+ * Granularity of activation scales computed at runtime for FullyConnected with compressed weights
+ */
+enum class fc_activations_quantization {
+    NONE,
+    PER_TENSOR,
+    PER_ROW
+};
+
+/**
+ * Activations are quantized as q = clamp(round(x / scale) + zero_point, 0, max_level).
+ * SSE4.2 and AVX2 kernels use 7 bits: the range keeps the pairwise u8 * s8 sums of pmaddubsw within int16.
+ * This doubles the activation quantization step compared to 8 bits, so their results are less accurate.
+ */
+constexpr int fc_activations_max_level = 127;
+
+/**
+ * AVX512 VNNI kernels accumulate u8 * s8 products directly in int32, so activations keep all 8 bits
+ */
+constexpr int fc_activations_max_level_vnni = 255;
+
+struct fc_dynamic_quant_kernels {
+    /**
+     * The largest quantized activation value, the quantization scale is (max - min) / max_level
+     */
+    int max_level;
+    /**
+     * Updates min_value and max_value with the minimum and maximum of size values
+     */
+    void (*minmax)(const float* src, size_t size, float* min_value, float* max_value);
+    /**
+     * Quantizes size values: dst[i] = clamp(round(src[i] * inv_scale) + zero_point, 0, max_level)
+     */
+    void (*quantize)(const float* src, size_t size, float inv_scale, int32_t zero_point, uint8_t* dst);
+    /**
+     * Computes dst[b * oc + o] = src_scales[b] * w_scale[o] * (sum_i(src[b * ic + i] * q[o][i]) -
+     *                            src_zero_points[b] * weights_sums[o]) + bias[o]
+     * for all batch rows and output channels o in [oc_begin, oc_end) of I8 weight rows.
+     * weights_sums[o] is the sum of quantized values of row o, bias may be nullptr.
+     */
+    void (*gemm)(const uint8_t* src, size_t batch, size_t ic, const float* src_scales, const int32_t* src_zero_points,
+                 const uint8_t* weights, size_t row_size, const int32_t* weights_sums, const float* bias,
+                 float* dst, size_t oc, size_t oc_begin, size_t oc_end);
+};
+
+/**
+ * Returns AVX512 VNNI kernels for weights of the given format or nullptr kernels if the format is not supported
+ * or the plugin is built without VNNI support. The caller checks that the CPU supports VNNI
+ */
+fc_dynamic_quant_kernels fc_get_dynamic_quant_vnni_kernels(fc_weights_format format);
+
+namespace XARCH {
+
+/**
+ * Returns kernels for weights of the given format or nullptr kernels if the format is not supported (only I8 is)
+ */
+fc_dynamic_quant_kernels fc_get_dynamic_quant_kernels(fc_weights_format format);
+
+}  // namespace XARCH
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
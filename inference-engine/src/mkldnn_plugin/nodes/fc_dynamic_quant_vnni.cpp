@@ -0,0 +1,120 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fc_dynamic_quant_imp.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#if defined(__AVX512VNNI__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+#include <immintrin.h>
+#define FC_DYNAMIC_QUANT_VNNI
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+#ifdef FC_DYNAMIC_QUANT_VNNI
+namespace {
+
+// number of src rows which share one load of the weights
+constexpr size_t batch_block = 4;
+constexpr size_t vlen = 16;
+constexpr size_t ivlen = 64;
+
+void minmax(const float* src, size_t size, float* min_value, float* max_value) {
+    float mn = *min_value;
+    float mx = *max_value;
+    size_t i = 0;
+    if (size >= vlen) {
+        __m512 vmin = _mm512_set1_ps(mn);
+        __m512 vmax = _mm512_set1_ps(mx);
+        for (; i + vlen <= size; i += vlen) {
+            const __m512 v = _mm512_loadu_ps(src + i);
+            vmin = _mm512_min_ps(vmin, v);
+            vmax = _mm512_max_ps(vmax, v);
+        }
+        mn = _mm512_reduce_min_ps(vmin);
+        mx = _mm512_reduce_max_ps(vmax);
+    }
+    for (; i < size; i++) {
+        mn = std::min(mn, src[i]);
+        mx = std::max(mx, src[i]);
+    }
+    *min_value = mn;
+    *max_value = mx;
+}
+
+void quantize(const float* src, size_t size, float inv_scale, int32_t zero_point, uint8_t* dst) {
+    const __m512 vinv_scale = _mm512_set1_ps(inv_scale);
+    const __m512i vzero_point = _mm512_set1_epi32(zero_point);
+    size_t i = 0;
+    for (; i + vlen <= size; i += vlen) {
+        __m512i v = _mm512_add_epi32(_mm512_cvtps_epi32(_mm512_mul_ps(_mm512_loadu_ps(src + i), vinv_scale)), vzero_point);
+        // unsigned saturation of the narrowing clamps the values to 255
+        v = _mm512_max_epi32(v, _mm512_setzero_si512());
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm512_cvtusepi32_epi8(v));
+    }
+    for (; i < size; i++) {
+        const int32_t q = static_cast<int32_t>(std::nearbyint(src[i] * inv_scale)) + zero_point;
+        dst[i] = static_cast<uint8_t>(std::min(std::max(q, 0), fc_activations_max_level_vnni));
+    }
+}
+
+void gemm_i8(const uint8_t* src, size_t batch, size_t ic, const float* src_scales, const int32_t* src_zero_points,
+             const uint8_t* weights, size_t row_size, const int32_t* weights_sums, const float* bias,
+             float* dst, size_t oc, size_t oc_begin, size_t oc_end) {
+    // the tail of a row is loaded with a mask, masked out bytes are zeros and don't change the sums
+    const size_t tail = ic % ivlen;
+    const __mmask64 tail_mask = tail ? (~0ULL >> (ivlen - tail)) : 0;
+
+    for (size_t o = oc_begin; o < oc_end; o++) {
+        const uint8_t* row = weights + o * row_size;
+        float w_scale;
+        std::memcpy(&w_scale, row, sizeof(w_scale));
+        const int8_t* values = reinterpret_cast<const int8_t*>(row + sizeof(float));
+        const float shift = bias ? bias[o] : 0.f;
+
+        for (size_t b = 0; b < batch; b += batch_block) {
+            const size_t nb = std::min(batch_block, batch - b);
+            const uint8_t* src_b = src + b * ic;
+
+            __m512i acc[batch_block];
+            for (size_t k = 0; k < batch_block; k++)
+                acc[k] = _mm512_setzero_si512();
+            size_t i = 0;
+            for (; i + ivlen <= ic; i += ivlen) {
+                const __m512i w = _mm512_loadu_si512(values + i);
+                for (size_t k = 0; k < nb; k++)
+                    acc[k] = _mm512_dpbusd_epi32(acc[k], _mm512_loadu_si512(src_b + k * ic + i), w);
+            }
+            if (tail) {
+                const __m512i w = _mm512_maskz_loadu_epi8(tail_mask, values + i);
+                for (size_t k = 0; k < nb; k++)
+                    acc[k] = _mm512_dpbusd_epi32(acc[k], _mm512_maskz_loadu_epi8(tail_mask, src_b + k * ic + i), w);
+            }
+
+            for (size_t k = 0; k < nb; k++) {
+                const int32_t acc_value = _mm512_reduce_add_epi32(acc[k]) - src_zero_points[b + k] * weights_sums[o];
+                dst[(b + k) * oc + o] = static_cast<float>(acc_value) * src_scales[b + k] * w_scale + shift;
+            }
+        }
+    }
+}
+
+}  // namespace
+#endif
+
+fc_dynamic_quant_kernels fc_get_dynamic_quant_vnni_kernels(fc_weights_format format) {
+#ifdef FC_DYNAMIC_QUANT_VNNI
+    if (format == fc_weights_format::I8)
+        return {fc_activations_max_level_vnni, minmax, quantize, gemm_i8};
+#endif
+    return {0, nullptr, nullptr, nullptr};
+}
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
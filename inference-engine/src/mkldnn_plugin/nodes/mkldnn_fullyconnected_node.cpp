@@ -8,6 +8,12 @@
 #include "mkldnn_quantize_node.h"
 #include "desc_iterator.hpp"
 #include <ie_layers.h>
+#include <ie_parallel.hpp>
+#include <ie_system_conf.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
 #include <string>
 #include <vector>
 #include <mkldnn_extension_utils.h>
@@ -16,9 +22,11 @@
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace InferenceEngine::Extensions::Cpu;
 
 MKLDNNFullyConnectedNode::MKLDNNFullyConnectedNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
-        : MKLDNNNode(layer, eng, cache), withBiases(false), baseInputsNumber(0) {
+        : MKLDNNNode(layer, eng, cache), withBiases(false), baseInputsNumber(0), weightsFormat(fc_weights_format::FP32),
+          activationsQuantization(fc_activations_quantization::NONE) {
     internalBlobDesc.emplace_back([&](primitive_desc_iterator &primitive_desc_it, size_t idx) -> MKLDNNMemoryDesc {
         return MKLDNNMemoryDesc(primitive_desc_it.weights_primitive_desc(0).desc());
     });
@@ -54,6 +62,27 @@ MKLDNNFullyConnectedNode::MKLDNNFullyConnectedNode(const InferenceEngine::CNNLay
             oScale = ois->second;
         }
     }
+
+    weightsFormat = weightsFormatFromString(layer->GetParamAsString("weights_precision", "FP32"));
+    if (isWeightsCompressed())
+        compressedKernel = XARCH::fc_get_compressed_kernel(weightsFormat);
+
+    const auto quantization = layer->GetParamAsString("activations_quantization", "NONE");
+    if (quantization == "PER_TENSOR") {
+        activationsQuantization = fc_activations_quantization::PER_TENSOR;
+    } else if (quantization == "PER_ROW") {
+        activationsQuantization = fc_activations_quantization::PER_ROW;
+    } else if (quantization != "NONE") {
+        THROW_IE_EXCEPTION << "Unsupported activations quantization " << quantization << " of FullyConnected " << layer->name;
+    }
+    if (activationsQuantization != fc_activations_quantization::NONE) {
+        if (with_cpu_x86_avx512_core_vnni())
+            dynamicQuantKernels = fc_get_dynamic_quant_vnni_kernels(weightsFormat);
+        if (dynamicQuantKernels.gemm == nullptr)
+            dynamicQuantKernels = XARCH::fc_get_dynamic_quant_kernels(weightsFormat);
+        if (dynamicQuantKernels.gemm == nullptr)
+            THROW_IE_EXCEPTION << "Activations quantization of FullyConnected " << layer->name << " requires I8 weights";
+    }
 }
 
 void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
@@ -115,6 +144,36 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
                            << inDims.ndims() << " dims.";
     }
 
+    if (isWeightsCompressed()) {
+        if (baseInputsNumber != 1 || inputDataType != memory::f32)
+            THROW_IE_EXCEPTION << "FullyConnected node " << getName()
+                               << " with compressed weights supports only FP32 input and constant weights";
+
+        compressedIC = static_cast<size_t>(inDims.size(1));
+        compressedRowSize = getCompressedRowSize(weightsFormat, compressedIC);
+        compressedWeights = fcLayer->_weights;
+        if (compressedWeights->byteSize() != fcLayer->_out_num * compressedRowSize)
+            THROW_IE_EXCEPTION << "FullyConnected node " << getName() << " has compressed weights of unexpected size";
+
+        withBiases = fcLayer->_biases != nullptr && fcLayer->_biases->size() != 0;
+        if (withBiases) {
+            if (fcLayer->_biases->size() != fcLayer->_out_num || fcLayer->_biases->getTensorDesc().getPrecision() != Precision::FP32)
+                THROW_IE_EXCEPTION << "FullyConnected node " << getName() << " has unexpected biases";
+            compressedBiases = fcLayer->_biases;
+        }
+
+        if (activationsQuantization != fc_activations_quantization::NONE) {
+            // sum(q_x - zp) * q_w = sum(q_x * q_w) - zp * sum(q_w), the second sum doesn't depend on the input
+            const auto* rows = compressedWeights->cbuffer().as<const uint8_t*>();
+            weightsSums.resize(fcLayer->_out_num);
+            for (size_t o = 0; o < fcLayer->_out_num; o++) {
+                const auto* values = reinterpret_cast<const int8_t*>(rows + o * compressedRowSize + sizeof(float));
+                weightsSums[o] = std::accumulate(values, values + compressedIC, 0);
+            }
+        }
+        return;
+    }
+
     if (baseInputsNumber == 1) {
         internalBlobs.push_back(createInternalBlob(weightsDims, true));
     }
@@ -158,8 +217,44 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
+    if (!isWeightsCompressed()) {
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+        return;
+    }
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    // the kernel treats the source as a plain [batch, ic] matrix
+    auto inFormat = MKLDNNMemory::GetPlainFormat(getParentEdgeAt(0)->getDims());
+    auto outFormat = MKLDNNMemory::GetPlainFormat(getChildEdgeAt(0)->getDims());
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = true;
+    InferenceEngine::DataConfig inConfig;
+    inConfig.inPlace = -1;
+    inConfig.constant = false;
+    inConfig.desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), memory::f32, inFormat);
+    config.inConfs.push_back(inConfig);
+
+    InferenceEngine::DataConfig outConfig;
+    outConfig.inPlace = -1;
+    outConfig.constant = false;
+    outConfig.desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), memory::f32, outFormat);
+    config.outConfs.push_back(outConfig);
+
+    supportedPrimitiveDescriptors.push_back({config, impl_desc_type::gemm_any, outFormat});
+}
+
+void MKLDNNFullyConnectedNode::initOptimalPrimitiveDescriptor() {
+    // compressed weights are not handled by mkldnn, the configuration is already fully defined
+    if (isWeightsCompressed())
+        return;
+    MKLDNNNode::initOptimalPrimitiveDescriptor();
+}
+
 void MKLDNNFullyConnectedNode::createPrimitive() {
-    if (prim)
+    if (prim || isWeightsCompressed())
         return;
 
     std::shared_ptr<mkldnn::primitive_attr> attr = initPrimitiveAttr();
@@ -181,6 +276,107 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
     }
 }
 
+void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (!isWeightsCompressed()) {
+        MKLDNNNode::execute(strm);
+        return;
+    }
+
+    auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    const float* src = reinterpret_cast<const float*>(srcMemory.GetData()) +
+                       srcMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    float* dst = reinterpret_cast<float*>(dstMemory.GetData()) +
+                 dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    const uint8_t* weights = compressedWeights->cbuffer().as<const uint8_t*>();
+    const float* biases = compressedBiases ? compressedBiases->cbuffer().as<const float*>() : nullptr;
+
+    const size_t batch = static_cast<size_t>(batchToProcess());
+    const size_t ic = compressedIC;
+    const size_t oc = static_cast<size_t>(getChildEdgeAt(0)->getDims()[1]);
+    const size_t rowSize = compressedRowSize;
+
+    if (activationsQuantization == fc_activations_quantization::NONE) {
+        // every thread reads its own range of weight rows, so the weights are streamed from memory once
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(oc, nthr, ithr, start, end);
+            if (start < end)
+                compressedKernel(src, batch, ic, weights, rowSize, biases, dst, oc, start, end);
+        });
+        return;
+    }
+
+    quantizeActivations(src, batch);
+    const uint8_t* qsrc = quantizedSrc.data();
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(oc, nthr, ithr, start, end);
+        if (start < end)
+            dynamicQuantKernels.gemm(qsrc, batch, ic, srcScales.data(), srcZeroPoints.data(), weights, rowSize,
+                                     weightsSums.data(), biases, dst, oc, start, end);
+    });
+}
+
+void MKLDNNFullyConnectedNode::quantizeActivations(const float* src, size_t batch) {
+    const size_t ic = compressedIC;
+    // the buffers are sized for the largest batch once
+    quantizedSrc.resize(std::max(quantizedSrc.size(), batch * ic));
+    srcScales.resize(std::max(srcScales.size(), batch));
+    srcZeroPoints.resize(std::max(srcZeroPoints.size(), batch));
+
+    // the range always includes zero, so zero (e.g. padding or ReLU output) is quantized exactly
+    const int maxLevel = dynamicQuantKernels.max_level;
+    auto getParams = [maxLevel](float minValue, float maxValue, float& scale, int32_t& zeroPoint) {
+        scale = (maxValue - minValue) / maxLevel;
+        if (scale == 0.f) {
+            scale = 1.f;
+            zeroPoint = 0;
+            return;
+        }
+        zeroPoint = static_cast<int32_t>(std::nearbyint(-minValue / scale));
+        zeroPoint = std::min(std::max(zeroPoint, 0), maxLevel);
+    };
+
+    if (activationsQuantization == fc_activations_quantization::PER_ROW) {
+        parallel_for(batch, [&](size_t b) {
+            float minValue = 0.f, maxValue = 0.f;
+            dynamicQuantKernels.minmax(src + b * ic, ic, &minValue, &maxValue);
+            getParams(minValue, maxValue, srcScales[b], srcZeroPoints[b]);
+            dynamicQuantKernels.quantize(src + b * ic, ic, 1.f / srcScales[b], srcZeroPoints[b],
+                                         quantizedSrc.data() + b * ic);
+        });
+        return;
+    }
+
+    // per tensor: the range is reduced over contiguous chunks of the whole input
+    const size_t size = batch * ic;
+    srcPartialRanges.resize(std::max(srcPartialRanges.size(), static_cast<size_t>(2 * parallel_get_max_threads())));
+    std::fill(srcPartialRanges.begin(), srcPartialRanges.end(), 0.f);
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(size, nthr, ithr, start, end);
+        if (start < end)
+            dynamicQuantKernels.minmax(src + start, end - start, &srcPartialRanges[2 * ithr], &srcPartialRanges[2 * ithr + 1]);
+    });
+    float minValue = 0.f, maxValue = 0.f;
+    for (size_t i = 0; i < srcPartialRanges.size(); i += 2) {
+        minValue = std::min(minValue, srcPartialRanges[i]);
+        maxValue = std::max(maxValue, srcPartialRanges[i + 1]);
+    }
+    float scale;
+    int32_t zeroPoint;
+    getParams(minValue, maxValue, scale, zeroPoint);
+    std::fill(srcScales.begin(), srcScales.begin() + batch, scale);
+    std::fill(srcZeroPoints.begin(), srcZeroPoints.begin() + batch, zeroPoint);
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(size, nthr, ithr, start, end);
+        if (start < end)
+            dynamicQuantKernels.quantize(src + start, end - start, 1.f / scale, zeroPoint, quantizedSrc.data() + start);
+    });
+}
+
 void MKLDNNFullyConnectedNode::setPostOps(mkldnn::primitive_attr &attr, bool initWeights = false) {
     int blob_idx = 0;
     mkldnn::post_ops ops;
@@ -428,4 +624,83 @@ const mkldnn::memory& MKLDNNFullyConnectedNode::getBias() const {
     return baseInputsNumber > 2 ? getParentEdgeAt(2)->getMemory().GetPrimitive() : internalBlobMemory[1]->GetPrimitive();
 }
 
+InferenceEngine::Precision MKLDNNFullyConnectedNode::getRuntimePrecision() const {
+    // FP32 activations are quantized at every inference, dot products are computed on integers
+    if (activationsQuantization != fc_activations_quantization::NONE)
+        return InferenceEngine::Precision::I8;
+    return MKLDNNNode::getRuntimePrecision();
+}
+
+std::string MKLDNNFullyConnectedNode::getWeightsPrecision() const {
+    switch (weightsFormat) {
+        case fc_weights_format::I8:
+            return "I8";
+        case fc_weights_format::I4:
+            return "I4";
+        default:
+            return {};
+    }
+}
+
+fc_weights_format MKLDNNFullyConnectedNode::weightsFormatFromString(const std::string& name) {
+    if (name == "FP32")
+        return fc_weights_format::FP32;
+    if (name == "I8")
+        return fc_weights_format::I8;
+    if (name == "I4")
+        return fc_weights_format::I4;
+    THROW_IE_EXCEPTION << "Unsupported FullyConnected weights precision: " << name;
+}
+
+size_t MKLDNNFullyConnectedNode::getCompressedRowSize(fc_weights_format format, size_t ic) {
+    switch (format) {
+        case fc_weights_format::I8:
+            return sizeof(float) + ic * sizeof(int8_t);
+        case fc_weights_format::I4:
+            return sizeof(float) + (ic + 1) / 2;
+        default:
+            return ic * sizeof(float);
+    }
+}
+
+void MKLDNNFullyConnectedNode::packWeights(const float* src, size_t oc, size_t ic,
+                                           fc_weights_format format, uint8_t* dst) {
+    const size_t rowSize = getCompressedRowSize(format, ic);
+    const float maxLevel = format == fc_weights_format::I4 ? 7.f : 127.f;
+
+    parallel_for(oc, [&](size_t o) {
+        const float* srcRow = src + o * ic;
+        uint8_t* dstRow = dst + o * rowSize;
+        if (format == fc_weights_format::FP32) {
+            std::memcpy(dstRow, srcRow, rowSize);
+            return;
+        }
+
+        float absMax = 0.f;
+        for (size_t i = 0; i < ic; i++)
+            absMax = std::max(absMax, std::fabs(srcRow[i]));
+        // symmetric quantization keeps zero exact and needs no zero point in the kernel
+        const float scale = absMax / maxLevel;
+        const float invScale = scale != 0.f ? 1.f / scale : 0.f;
+        std::memcpy(dstRow, &scale, sizeof(scale));
+        uint8_t* values = dstRow + sizeof(float);
+
+        auto quantize = [&](size_t i) {
+            float q = std::nearbyint(srcRow[i] * invScale);
+            return static_cast<int>(std::min(std::max(q, -maxLevel), maxLevel));
+        };
+        if (format == fc_weights_format::I8) {
+            for (size_t i = 0; i < ic; i++)
+                values[i] = static_cast<uint8_t>(static_cast<int8_t>(quantize(i)));
+        } else {
+            for (size_t i = 0; i < ic; i += 2) {
+                const int lo = quantize(i) + 8;
+                // the padding nibble of an odd row decodes to zero
+                const int hi = i + 1 < ic ? quantize(i + 1) + 8 : 8;
+                values[i / 2] = static_cast<uint8_t>(lo | (hi << 4));
+            }
+        }
+    });
+}
+
 REG_MKLDNN_PRIM_FOR(MKLDNNFullyConnectedNode, FullyConnected);
@@ -6,6 +6,8 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include "fc_compressed_imp.hpp"
+#include "fc_dynamic_quant_imp.hpp"
 #include <memory>
 #include <string>
 #include <vector>
@@ -18,7 +20,10 @@ public:
     ~MKLDNNFullyConnectedNode() override = default;
 
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void initOptimalPrimitiveDescriptor() override;
     void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
     bool created() const override;
     bool canBeInPlace() const override {
         return false;
@@ -37,6 +42,26 @@ public:
     const mkldnn::memory& getWeights() const;
     const mkldnn::memory& getBias() const;
 
+    /**
+     * Weights were packed by FullyConnectedWeightsCompressor, the node runs the compressed
+     * matrix-vector kernel instead of the mkldnn inner product.
+     */
+    bool isWeightsCompressed() const {
+        return weightsFormat != InferenceEngine::Extensions::Cpu::fc_weights_format::FP32;
+    }
+
+    InferenceEngine::Precision getRuntimePrecision() const override;
+    std::string getWeightsPrecision() const override;
+
+    static InferenceEngine::Extensions::Cpu::fc_weights_format weightsFormatFromString(const std::string& name);
+    static size_t getCompressedRowSize(InferenceEngine::Extensions::Cpu::fc_weights_format format, size_t ic);
+    /**
+     * Quantizes [oc, ic] FP32 weights into rows of the given format with a per output channel scale.
+     * dst must have oc * getCompressedRowSize(format, ic) bytes.
+     */
+    static void packWeights(const float* src, size_t oc, size_t ic,
+                            InferenceEngine::Extensions::Cpu::fc_weights_format format, uint8_t* dst);
+
 protected:
     std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr();
 
@@ -52,6 +77,23 @@ private:
 
     bool withBiases;
     int baseInputsNumber;
+
+    InferenceEngine::Extensions::Cpu::fc_weights_format weightsFormat = InferenceEngine::Extensions::Cpu::fc_weights_format::FP32;
+    InferenceEngine::Extensions::Cpu::fc_compressed_gemm_t compressedKernel = nullptr;
+    InferenceEngine::Blob::Ptr compressedWeights, compressedBiases;
+    size_t compressedIC = 0;
+    size_t compressedRowSize = 0;
+
+    // runtime quantization of activations for INT8 compressed weights
+    void quantizeActivations(const float* src, size_t batch);
+
+    InferenceEngine::Extensions::Cpu::fc_activations_quantization activationsQuantization;
+    InferenceEngine::Extensions::Cpu::fc_dynamic_quant_kernels dynamicQuantKernels = {};
+    std::vector<int32_t> weightsSums;
+    std::vector<uint8_t> quantizedSrc;
+    std::vector<float> srcScales;
+    std::vector<int32_t> srcZeroPoints;
+    std::vector<float> srcPartialRanges;
 };
 
 }  // namespace MKLDNNPlugin
@@ -72,6 +72,8 @@ void MKLDNNGenericNode::initSupportedPrimitiveDescriptors() {
 
 void MKLDNNGenericNode::createPrimitive() {
     if (extFactory || !impls.empty()) {
+        // Port blobs are created on the first execution when memory of all edges is allocated
+        portEdges.clear();
         return;
     }
     if (getSelectedPrimitiveDescriptor() == nullptr)
@@ -115,21 +117,36 @@ void MKLDNNGenericNode::cleanup() {
     extFactory.reset();
 }
 
-void MKLDNNGenericNode::execLayer() {
+bool MKLDNNGenericNode::portBlobsAreValid() {
+    if (portBlobsBatchLim != dynBatchLim || portEdges.empty())
+        return false;
+    for (size_t i = 0; i < portEdges.size(); i++) {
+        if (portData[i] != portEdges[i]->getMemory().GetData())
+            return false;
+    }
+    return true;
+}
+
+void MKLDNNGenericNode::preparePortBlobs() {
     bool isDynBatch = dynBatchLim > 0;
-    std::vector<InferenceEngine::Blob::Ptr> inputs;
     std::vector<InferenceEngine::Blob::CPtr> constInputs;
     std::vector<InferenceEngine::TensorDesc> inputDescs;
     std::vector<InferenceEngine::SizeVector> outputShapes;
+    inputBlobs.clear();
+    outputBlobs.clear();
+    portEdges.clear();
+    portData.clear();
     for (size_t i = 0; i < getParentEdges().size(); i++) {
-        auto inputBlob = getParentEdgeAt(i)->getBlob();
-        inputs.push_back(inputBlob);
+        portEdges.push_back(getParentEdgeAt(i));
+        portData.push_back(portEdges.back()->getMemory().GetData());
+        auto inputBlob = portEdges.back()->getBlob();
+        inputBlobs.push_back(inputBlob);
         constInputs.push_back(inputBlob);
-        if (isDynBatch && dynBatchLim >= inputs[inputs.size() - 1]->getTensorDesc().getDims()[0]) {
+        if (isDynBatch && dynBatchLim >= inputBlob->getTensorDesc().getDims()[0]) {
             isDynBatch = false;
         } else {
             // TODO: Ask the right dims using getShape() from previous node
-            inputDescs.push_back(inputs[inputs.size() - 1]->getTensorDesc());
+            inputDescs.push_back(inputBlob->getTensorDesc());
             if (inputDescs[inputDescs.size() - 1].getDims().size() > 0)
                 inputDescs[inputDescs.size() - 1].getDims()[0] = static_cast<size_t>(batchToProcess());
         }
@@ -148,25 +165,33 @@ void MKLDNNGenericNode::execLayer() {
     }
 
     if (isDynBatch) {
-        for (size_t i = 0; i < inputs.size(); i++) {
-            auto td = inputs[i]->getTensorDesc();
+        for (size_t i = 0; i < inputBlobs.size(); i++) {
+            auto td = inputBlobs[i]->getTensorDesc();
             td.setDims(inputDescs[i].getDims());
-            inputs[i] = make_blob_with_precision(td, getParentEdgeAt(i)->getMemory().GetData());
+            inputBlobs[i] = make_blob_with_precision(td, portData[i]);
         }
     }
-    std::vector<InferenceEngine::Blob::Ptr> outputs;
     for (size_t i = 0; i < outDims.size(); i++) {
+        auto out_edge = getChildEdgesAtPort(i)[0];
+        portEdges.push_back(out_edge);
+        portData.push_back(out_edge->getMemory().GetData());
         if (isDynBatch) {
-            auto out_edge = getChildEdgesAtPort(i)[0];
             auto td = out_edge->getBlob()->getTensorDesc();
             td.setDims(outputShapes[i]);
-            outputs.push_back(make_blob_with_precision(td, out_edge->getMemory().GetData()));
+            outputBlobs.push_back(make_blob_with_precision(td, portData.back()));
         } else {
-            outputs.push_back(getChildEdgesAtPort(i)[0]->getBlob());
+            outputBlobs.push_back(out_edge->getBlob());
         }
     }
+    portBlobsBatchLim = dynBatchLim;
+}
+
+void MKLDNNGenericNode::execLayer() {
+    if (!portBlobsAreValid())
+        preparePortBlobs();
+
     InferenceEngine::ResponseDesc resp;
-    InferenceEngine::StatusCode rc = impls[0]->execute(inputs, outputs, &resp);
+    InferenceEngine::StatusCode rc = impls[0]->execute(inputBlobs, outputBlobs, &resp);
     if (rc != InferenceEngine::OK) {
         THROW_IE_EXCEPTION << resp.msg;
     }
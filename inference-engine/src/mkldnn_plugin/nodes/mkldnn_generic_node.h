@@ -43,6 +43,18 @@ protected:
     std::vector<InferenceEngine::ILayerExecImpl::Ptr> impls;
     std::map<std::string, std::string> params;
     std::map<std::string, InferenceEngine::Blob::Ptr> blobs;
+
+private:
+    bool portBlobsAreValid();
+    void preparePortBlobs();
+
+    // Blobs passed to the extension are created once and rebuilt only when the batch limit
+    // or memory of some edge is changed
+    std::vector<InferenceEngine::Blob::Ptr> inputBlobs;
+    std::vector<InferenceEngine::Blob::Ptr> outputBlobs;
+    std::vector<MKLDNNEdgePtr> portEdges;
+    std::vector<void*> portData;
+    int portBlobsBatchLim = -1;
 };
 
 }  // namespace MKLDNNPlugin
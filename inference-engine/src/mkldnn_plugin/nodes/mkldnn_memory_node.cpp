@@ -50,9 +50,60 @@ const MKLDNNEdgePtr MKLDNNMemoryOutputNode::getChildEdgeAt(size_t idx) const {
     return MKLDNNNode::getChildEdgeAt(idx);
 }
 
+bool MKLDNNMemoryOutputNode::canSwapState() {
+    if (inputNode == nullptr)
+        return false;
+
+    // Producer of the new state fills memory which is used by this node only
+    auto srcEdge = getParentEdgeAt(0);
+    auto producer = srcEdge->getParent();
+    if (producer->getChildEdges().size() != 1 || producer->isConstant() || producer->isInplace() ||
+        producer->getType() == Input || producer->getType() == MemoryInput)
+        return false;
+    void* srcPtr = srcEdge->getMemory().GetData();
+    for (size_t i = 0; i < producer->getParentEdges().size(); i++) {
+        if (producer->getParentEdgeAt(i)->getMemory().GetData() == srcPtr)
+            return false;
+    }
+
+    // Consumers of the state don't keep views on the state memory
+    auto dstEdge = inputNode->getChildEdgeAt(0);
+    void* dstPtr = dstEdge->getMemory().GetData();
+    if (!(srcEdge->getDesc() == dstEdge->getDesc()) ||
+        srcEdge->getMemory().GetSize() != dstEdge->getMemory().GetSize())
+        return false;
+    for (size_t i = 0; i < inputNode->getChildEdges().size(); i++) {
+        auto stateEdge = inputNode->getChildEdgeAt(i);
+        auto consumer = stateEdge->getChild();
+        if (stateEdge->getMemory().GetData() != dstPtr || consumer->isConstant() || consumer->isInplace() ||
+            consumer->getType() == Concatenation || consumer->getType() == Split)
+            return false;
+        for (size_t j = 0; j < consumer->getChildEdges().size(); j++) {
+            if (consumer->getChildEdgeAt(j)->getMemory().GetData() == dstPtr)
+                return false;
+        }
+    }
+    return true;
+}
+
 void MKLDNNMemoryOutputNode::execute(mkldnn::stream strm)  {
     auto& srcMemory = getParentEdgeAt(0)->getMemory();
 
+    if (stateSwap == StateSwap::Unknown)
+        stateSwap = canSwapState() ? StateSwap::Enabled : StateSwap::Disabled;
+
+    if (stateSwap == StateSwap::Enabled) {
+        // Both buffers are never reused by other edges (see MKLDNNGraph::AllocateWithReuse), so the producer
+        // writes the next state to the buffer of the previous state
+        void* nextState = srcMemory.GetData();
+        void* prevState = getChildEdgeAt(0)->getMemory().GetData();
+        srcMemory.GetPrimitivePtr()->set_data_handle(prevState);
+        for (size_t i = 0; i < inputNode->getChildEdges().size(); i++) {
+            inputNode->getChildEdgeAt(i)->getMemory().GetPrimitivePtr()->set_data_handle(nextState);
+        }
+        return;
+    }
+
     const float *src_ptr = reinterpret_cast<const float*>(srcMemory.GetData()) +
             srcMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
     float *dst_ptr = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemory().GetData()) +
@@ -80,10 +80,17 @@ class MKLDNNMemoryOutputNode : public MKLDNNNode, public MKLDNNMemoryNode {
         inputNode = node;
     }
  private:
+    bool canSwapState();
+
     /**
      * @brief keeps reference to input sibling node
      */
     MKLDNNNode* inputNode = nullptr;
+    /**
+     * @brief the new state is passed to the input sibling by swapping memory pointers instead of copying,
+     * when memory of both sides isn't shared with other edges
+     */
+    enum class StateSwap { Unknown, Enabled, Disabled } stateSwap = StateSwap::Unknown;
     static Register<MKLDNNMemoryOutputNode> reg;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
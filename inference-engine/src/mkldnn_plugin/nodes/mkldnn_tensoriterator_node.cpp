@@ -143,6 +143,144 @@ public:
     };
 };
 
+/**
+ * Redirects body port memories directly into the iteration chunk of the outer tensor,
+ * so the body reads/writes outer data without intermediate copies.
+ */
+class PortAliasHelper : public PortMapHelper {
+public:
+    PortAliasHelper(const MKLDNNMemoryPtr &full, const std::vector<MKLDNNMemoryPtr> &views,
+            const TensorIterator::PortMap &port_map, int n_iter) : full(full), views(views) {
+        auto abs_stride = std::abs(port_map.stride);
+        auto full_dims = full->GetDims();
+
+        iter_count = n_iter;
+        chunk_stride_in_byte = MKLDNNExtensionUtils::sizeOfDataType(full->GetDataType()) * abs_stride;
+        for (size_t i = port_map.axis + 1; i < full_dims.size(); i++)
+            chunk_stride_in_byte *= full_dims[i];
+        chunk_offset_in_byte = port_map.stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
+        chunk_stride_in_byte *= port_map.stride < 0 ? -1 : 1;
+    }
+
+    /**
+     * Chunk of the full tensor may be used in place of the body memory only if it is dense
+     * and has exactly the same layout as the body memory.
+     */
+    static bool isApplicable(const MKLDNNMemoryPtr &full, const MKLDNNMemoryPtr &part,
+            const std::vector<MKLDNNMemoryPtr> &views, const TensorIterator::PortMap &port_map) {
+        if (port_map.axis < 0 || views.empty())
+            return false;
+        if (full->GetDataType() != part->GetDataType())
+            return false;
+        if (full->GetFormat() != MKLDNNMemory::GetPlainFormat(full->GetDims()) ||
+            part->GetFormat() != MKLDNNMemory::GetPlainFormat(part->GetDims()))
+            return false;
+
+        auto full_dims = full->GetDims();
+        auto part_dims = part->GetDims();
+        full_dims[port_map.axis] = std::abs(port_map.stride);
+        if (full_dims != part_dims)
+            return false;
+
+        for (int i = 0; i < port_map.axis; i++)
+            if (full_dims[i] != 1)
+                return false;
+        return true;
+    }
+
+    void execute(int n_iter, mkldnn::stream) override {
+        IE_ASSERT(n_iter < iter_count);
+
+        auto chunk_ptr = static_cast<uint8_t *>(full->GetData()) + chunk_offset_in_byte + chunk_stride_in_byte * n_iter;
+        for (auto &view : views)
+            view->GetPrimitive().set_data_handle(chunk_ptr);
+    };
+
+private:
+    MKLDNNMemoryPtr full;
+    std::vector<MKLDNNMemoryPtr> views;
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+};
+
+/**
+ * Back edge implemented as a pair of buffers swapped between iterations: the body output
+ * of one iteration becomes the body input of the next one without copying.
+ * Should be executed before the other input mappers, which may write the initial state.
+ */
+class BackEdgeSwapHelper : public PortMapHelper {
+public:
+    BackEdgeSwapHelper(const std::vector<MKLDNNMemoryPtr> &from_views, const std::vector<MKLDNNMemoryPtr> &to_views,
+            const mkldnn::engine& eng, int n_iter) : from_views(from_views), to_views(to_views) {
+        // Own buffers are used since the original ones may be reused by other body edges
+        auto mem_desc = to_views[0]->GetDescriptor();
+        for (auto &buffer : buffers) {
+            buffer.reset(new MKLDNNMemory(eng));
+            buffer->Create(mem_desc);
+        }
+        iter_count = n_iter;
+    }
+
+    static bool isApplicable(const std::vector<MKLDNNMemoryPtr> &from_views, const std::vector<MKLDNNMemoryPtr> &to_views) {
+        if (from_views.empty() || to_views.empty())
+            return false;
+        return MKLDNNMemoryDesc(from_views[0]->GetDescriptor()) == MKLDNNMemoryDesc(to_views[0]->GetDescriptor());
+    }
+
+    void execute(int n_iter, mkldnn::stream) override {
+        auto to_ptr = buffers[n_iter % 2]->GetData();
+        auto from_ptr = buffers[(n_iter + 1) % 2]->GetData();
+
+        for (auto &view : to_views)
+            view->GetPrimitive().set_data_handle(to_ptr);
+        for (auto &view : from_views)
+            view->GetPrimitive().set_data_handle(from_ptr);
+    };
+
+private:
+    std::vector<MKLDNNMemoryPtr> from_views, to_views;
+    MKLDNNMemoryPtr buffers[2];
+};
+
+/**
+ * Collects memories of all edges reading the output port of the body node. Returns false if
+ * the port data is shared with other edges by in-place nodes, so its pointer can't be redirected.
+ */
+static bool collectPortViews(const MKLDNNNodePtr &node, int port, std::vector<MKLDNNMemoryPtr> &views) {
+    const auto *node_pd = node->getSelectedPrimitiveDescriptor();
+    if (node_pd == nullptr)
+        return false;
+    const auto &node_config = node_pd->getConfig();
+    if (node_config.outConfs.size() <= static_cast<size_t>(port) || node_config.outConfs[port].inPlace >= 0)
+        return false;
+    for (const auto &in_conf : node_config.inConfs)
+        if (in_conf.inPlace == port)
+            return false;
+
+    std::vector<MKLDNNMemoryPtr> port_views;
+    for (const auto &edge : node->getChildEdgesAtPort(port)) {
+        auto child = edge->getChild();
+        auto child_port = edge->getOutputNum();
+        const auto *child_pd = child->getSelectedPrimitiveDescriptor();
+        if (child_pd == nullptr)
+            return false;
+
+        const auto &child_config = child_pd->getConfig();
+        if (child_config.inConfs.size() <= static_cast<size_t>(child_port) || child_config.inConfs[child_port].inPlace >= 0)
+            return false;
+        for (const auto &out_conf : child_config.outConfs)
+            if (out_conf.inPlace == child_port)
+                return false;
+
+        port_views.push_back(edge->getMemoryPtr());
+    }
+    if (port_views.empty())
+        return false;
+
+    views = port_views;
+    return true;
+}
+
 }  // namespace MKLDNNPlugin
 
 MKLDNNTensorIteratorNode::MKLDNNTensorIteratorNode(InferenceEngine::CNNLayerPtr layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache) :
@@ -172,12 +310,21 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         auto &in_node = in_map[in_data->getName()];
         auto in_mem = in_node->getChildEdgeAt(0)->getMemoryPtr();
         input_mem.push_back(in_mem);
+
+        std::vector<MKLDNNMemoryPtr> views;
+        collectPortViews(in_node, 0, views);
+        input_views.push_back(views);
     }
 
     for (const auto &out_data : ti->body.outputs) {
         auto &out_node = out_map[out_data->getName()];
-        auto out_mem = out_node->getParentEdgeAt(0)->getMemoryPtr();
+        auto out_edge = out_node->getParentEdgeAt(0);
+        auto out_mem = out_edge->getMemoryPtr();
         output_mem.push_back(out_mem);
+
+        std::vector<MKLDNNMemoryPtr> views;
+        collectPortViews(out_edge->getParent(), out_edge->getInputNum(), views);
+        output_views.push_back(views);
     }
 }
 
@@ -195,12 +342,42 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
     if (ti == nullptr)
         THROW_IE_EXCEPTION << "Cannot convert to TensorIterator layer.";
 
+    std::vector<bool> input_aliased(input_mem.size(), false), output_aliased(output_mem.size(), false);
+
+    std::map<int, int> back_edges_from, back_edges_to;
+    for (auto map_rule : ti->back_edges) {
+        back_edges_from[map_rule.from]++;
+        back_edges_to[map_rule.to]++;
+    }
+
+    // Views shared by several body ports (e.g. a body input connected to a body output directly,
+    // which makes a passthrough back edge) would need different data pointers at once, so such
+    // ports fall back to the copying helpers
+    std::map<const MKLDNNMemory*, int> view_ports;
+    for (const auto *port_views : {&input_views, &output_views})
+        for (const auto &views : *port_views)
+            for (const auto &view : views)
+                view_ports[view.get()]++;
+    auto isExclusive = [&](const std::vector<MKLDNNMemoryPtr> &views) {
+        for (const auto &view : views)
+            if (view_ports[view.get()] > 1)
+                return false;
+        return true;
+    };
+
     for (auto map_rule : ti->input_port_map) {
         auto &extr_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &intr_mem = input_mem[map_rule.to];
 
-        auto mapper = std::shared_ptr<PortMapHelper>(
-                new PortIteratorHelper (extr_mem, intr_mem, true, map_rule, getEngine(), n_iter));
+        // Body input written by a back edge must not be redirected into the outer (read only) tensor
+        std::shared_ptr<PortMapHelper> mapper;
+        if (back_edges_to.count(map_rule.to) == 0 && isExclusive(input_views[map_rule.to]) &&
+            PortAliasHelper::isApplicable(extr_mem, intr_mem, input_views[map_rule.to], map_rule)) {
+            mapper.reset(new PortAliasHelper(extr_mem, input_views[map_rule.to], map_rule, n_iter));
+            input_aliased[map_rule.to] = true;
+        } else {
+            mapper.reset(new PortIteratorHelper(extr_mem, intr_mem, true, map_rule, getEngine(), n_iter));
+        }
 
         in_port_mappers.push_back(mapper);
     }
@@ -209,21 +386,40 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
         auto &extr_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &intr_mem = output_mem[map_rule.to];
 
+        // Aliased output is redirected before the iteration, so the body writes the outer chunk directly
+        if (!output_aliased[map_rule.to] && isExclusive(output_views[map_rule.to]) &&
+            PortAliasHelper::isApplicable(extr_mem, intr_mem, output_views[map_rule.to], map_rule)) {
+            in_port_mappers.emplace_back(new PortAliasHelper(extr_mem, output_views[map_rule.to], map_rule, n_iter));
+            output_aliased[map_rule.to] = true;
+            continue;
+        }
+
         auto mapper = std::shared_ptr<PortMapHelper>(
                 new PortIteratorHelper (intr_mem, extr_mem, false, map_rule, getEngine(), n_iter));
 
         out_port_mappers.push_back(mapper);
     }
 
+    std::vector<std::shared_ptr<PortMapHelper>> swap_mappers;
     for (auto map_rule : ti->back_edges) {
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mem[map_rule.to];
 
+        if (back_edges_from[map_rule.from] == 1 && back_edges_to[map_rule.to] == 1 &&
+            !output_aliased[map_rule.from] && !input_aliased[map_rule.to] &&
+            isExclusive(output_views[map_rule.from]) && isExclusive(input_views[map_rule.to]) &&
+            BackEdgeSwapHelper::isApplicable(output_views[map_rule.from], input_views[map_rule.to])) {
+            swap_mappers.emplace_back(new BackEdgeSwapHelper(output_views[map_rule.from], input_views[map_rule.to],
+                                                             getEngine(), n_iter));
+            continue;
+        }
+
         auto mapper = std::shared_ptr<PortMapHelper>(
                 new BackEdgePortHelper(from_mem, to_mem, getEngine(), n_iter));
 
         out_port_mappers.push_back(mapper);
     }
+    in_port_mappers.insert(in_port_mappers.begin(), swap_mappers.begin(), swap_mappers.end());
 }
 
 void MKLDNNTensorIteratorNode::execute(mkldnn::stream strm) {
@@ -41,7 +41,11 @@ private:
     MKLDNNExtensionManager::Ptr ext_mng;
     MKLDNNGraph sub_graph;
     std::vector<MKLDNNMemoryPtr> input_mem, output_mem;
+    // Memories of all body edges sharing the data of a body input/output. Empty if the data pointer
+    // of the port can't be redirected (in-place neighbours), so port copies have to be used.
+    std::vector<std::vector<MKLDNNMemoryPtr>> input_views, output_views;
 
+    // in_port_mappers are executed before each body iteration, out_port_mappers after it
     std::vector<std::shared_ptr<PortMapHelper>> in_port_mappers, out_port_mappers;
 };
 
@@ -10,8 +10,10 @@
 #include <string>
 #include <vector>
 #include <cassert>
+#include <algorithm>
 #include <ie_util_internal.hpp>
 #include "ie_parallel.hpp"
+#include "reduce_imp.hpp"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -140,6 +142,8 @@ public:
         auto compare = getPrecisionMask(inputs[REDUCE_DATA]->getTensorDesc().getPrecision(), outputs[0]->getTensorDesc().getPrecision());
         switch (compare) {
             case getPrecisionMask(Precision::FP32, Precision::FP32):
+                if (reduce_planar_fp32(inputs, outputs, axes_for_reduction, reduced_dims_work_amount))
+                    return OK;
                 return reduce_type<float , float>(inputs, outputs, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims);
             case getPrecisionMask(Precision::I32, Precision::I64):
                 return reduce_type<int32_t , int64_t>(inputs, outputs, work_amount_dst, reduced_dims_work_amount, axes_for_reduction, our_dims);
@@ -169,10 +173,18 @@ private:
     template <typename src_d, typename dst_t>
     StatusCode reduce_type(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, size_t work_amount_dst, size_t reduced_dims_work_amount,
                 SizeVector axes_for_reduction, SizeVector dst_dims);
+    bool reduce_planar_fp32(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs,
+                            const SizeVector& axes_for_reduction, size_t reduced_dims_work_amount);
     enum class Reduce { And, L1, L2, LogSum, LogSumExp, Max, Mean, Min, Or, Prod, Sum, SumSquare };
 
     const size_t REDUCE_DATA = 0;
     const size_t REDUCE_INDEXES = 1;
+    // Inner (not reduced) elements processed by one task of the vectorized path
+    const size_t REDUCE_INNER_BLOCK = 64;
+    // Below this number of tasks the reduced axis is split into chunks combined by a tree
+    const size_t REDUCE_MIN_PARALLEL_WORK = 64;
+    // Number of source elements reduced by one chunk of the tree reduction
+    const size_t REDUCE_CHUNK_SIZE = 16384;
     bool keep_dims = true;
     Reduce reduceMode = Reduce::Sum;
     SizeVector data_dims;
@@ -181,6 +193,139 @@ private:
     SizeVector srcStrides;
 };
 
+/**
+ * FP32 reduction over a contiguous range of axes, i.e. the source is viewed as [outer, reduced, inner]
+ * and reduced along the middle dimension with vectorized kernels.
+ * If there are too few outputs to load all threads, the reduced dimension is split into fixed size chunks
+ * whose partial results are combined pairwise. Both the chunking and the combination order depend
+ * only on the shapes, so the result doesn't depend on the number of threads.
+ * Returns false if the reduction isn't supported by this path.
+ */
+bool ReduceImpl::reduce_planar_fp32(
+        std::vector<Blob::Ptr>& inputs,
+        std::vector<Blob::Ptr>& outputs,
+        const SizeVector&       axes_for_reduction,
+        size_t                  reduced_dims_work_amount
+) {
+    reduce_kind kind, combine_kind;
+    float init_value;
+    switch (reduceMode) {
+        case Reduce::Sum:
+        case Reduce::Mean:
+        case Reduce::LogSum:    kind = reduce_kind::Sum;       combine_kind = reduce_kind::Sum;  init_value = 0.f; break;
+        case Reduce::L1:        kind = reduce_kind::SumAbs;    combine_kind = reduce_kind::Sum;  init_value = 0.f; break;
+        case Reduce::L2:
+        case Reduce::SumSquare: kind = reduce_kind::SumSquare; combine_kind = reduce_kind::Sum;  init_value = 0.f; break;
+        case Reduce::Prod:      kind = reduce_kind::Prod;      combine_kind = reduce_kind::Prod; init_value = 1.f; break;
+        case Reduce::Max:
+            kind = combine_kind = reduce_kind::Max;
+            init_value = -std::numeric_limits<float>::infinity();
+            break;
+        case Reduce::Min:
+            kind = combine_kind = reduce_kind::Min;
+            init_value = std::numeric_limits<float>::infinity();
+            break;
+        default:
+            return false;
+    }
+
+    if (axes_for_reduction.empty() || srcStrides.size() != src_dims.size())
+        return false;
+
+    // Only dense planar source, where the reduced axes (ignoring unit ones) form a contiguous range
+    for (size_t i = src_dims.size(), stride = 1; i > 0; i--) {
+        if (srcStrides[i - 1] != stride)
+            return false;
+        stride *= src_dims[i - 1];
+    }
+    const size_t first_axis = axes_for_reduction.front();
+    const size_t last_axis = axes_for_reduction.back();
+    for (size_t i = first_axis, j = 0; i <= last_axis; i++) {
+        if (axes_for_reduction[j] == i)
+            j++;
+        else if (src_dims[i] != 1)
+            return false;
+    }
+
+    size_t outer = 1, inner = 1;
+    for (size_t i = 0; i < first_axis; i++)
+        outer *= src_dims[i];
+    for (size_t i = last_axis + 1; i < src_dims.size(); i++)
+        inner *= src_dims[i];
+    const size_t reduced = reduced_dims_work_amount;
+    if (outer * inner != outputs[0]->size())
+        return false;
+
+    const float *src_data = inputs[REDUCE_DATA]->cbuffer().as<const float *>() +
+                            inputs[REDUCE_DATA]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+    float* dst_data = outputs[0]->buffer().as<float *>() +
+                      outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+
+    const size_t inner_block = (std::min)(inner, REDUCE_INNER_BLOCK);
+    const size_t inner_blocks = (inner + inner_block - 1) / inner_block;
+    const size_t rows_per_chunk = (std::max)(REDUCE_CHUNK_SIZE / inner_block, static_cast<size_t>(1));
+    const size_t chunks = outer * inner_blocks >= REDUCE_MIN_PARALLEL_WORK ? 1 : (reduced + rows_per_chunk - 1) / rows_per_chunk;
+
+    auto reduce_block = [&](size_t o, size_t chunk, size_t chunk_rows, size_t b, float* dst) {
+        const size_t width = (std::min)(inner_block, inner - b * inner_block);
+        std::fill(dst, dst + width, init_value);
+        XARCH::reduce_rows(src_data + (o * reduced + chunk * chunk_rows) * inner + b * inner_block,
+                           (std::min)(chunk_rows, reduced - chunk * chunk_rows), width, inner, dst, kind);
+    };
+
+    if (chunks == 1) {
+        parallel_for2d(outer, inner_blocks, [&](size_t o, size_t b) {
+            reduce_block(o, 0, reduced, b, dst_data + o * inner + b * inner_block);
+        });
+    } else {
+        std::vector<float> partial(outer * chunks * inner);
+        auto partial_ptr = [&](size_t o, size_t chunk, size_t b) {
+            return &partial[(o * chunks + chunk) * inner + b * inner_block];
+        };
+
+        parallel_for3d(outer, chunks, inner_blocks, [&](size_t o, size_t chunk, size_t b) {
+            reduce_block(o, chunk, rows_per_chunk, b, partial_ptr(o, chunk, b));
+        });
+
+        for (size_t step = 1; step < chunks; step *= 2) {
+            const size_t pairs = (chunks + 2 * step - 1) / (2 * step);
+            parallel_for3d(outer, pairs, inner_blocks, [&](size_t o, size_t pair, size_t b) {
+                const size_t chunk = pair * 2 * step;
+                if (chunk + step >= chunks)
+                    return;
+                const size_t width = (std::min)(inner_block, inner - b * inner_block);
+                XARCH::reduce_rows(partial_ptr(o, chunk + step, b), 1, width, inner, partial_ptr(o, chunk, b), combine_kind);
+            });
+        }
+
+        parallel_for(outer, [&](size_t o) {
+            std::copy_n(partial_ptr(o, 0, 0), inner, dst_data + o * inner);
+        });
+    }
+
+    const size_t work_amount_dst = outer * inner;
+    switch (reduceMode) {
+        case Reduce::L2:
+            parallel_for(work_amount_dst, [&](size_t i) {
+                dst_data[i] = sqrtf(dst_data[i]);
+            });
+            break;
+        case Reduce::LogSum:
+            parallel_for(work_amount_dst, [&](size_t i) {
+                dst_data[i] = logf(dst_data[i]);
+            });
+            break;
+        case Reduce::Mean:
+            parallel_for(work_amount_dst, [&](size_t i) {
+                dst_data[i] /= static_cast<float>(reduced);
+            });
+            break;
+        default:
+            break;
+    }
+    return true;
+}
+
 template <typename src_d, typename dst_t>
 StatusCode ReduceImpl::reduce_type(
         std::vector<Blob::Ptr>& inputs,
@@ -0,0 +1,218 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "reduce_imp.hpp"
+
+#include <cmath>
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+namespace {
+
+#if defined(HAVE_AVX512F)
+constexpr size_t vlen = 16;
+typedef __m512 vec_type;
+
+inline vec_type vec_load(const float* src) { return _mm512_loadu_ps(src); }
+inline void vec_store(float* dst, vec_type v) { _mm512_storeu_ps(dst, v); }
+inline vec_type vec_set1(float value) { return _mm512_set1_ps(value); }
+inline vec_type vec_add(vec_type a, vec_type b) { return _mm512_add_ps(a, b); }
+inline vec_type vec_mul(vec_type a, vec_type b) { return _mm512_mul_ps(a, b); }
+inline vec_type vec_fmadd(vec_type a, vec_type b, vec_type c) { return _mm512_fmadd_ps(a, b, c); }
+inline vec_type vec_max(vec_type a, vec_type b) { return _mm512_max_ps(a, b); }
+inline vec_type vec_min(vec_type a, vec_type b) { return _mm512_min_ps(a, b); }
+inline vec_type vec_abs(vec_type a) {
+    return _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(a), _mm512_set1_epi32(0x7fffffff)));
+}
+#elif defined(HAVE_AVX2)
+constexpr size_t vlen = 8;
+typedef __m256 vec_type;
+
+inline vec_type vec_load(const float* src) { return _mm256_loadu_ps(src); }
+inline void vec_store(float* dst, vec_type v) { _mm256_storeu_ps(dst, v); }
+inline vec_type vec_set1(float value) { return _mm256_set1_ps(value); }
+inline vec_type vec_add(vec_type a, vec_type b) { return _mm256_add_ps(a, b); }
+inline vec_type vec_mul(vec_type a, vec_type b) { return _mm256_mul_ps(a, b); }
+inline vec_type vec_fmadd(vec_type a, vec_type b, vec_type c) { return _mm256_fmadd_ps(a, b, c); }
+inline vec_type vec_max(vec_type a, vec_type b) { return _mm256_max_ps(a, b); }
+inline vec_type vec_min(vec_type a, vec_type b) { return _mm256_min_ps(a, b); }
+inline vec_type vec_abs(vec_type a) { return _mm256_and_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff))); }
+#elif defined(HAVE_SSE42)
+constexpr size_t vlen = 4;
+typedef __m128 vec_type;
+
+inline vec_type vec_load(const float* src) { return _mm_loadu_ps(src); }
+inline void vec_store(float* dst, vec_type v) { _mm_storeu_ps(dst, v); }
+inline vec_type vec_set1(float value) { return _mm_set1_ps(value); }
+inline vec_type vec_add(vec_type a, vec_type b) { return _mm_add_ps(a, b); }
+inline vec_type vec_mul(vec_type a, vec_type b) { return _mm_mul_ps(a, b); }
+inline vec_type vec_fmadd(vec_type a, vec_type b, vec_type c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+inline vec_type vec_max(vec_type a, vec_type b) { return _mm_max_ps(a, b); }
+inline vec_type vec_min(vec_type a, vec_type b) { return _mm_min_ps(a, b); }
+inline vec_type vec_abs(vec_type a) { return _mm_and_ps(a, _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff))); }
+#endif
+
+template <reduce_kind kind>
+struct reduce_op;
+
+template <>
+struct reduce_op<reduce_kind::Sum> {
+    static inline float apply(float acc, float v) { return acc + v; }
+    static inline float combine(float a, float b) { return a + b; }
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    static inline vec_type apply(vec_type acc, vec_type v) { return vec_add(acc, v); }
+    static inline vec_type combine(vec_type a, vec_type b) { return vec_add(a, b); }
+#endif
+    static constexpr float neutral() { return 0.f; }
+};
+
+template <>
+struct reduce_op<reduce_kind::SumAbs> {
+    static inline float apply(float acc, float v) { return acc + std::fabs(v); }
+    static inline float combine(float a, float b) { return a + b; }
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    static inline vec_type apply(vec_type acc, vec_type v) { return vec_add(acc, vec_abs(v)); }
+    static inline vec_type combine(vec_type a, vec_type b) { return vec_add(a, b); }
+#endif
+    static constexpr float neutral() { return 0.f; }
+};
+
+template <>
+struct reduce_op<reduce_kind::SumSquare> {
+    static inline float apply(float acc, float v) { return acc + v * v; }
+    static inline float combine(float a, float b) { return a + b; }
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    static inline vec_type apply(vec_type acc, vec_type v) { return vec_fmadd(v, v, acc); }
+    static inline vec_type combine(vec_type a, vec_type b) { return vec_add(a, b); }
+#endif
+    static constexpr float neutral() { return 0.f; }
+};
+
+template <>
+struct reduce_op<reduce_kind::Prod> {
+    static inline float apply(float acc, float v) { return acc * v; }
+    static inline float combine(float a, float b) { return a * b; }
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    static inline vec_type apply(vec_type acc, vec_type v) { return vec_mul(acc, v); }
+    static inline vec_type combine(vec_type a, vec_type b) { return vec_mul(a, b); }
+#endif
+    static constexpr float neutral() { return 1.f; }
+};
+
+template <>
+struct reduce_op<reduce_kind::Max> {
+    static inline float apply(float acc, float v) { return acc > v ? acc : v; }
+    static inline float combine(float a, float b) { return a > b ? a : b; }
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    static inline vec_type apply(vec_type acc, vec_type v) { return vec_max(acc, v); }
+    static inline vec_type combine(vec_type a, vec_type b) { return vec_max(a, b); }
+#endif
+    static constexpr float neutral() { return -INFINITY; }
+};
+
+template <>
+struct reduce_op<reduce_kind::Min> {
+    static inline float apply(float acc, float v) { return acc < v ? acc : v; }
+    static inline float combine(float a, float b) { return a < b ? a : b; }
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    static inline vec_type apply(vec_type acc, vec_type v) { return vec_min(acc, v); }
+    static inline vec_type combine(vec_type a, vec_type b) { return vec_min(a, b); }
+#endif
+    static constexpr float neutral() { return INFINITY; }
+};
+
+template <reduce_kind kind>
+void reduce_contiguous(const float* src, size_t n, float* dst) {
+    using op = reduce_op<kind>;
+    size_t i = 0;
+    float result = op::neutral();
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    constexpr size_t unroll = 4;
+    if (n >= unroll * vlen) {
+        vec_type acc[unroll];
+        for (size_t u = 0; u < unroll; u++)
+            acc[u] = vec_set1(op::neutral());
+        for (; i + unroll * vlen <= n; i += unroll * vlen) {
+            for (size_t u = 0; u < unroll; u++)
+                acc[u] = op::apply(acc[u], vec_load(src + i + u * vlen));
+        }
+        for (; i + vlen <= n; i += vlen)
+            acc[0] = op::apply(acc[0], vec_load(src + i));
+
+        acc[0] = op::combine(op::combine(acc[0], acc[1]), op::combine(acc[2], acc[3]));
+        float lanes[vlen];
+        vec_store(lanes, acc[0]);
+        for (size_t l = 0; l < vlen; l++)
+            result = op::combine(result, lanes[l]);
+    }
+#endif
+    for (; i < n; i++)
+        result = op::apply(result, src[i]);
+    dst[0] = op::combine(dst[0], result);
+}
+
+template <reduce_kind kind>
+void reduce_strided(const float* src, size_t rows, size_t width, size_t stride, float* dst) {
+    using op = reduce_op<kind>;
+    size_t i = 0;
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    constexpr size_t unroll = 4;
+    for (; i + unroll * vlen <= width; i += unroll * vlen) {
+        vec_type acc[unroll];
+        for (size_t u = 0; u < unroll; u++)
+            acc[u] = vec_load(dst + i + u * vlen);
+        for (size_t r = 0; r < rows; r++) {
+            const float* row = src + r * stride + i;
+            for (size_t u = 0; u < unroll; u++)
+                acc[u] = op::apply(acc[u], vec_load(row + u * vlen));
+        }
+        for (size_t u = 0; u < unroll; u++)
+            vec_store(dst + i + u * vlen, acc[u]);
+    }
+    for (; i + vlen <= width; i += vlen) {
+        vec_type acc = vec_load(dst + i);
+        for (size_t r = 0; r < rows; r++)
+            acc = op::apply(acc, vec_load(src + r * stride + i));
+        vec_store(dst + i, acc);
+    }
+#endif
+    for (; i < width; i++) {
+        float acc = dst[i];
+        for (size_t r = 0; r < rows; r++)
+            acc = op::apply(acc, src[r * stride + i]);
+        dst[i] = acc;
+    }
+}
+
+template <reduce_kind kind>
+void reduce_rows_impl(const float* src, size_t rows, size_t width, size_t stride, float* dst) {
+    if (width == 1 && stride == 1)
+        reduce_contiguous<kind>(src, rows, dst);
+    else
+        reduce_strided<kind>(src, rows, width, stride, dst);
+}
+
+}  // namespace
+
+void reduce_rows(const float* src, size_t rows, size_t width, size_t stride, float* dst, reduce_kind kind) {
+    switch (kind) {
+        case reduce_kind::Sum:       reduce_rows_impl<reduce_kind::Sum>(src, rows, width, stride, dst); break;
+        case reduce_kind::SumAbs:    reduce_rows_impl<reduce_kind::SumAbs>(src, rows, width, stride, dst); break;
+        case reduce_kind::SumSquare: reduce_rows_impl<reduce_kind::SumSquare>(src, rows, width, stride, dst); break;
+        case reduce_kind::Prod:      reduce_rows_impl<reduce_kind::Prod>(src, rows, width, stride, dst); break;
+        case reduce_kind::Max:       reduce_rows_impl<reduce_kind::Max>(src, rows, width, stride, dst); break;
+        case reduce_kind::Min:       reduce_rows_impl<reduce_kind::Min>(src, rows, width, stride, dst); break;
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
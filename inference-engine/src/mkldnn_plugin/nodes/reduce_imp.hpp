@@ -0,0 +1,39 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+/**
+ * Reduction operations supported by the vectorized kernels.
+ * SumAbs and SumSquare transform source values, their partial results are combined by Sum.
+ */
+enum class reduce_kind {
+    Sum,
+    SumAbs,
+    SumSquare,
+    Prod,
+    Max,
+    Min
+};
+
+namespace XARCH {
+
+/**
+ * Accumulates rows of the source into dst: dst[i] = op(dst[i], src[r * stride + i]) for r < rows, i < width.
+ * For width == 1 and stride == 1 the source is reduced as one contiguous row into dst[0].
+ * The order of operations depends only on the arguments, so results are reproducible.
+ */
+void reduce_rows(const float* src, size_t rows, size_t width, size_t stride, float* dst, reduce_kind kind);
+
+}  // namespace XARCH
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -3,7 +3,9 @@
 //
 
 #include "base.hpp"
+#include "topk_imp.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <cfloat>
@@ -11,6 +13,7 @@
 #include <vector>
 #include <cassert>
 #include <functional>
+#include <utility>
 #include "ie_parallel.hpp"
 #if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
 #include <immintrin.h>
@@ -76,10 +79,10 @@ public:
             else
                 mode_max = false;
 
-            if (layer->GetParamAsString("sort", "index") == "value")
-                sort_value = true;
-            else
-                sort_value = false;
+            std::string sort = layer->GetParamAsString("sort", "index");
+            sort_value = sort == "value";
+            // "none" means the order of the output elements is not defined
+            sort_none = sort == "none";
 
             int j;
             for (j = src_dims.size() - 1; j >= 0; j--) {
@@ -303,7 +306,7 @@ public:
                     }
                     s_index += after_num;
                 }
-                if (!sort_value) {
+                if (!sort_value && !sort_none) {
                     for (int i2 = 0; i2 < src_k - 1; i2++) {
                         for (int i3 = src_k - 1; i3 > i2; i3--) {
                             vmask = _mm_uni_cmpgt_i32(vmax_indexes[i3 - 1], vmax_indexes[i3]);
@@ -375,7 +378,7 @@ public:
                 }
                 s_index += after_num;
             }
-            if (!sort_value) {
+            if (!sort_value && !sort_none) {
                 for (int i2 = 0; i2 < src_k - 1; i2++) {
                     for (int i3 = src_k - 1; i3 > i2; i3--) {
                         if (std::greater<int>()(max_indexes[i3 - 1], max_indexes[i3])) {
@@ -437,7 +440,7 @@ public:
                 }
                 s_index++;
             }
-            if (!sort_value) {
+            if (!sort_value && !sort_none) {
                 for (int i2 = 0; i2 < src_k - 1; i2++) {
                     for (int i3 = src_k - 1; i3 > i2; i3--) {
                         if (std::greater<int>()(max_indexes[i3 - 1], max_indexes[i3])) {
@@ -457,6 +460,92 @@ public:
         });
     }
 
+    void store_selected(std::vector<std::pair<float, int>>& selected, float* dst_data, int* dst_idx) {
+        if (sort_value) {
+            if (mode_max)
+                std::sort(selected.begin(), selected.end(), better<std::greater>);
+            else
+                std::sort(selected.begin(), selected.end(), better<std::less>);
+        } else if (!sort_none) {
+            std::sort(selected.begin(), selected.end(), [](const std::pair<float, int>& a, const std::pair<float, int>& b) {
+                return a.second < b.second;
+            });
+        }
+        for (size_t i = 0; i < selected.size(); i++) {
+            if (dst_data)
+                dst_data[i] = selected[i].first;
+            if (dst_idx)
+                dst_idx[i] = selected[i].second;
+        }
+    }
+
+    template <template <typename> class Compare>
+    static bool better(const std::pair<float, int>& a, const std::pair<float, int>& b) {
+        if (a.first == b.first)
+            return a.second < b.second;
+        return Compare<float>()(a.first, b.first);
+    }
+
+    /**
+     * Selection for long rows: the row is scanned once against the threshold of the k-th best element
+     * and only the selected elements are sorted. If there are fewer rows than threads,
+     * each row is split between threads and partial results are merged.
+     */
+    void topk_select(const float* src_data, float* dst_data, int* dst_idx) {
+        const int nthr = parallel_get_max_threads();
+        const int chunk_min = std::max(TOPK_SELECT_MIN_CHUNK, 4 * src_k);
+        const int chunks = std::min(nthr, dim / chunk_min);
+
+        if (before_num >= nthr || chunks < 2) {
+            parallel_nt(0, [&](const int ithr, const int nthr) {
+                int start = 0, end = 0;
+                splitter(before_num, nthr, ithr, start, end);
+
+                std::vector<float> values(src_k);
+                std::vector<int> indexes(src_k);
+                std::vector<std::pair<float, int>> selected(src_k);
+                for (int i0 = start; i0 < end; i0++) {
+                    XARCH::topk_select_row(src_data + static_cast<size_t>(i0) * dim, dim, src_k, mode_max, 0,
+                                           values.data(), indexes.data());
+                    for (int i = 0; i < src_k; i++)
+                        selected[i] = std::make_pair(values[i], indexes[i]);
+                    store_selected(selected, dst_data ? dst_data + i0 * src_k : nullptr,
+                                   dst_idx ? dst_idx + i0 * src_k : nullptr);
+                }
+            });
+            return;
+        }
+
+        const int chunk_size = (dim + chunks - 1) / chunks;
+        std::vector<float> values(chunks * src_k);
+        std::vector<int> indexes(chunks * src_k);
+        std::vector<int> chunk_k(chunks);
+        std::vector<std::pair<float, int>> candidates;
+        for (int i0 = 0; i0 < before_num; i0++) {
+            const float* src_row = src_data + static_cast<size_t>(i0) * dim;
+            parallel_for(chunks, [&](int c) {
+                const int start = c * chunk_size;
+                const int len = std::min(chunk_size, dim - start);
+                chunk_k[c] = std::min(src_k, std::max(len, 0));
+                if (chunk_k[c] > 0)
+                    XARCH::topk_select_row(src_row + start, len, chunk_k[c], mode_max, start,
+                                           values.data() + c * src_k, indexes.data() + c * src_k);
+            });
+
+            candidates.clear();
+            for (int c = 0; c < chunks; c++) {
+                for (int i = 0; i < chunk_k[c]; i++)
+                    candidates.emplace_back(values[c * src_k + i], indexes[c * src_k + i]);
+            }
+            if (mode_max)
+                std::partial_sort(candidates.begin(), candidates.begin() + src_k, candidates.end(), better<std::greater>);
+            else
+                std::partial_sort(candidates.begin(), candidates.begin() + src_k, candidates.end(), better<std::less>);
+            candidates.resize(src_k);
+            store_selected(candidates, dst_data ? dst_data + i0 * src_k : nullptr, dst_idx ? dst_idx + i0 * src_k : nullptr);
+        }
+    }
+
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
         const float *src = inputs[TOPK_DATA]->cbuffer().as<float *>() +
             inputs[TOPK_DATA]->getTensorDesc().getBlockingDesc().getOffsetPadding();
@@ -524,7 +613,9 @@ public:
                     top1_axis<cmplt_ps, std::less>(src, dst_data, dst_idx, in_dims);
             }
         } else {
-            if (is_last_dim) {
+            if (is_last_dim && dim >= TOPK_SELECT_MIN_DIM && src_k <= dim / TOPK_SELECT_MAX_K_RATIO) {
+                topk_select(src, dst_data, dst_idx);
+            } else if (is_last_dim) {
                 if (mode_max)
                     topk<std::greater>(src, dst_data, dst_idx, in_dims);
                 else
@@ -555,8 +646,17 @@ private:
     int src_k = 1;
 
     bool sort_value = false;
+    bool sort_none = false;
     bool mode_max = true;
 
+    // Rows of at least this size use the threshold based selection
+    const int TOPK_SELECT_MIN_DIM = 256;
+    // The selection pays off while most elements are rejected by the vector compare with the k-th best value,
+    // so k should be at most this fraction of the row, otherwise the heap is updated too often
+    const int TOPK_SELECT_MAX_K_RATIO = 16;
+    // Minimal part of a row processed by one thread when a row is split between threads
+    const int TOPK_SELECT_MIN_CHUNK = 16384;
+
     int dim, before_num;
 
 #if defined(HAVE_AVX512F)
@@ -0,0 +1,131 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "topk_imp.hpp"
+
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+namespace {
+
+#if defined(HAVE_AVX512F)
+constexpr size_t vlen = 16;
+typedef __m512 vec_type;
+
+inline vec_type vec_load(const float* src) { return _mm512_loadu_ps(src); }
+inline vec_type vec_set1(float value) { return _mm512_set1_ps(value); }
+template <bool mode_max>
+inline unsigned vec_better_mask(vec_type v, vec_type thr) {
+    return mode_max ? _mm512_cmp_ps_mask(v, thr, _CMP_GT_OQ) : _mm512_cmp_ps_mask(v, thr, _CMP_LT_OQ);
+}
+#elif defined(HAVE_AVX2)
+constexpr size_t vlen = 8;
+typedef __m256 vec_type;
+
+inline vec_type vec_load(const float* src) { return _mm256_loadu_ps(src); }
+inline vec_type vec_set1(float value) { return _mm256_set1_ps(value); }
+template <bool mode_max>
+inline unsigned vec_better_mask(vec_type v, vec_type thr) {
+    return _mm256_movemask_ps(mode_max ? _mm256_cmp_ps(v, thr, _CMP_GT_OQ) : _mm256_cmp_ps(v, thr, _CMP_LT_OQ));
+}
+#elif defined(HAVE_SSE42)
+constexpr size_t vlen = 4;
+typedef __m128 vec_type;
+
+inline vec_type vec_load(const float* src) { return _mm_loadu_ps(src); }
+inline vec_type vec_set1(float value) { return _mm_set1_ps(value); }
+template <bool mode_max>
+inline unsigned vec_better_mask(vec_type v, vec_type thr) {
+    return _mm_movemask_ps(mode_max ? _mm_cmpgt_ps(v, thr) : _mm_cmplt_ps(v, thr));
+}
+#endif
+
+template <bool mode_max>
+inline bool better(float a_val, int a_idx, float b_val, int b_idx) {
+    if (a_val == b_val)
+        return a_idx < b_idx;
+    return mode_max ? a_val > b_val : a_val < b_val;
+}
+
+/**
+ * Heap of the k best elements found so far with the worst of them on the top,
+ * so that it is the threshold a new element has to beat.
+ */
+template <bool mode_max>
+inline void sift_down(float* values, int* indexes, int k, int pos) {
+    float val = values[pos];
+    int idx = indexes[pos];
+    while (true) {
+        int child = 2 * pos + 1;
+        if (child >= k)
+            break;
+        if (child + 1 < k && better<mode_max>(values[child], indexes[child], values[child + 1], indexes[child + 1]))
+            child++;
+        if (!better<mode_max>(val, idx, values[child], indexes[child]))
+            break;
+        values[pos] = values[child];
+        indexes[pos] = indexes[child];
+        pos = child;
+    }
+    values[pos] = val;
+    indexes[pos] = idx;
+}
+
+template <bool mode_max>
+inline void push_candidate(float* values, int* indexes, int k, float val, int idx) {
+    // Candidates come in increasing index order, so an equal value never replaces the top
+    if (mode_max ? val > values[0] : val < values[0]) {
+        values[0] = val;
+        indexes[0] = idx;
+        sift_down<mode_max>(values, indexes, k, 0);
+    }
+}
+
+template <bool mode_max>
+void select_row(const float* src, size_t n, int k, int index_base, float* values, int* indexes) {
+    for (int i = 0; i < k; i++) {
+        values[i] = src[i];
+        indexes[i] = index_base + i;
+    }
+    for (int i = k / 2 - 1; i >= 0; i--)
+        sift_down<mode_max>(values, indexes, k, i);
+
+    size_t i = static_cast<size_t>(k);
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    // Most of the elements are rejected by a single comparison of a whole vector with the threshold
+    vec_type vthr = vec_set1(values[0]);
+    for (; i + vlen <= n; i += vlen) {
+        unsigned mask = vec_better_mask<mode_max>(vec_load(src + i), vthr);
+        if (mask == 0)
+            continue;
+        for (size_t j = 0; j < vlen; j++) {
+            if (mask & (1u << j))
+                push_candidate<mode_max>(values, indexes, k, src[i + j], index_base + static_cast<int>(i + j));
+        }
+        vthr = vec_set1(values[0]);
+    }
+#endif
+    for (; i < n; i++)
+        push_candidate<mode_max>(values, indexes, k, src[i], index_base + static_cast<int>(i));
+}
+
+}  // namespace
+
+void topk_select_row(const float* src, size_t n, int k, bool mode_max, int index_base, float* values, int* indexes) {
+    if (mode_max)
+        select_row<true>(src, n, k, index_base, values, indexes);
+    else
+        select_row<false>(src, n, k, index_base, values, indexes);
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,26 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+namespace XARCH {
+
+/**
+ * Selects k best elements of a contiguous row of n values (k <= n): the largest ones if mode_max is set,
+ * the smallest ones otherwise. Among equal values the element with the smaller index is preferred.
+ * Results are written in no particular order, indexes are shifted by index_base.
+ */
+void topk_select_row(const float* src, size_t n, int k, bool mode_max, int index_base, float* values, int* indexes);
+
+}  // namespace XARCH
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -11,6 +11,8 @@ namespace MKLDNNPlugin {
 class PerfCount {
     uint64_t duration;
     uint32_t num;
+    uint64_t denormals = 0;
+    uint64_t values = 0;
 
     std::chrono::high_resolution_clock::time_point __start = {};
     std::chrono::high_resolution_clock::time_point __finish = {};
@@ -18,7 +20,19 @@ class PerfCount {
 public:
     PerfCount(): duration(0), num(0) {}
 
-    uint64_t avg() { return (num == 0) ? 0 : duration / num; }
+    // duration is accumulated in nanoseconds to keep short executions measurable, avg() is in microseconds
+    uint64_t avg() { return (num == 0) ? 0 : duration / num / 1000; }
+    // not truncated average, nodes faster than a microsecond are reported as executed by it
+    double avg_ns() { return (num == 0) ? 0. : static_cast<double>(duration) / num; }
+
+    // denormals are counted among FP32 output values only if CPU_COUNT_DENORMALS is enabled
+    void count_denormals(uint64_t denormalsNum, uint64_t valuesNum) {
+        denormals += denormalsNum;
+        values += valuesNum;
+    }
+
+    bool denormals_counted() { return values != 0; }
+    float denormals_share() { return (values == 0) ? 0.f : static_cast<float>(denormals) / values; }
 
 private:
     void start_itr() {
@@ -28,7 +42,7 @@ private:
     void finish_itr() {
         __finish = std::chrono::high_resolution_clock::now();
 
-        duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
+        duration += std::chrono::duration_cast<std::chrono::nanoseconds>(__finish - __start).count();
         num++;
     }
 
@@ -87,6 +87,12 @@ public:
         TO_STATUS(_impl->SetBatch(batch_size));
     }
 
+    StatusCode InferChunked(const BlobMap& inputs, const BlobMap& outputs, size_t chunkSize,
+                            ResponseDesc* resp) noexcept override {
+        IE_PROFILING_AUTO_SCOPE(InferChunked);
+        TO_STATUS(_impl->InferChunked(inputs, outputs, chunkSize));
+    }
+
 private:
     ~InferRequestBase() = default;
 };
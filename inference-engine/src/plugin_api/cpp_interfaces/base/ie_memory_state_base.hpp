@@ -48,6 +48,10 @@ public:
     StatusCode GetLastState(Blob::CPtr& lastState, ResponseDesc* resp) const noexcept override {
         TO_STATUS(lastState = impl->GetLastState());
     }
+
+    StatusCode SaveState(Blob::Ptr state, ResponseDesc* resp) const noexcept override {
+        TO_STATUS(impl->SaveState(state));
+    }
 };
 
 }  // namespace InferenceEngine
\ No newline at end of file
@@ -12,8 +12,12 @@
 #include <cpp_interfaces/exception2status.hpp>
 #include <ie_system_conf.h>
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <exception>
-#include <future>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -41,9 +45,24 @@ namespace InferenceEngine {
  */
 class AsyncInferRequestThreadSafeDefault : public AsyncInferRequestThreadSafeInternal {
     using AtomicCallback = std::atomic<IInferRequest::CompletionCallback>;
-    using Futures = std::vector<std::shared_future<void>>;
-    using Promise = std::shared_ptr<std::promise<void>>;
     enum Stage_e : std::uint8_t { executor, task };
+    /**
+     * @brief State of the last started pipeline is packed to a single atomic value:
+     *        a generation counter incremented by each RunFirstStage() call and a completion phase in the lower bits.
+     *        Zero state means that the pipeline was not started yet.
+     */
+    enum Phase_e : std::uint64_t { running = 0, done = 1, failed = 2, phaseMask = 3 };
+    static constexpr unsigned phaseBits = 2;
+    /**
+     * @brief A number of the last pipeline generations which completion and exceptions are kept.
+     *        The next generation can be started from the callback before the previous one is finished,
+     *        so waiters of a generation do not rely on the state of the last started pipeline only
+     */
+    static constexpr std::size_t historySize = 8;
+    /**
+     * @brief The highest bit of the active pipelines counter forbids new pipelines, it is set by StopAndWait()
+     */
+    static constexpr std::uint32_t stopFlag = 1u << 31;
     struct DisableCallbackGuard{
         explicit DisableCallbackGuard(AtomicCallback& callback)
             : _callbackRef(callback), _callback(callback.exchange(nullptr)) {}
@@ -78,6 +97,11 @@ public:
           _callbackExecutor {callbackExecutor},
           _pipeline {{taskExecutor, [this] {_syncRequest->Infer();}}},
           _syncPipeline{{std::make_shared<ImmediateExecutor>(), [this] {_syncRequest->Infer();}}} {
+        if (taskExecutor != nullptr) {
+            _chunkedPipeline = {{taskExecutor, [this] {
+                _syncRequest->InferChunked(*_chunkedInputs, *_chunkedOutputs, _chunkSize);
+            }}};
+        }
     }
 
     /**
@@ -98,37 +122,36 @@ public:
             THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str + "Timeout can't be less "
                                << IInferRequest::WaitMode::RESULT_READY << " for InferRequest::Wait\n";
         }
-        auto status = std::future_status::deferred;
-
-        // Just use the last '_futures' member to wait pipeline completion
-        auto future = [&] {
-            std::lock_guard<std::mutex> lock {_mutex};
-            return _futures.empty() ? std::shared_future<void> {} : _futures.back();
-        }();
 
-        if (!future.valid()) {
+        const auto state = _state.load();
+        if (0 == state) {
             return StatusCode::INFER_NOT_STARTED;
         }
 
-        switch (millis_timeout) {
-        case IInferRequest::WaitMode::RESULT_READY: {
-            future.wait();
-            status = std::future_status::ready;
-        } break;
-        case IInferRequest::WaitMode::STATUS_ONLY: {
-            status = future.wait_for(std::chrono::milliseconds {0});
-        } break;
-        default: {
-            status = future.wait_for(std::chrono::milliseconds {millis_timeout});
-        } break;
-        }
-
-        if (std::future_status::ready == status) {
-            future.get();
-            return StatusCode::OK;
-        } else {
-            return StatusCode::RESULT_NOT_READY;
+        if (running == (state & phaseMask)) {
+            if (IInferRequest::WaitMode::STATUS_ONLY == millis_timeout) {
+                return StatusCode::RESULT_NOT_READY;
+            }
+            const auto generation = state >> phaseBits;
+            auto isFinished = [&] {return IsFinished(generation);};
+            std::unique_lock<std::mutex> lock {_mutex};
+            ++_waiters;
+            bool finished = true;
+            if (IInferRequest::WaitMode::RESULT_READY == millis_timeout) {
+                _cv.wait(lock, isFinished);
+            } else {
+                finished = _cv.wait_for(lock, std::chrono::milliseconds {millis_timeout}, isFinished);
+            }
+            --_waiters;
+            if (!finished) {
+                return StatusCode::RESULT_NOT_READY;
+            }
+            RethrowIfFailed(generation);
+        } else if (failed == (state & phaseMask)) {
+            std::lock_guard<std::mutex> lock {_mutex};
+            RethrowIfFailed(state >> phaseBits);
         }
+        return StatusCode::OK;
     }
 
     /**
@@ -151,44 +174,37 @@ protected:
     using Pipeline = std::vector<Stage>;
 
     /**
-     * @brief Creates and run the first stage task. If destructor was not called add a new std::future to the
-     * AsyncInferRequestThreadSafeDefault::_futures list that would be used to wait
-     * AsyncInferRequestThreadSafeDefault::_pipeline finish
+     * @brief Creates and run the first stage task. If destructor was not called starts a new generation of
+     * the request completion state that is used to wait AsyncInferRequestThreadSafeDefault::_pipeline finish
+     * @note Stage tasks are created once per pipeline and reused by the following calls,
+     *       so starting of a pipeline does not allocate memory
      * @param[in]  itBeginStage Iterator to begin of pipeline
      * @param[in]  itEndStage End pipeline iterator
      * @param[in]  callbackExecutor Final or error stage executor
      */
     void RunFirstStage(const Pipeline::iterator itBeginStage, const Pipeline::iterator itEndStage,
                        const ITaskExecutor::Ptr callbackExecutor = {}) {
-        _promise = {};
-        bool stop = [&] {
-            std::lock_guard<std::mutex> lock(_mutex);
-            if (!_stop) {
-                _futures.erase(std::remove_if(std::begin(_futures), std::end(_futures),
-                                              [](const std::shared_future<void>& future) {
-                                                  if (future.valid()) {
-                                                      return (std::future_status::ready ==
-                                                              future.wait_for(std::chrono::milliseconds {0}));
-                                                  } else {
-                                                      return true;
-                                                  }
-                                              }),
-                               _futures.end());
-
-                _futures.emplace_back(_promise.get_future().share());
-            }
-            return _stop;
-        }();
-
-        if (!stop) {
-            try {
-                auto& firstStageExecutor = std::get<Stage_e::executor>(*itBeginStage);
-                IE_ASSERT(nullptr != firstStageExecutor);
-                firstStageExecutor->run(MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)));
-            } catch (...) {
-                _promise.set_exception(std::current_exception());
-                throw;
-            }
+        if (stopFlag & _activePipelines.fetch_add(1)) {
+            ReleasePipeline();
+            return;
+        }
+
+        auto generation = (_state.load() >> phaseBits) + 1;
+        _state = generation << phaseBits | running;
+        _requestCallbackExecutor = callbackExecutor;
+        _requestStatus = StatusCode::OK;
+        _requestException = nullptr;
+
+        try {
+            auto& firstStage = GetPipelineContext(itBeginStage, itEndStage)._stages.front();
+            auto& firstStageExecutor = std::get<Stage_e::executor>(*itBeginStage);
+            IE_ASSERT(nullptr != firstStageExecutor);
+            firstStageExecutor->run(firstStage._task);
+        } catch (...) {
+            SetException(generation, std::current_exception());
+            Finish(generation, true);
+            ReleasePipeline();
+            throw;
         }
     }
 
@@ -199,17 +215,9 @@ protected:
      */
     void StopAndWait() {
         _callback = nullptr;
-        {
-            std::lock_guard<std::mutex> lock(_mutex);
-            if (!_stop) {
-                _stop = true;
-                for (auto&& future : _futures) {
-                    if (future.valid()) {
-                        future.wait();
-                    }
-                }
-            }
-        }
+        std::unique_lock<std::mutex> lock(_mutex);
+        _activePipelines.fetch_or(stopFlag);
+        _cv.wait(lock, [&] {return stopFlag == _activePipelines.load();});
     }
 
     /**
@@ -236,6 +244,12 @@ protected:
     ITaskExecutor::Ptr _syncCallbackExecutor;  //!< Used to run post inference callback in synchronous pipline
     Pipeline _pipeline;  //!< Pipeline variable that should be filled by inherited class.
     Pipeline _syncPipeline;  //!< Synchronous pipeline variable that should be filled by inherited class.
+    /**
+     * @brief Runs InferRequestInternal::InferChunked as a single task on the request executor.
+     *        If it is empty, e.g. a request without an executor, every chunk is inferred by Infer_ThreadUnsafe().
+     *        Plugins which synchronous requests can't infer on their own should clear it.
+     */
+    Pipeline _chunkedPipeline;
 
     void StartAsync_ThreadUnsafe() override {
         _syncRequest->checkBlobs();
@@ -246,6 +260,24 @@ protected:
         InferUsingSync();
     }
 
+    /**
+     * @brief Runs AsyncInferRequestThreadSafeDefault::_chunkedPipeline, so there is one executor hop for the whole
+     *        sequence. Without it every chunk is inferred by Infer_ThreadUnsafe(), so chunks run through the pipeline
+     *        chosen by the plugin, e.g. plugins that implement only asynchronous inference use their asynchronous pipeline
+     */
+    void InferChunked_ThreadUnsafe(const BlobMap& inputs, const BlobMap& outputs, size_t chunkSize) override {
+        if (_chunkedPipeline.empty()) {
+            _syncRequest->InferChunks(inputs, outputs, chunkSize, [this] {Infer_ThreadUnsafe();});
+            return;
+        }
+        DisableCallbackGuard disableCallbackGuard{_callback};
+        _chunkedInputs = &inputs;
+        _chunkedOutputs = &outputs;
+        _chunkSize = chunkSize;
+        RunFirstStage(_chunkedPipeline.begin(), _chunkedPipeline.end(), _syncCallbackExecutor);
+        Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
+    }
+
     void GetPerformanceCounts_ThreadUnsafe(std::map<std::string, InferenceEngineProfileInfo>& perfMap) const override {
         _syncRequest->GetPerformanceCounts(perfMap);
     }
@@ -284,81 +316,212 @@ protected:
     }
 
 private:
+    struct PipelineContext;
     /**
-     * @brief Create a task with next pipeline stage.
-     * Each call to MakeNextStageTask() generates @ref Task objects for each stage.
-     * On last stage or if the exception is raised from `_pipeline` task
-     * the last stage task is called or passed to callback executor if it is presented. The last stage task call the
-     * callback, if it is presented, capture the `_promise` member and use it to forward completion or exception to the
-     * one of `_futures` member
-     * @param[in]  itStage Iterator to next stage of pipeline
+     * @brief Preallocated stage of a pipeline. Stage tasks capture only pointers,
+     *        so they fit into the small object buffer of @ref Task and are copied to executors without allocations
+     */
+    struct StageContext {
+        PipelineContext* _pipeline;
+        Pipeline::iterator _itStage;
+        Task _task;
+    };
+    struct PipelineContext {
+        Pipeline::iterator _itBeginStage;
+        Pipeline::iterator _itEndStage;
+        std::vector<StageContext> _stages;
+    };
+
+    /**
+     * @brief Returns preallocated stage tasks for the pipeline range.
+     * Contexts are looked up by the range, so derived classes can still replace pipelines after construction.
+     * The cache is flushed only when the previous pipeline does not run its stages any more:
+     * it is called from RunFirstStage() that is guarded by the request busy flag
+     * @param[in]  itBeginStage Iterator to begin of pipeline
      * @param[in]  itEndStage End pipeline iterator
-     * @param[in]  callbackExecutor Executor that will run final stage with callback call
-     * @return A next stage task
+     * @return A pipeline context
      */
-    Task MakeNextStageTask(const Pipeline::iterator itStage, const Pipeline::iterator itEndStage,
-                           const ITaskExecutor::Ptr callbackExecutor) {
-        return std::bind([this, itStage, itEndStage](ITaskExecutor::Ptr& callbackExecutor) mutable {
-            StatusCode requestStatus = StatusCode::OK;
-            std::exception_ptr localCurrentException = nullptr;
-            auto& thisStage = *itStage;
-            auto itNextStage = itStage + 1;
-
-            try {
-                auto& stageTask = std::get<Stage_e::task>(thisStage);
-                IE_ASSERT(nullptr != stageTask);
-                stageTask();
-               if (itEndStage != itNextStage) {
-                    auto& nextStage = *itNextStage;
-                    auto& nextStageExecutor = std::get<Stage_e::executor>(nextStage);
-                    IE_ASSERT(nullptr != nextStageExecutor);
-                    nextStageExecutor->run(MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)));
-                }
-            } catch (InferenceEngine::details::InferenceEngineException& ie_ex) {
-                requestStatus = ie_ex.hasStatus() ? ie_ex.getStatus() : StatusCode::GENERAL_ERROR;
-                localCurrentException = std::make_exception_ptr(ie_ex);
-            } catch (...) {
-                requestStatus = StatusCode::GENERAL_ERROR;
-                localCurrentException = std::current_exception();
+    PipelineContext& GetPipelineContext(const Pipeline::iterator itBeginStage, const Pipeline::iterator itEndStage) {
+        IE_ASSERT(itBeginStage != itEndStage);
+        for (auto&& pipeline : _pipelineContexts) {
+            if (pipeline->_itBeginStage == itBeginStage && pipeline->_itEndStage == itEndStage) {
+                return *pipeline;
+            }
+        }
+        // async and sync pipelines are expected, so the cache is small
+        if (_pipelineContexts.size() >= 4) {
+            _pipelineContexts.clear();
+        }
+        std::unique_ptr<PipelineContext> pipeline {new PipelineContext{itBeginStage, itEndStage, {}}};
+        pipeline->_stages.reserve(std::distance(itBeginStage, itEndStage));
+        for (auto itStage = itBeginStage; itStage != itEndStage; ++itStage) {
+            pipeline->_stages.push_back({pipeline.get(), itStage, {}});
+        }
+        for (auto&& stage : pipeline->_stages) {
+            auto stagePtr = &stage;
+            stage._task = [this, stagePtr] {RunStage(*stagePtr);};
+        }
+        _pipelineContexts.emplace_back(std::move(pipeline));
+        return *_pipelineContexts.back();
+    }
+
+    /**
+     * @brief Runs a pipeline stage task and passes the next stage task to its executor.
+     * On last stage or if the exception is raised from `_pipeline` task
+     * the last stage task is called or passed to callback executor if it is presented.
+     * @note The request object can be destroyed as soon as the last stage task is finished,
+     *       so the object is not accessed after the last stage task is called or passed to callback executor
+     * @param[in]  stage A stage to run
+     */
+    void RunStage(StageContext& stage) {
+        const auto itNextStage = stage._itStage + 1;
+        const bool isLastStage = stage._pipeline->_itEndStage == itNextStage;
+        bool hasException = false;
+        try {
+            auto& stageTask = std::get<Stage_e::task>(*stage._itStage);
+            IE_ASSERT(nullptr != stageTask);
+            stageTask();
+            if (!isLastStage) {
+                auto& nextStageExecutor = std::get<Stage_e::executor>(*itNextStage);
+                IE_ASSERT(nullptr != nextStageExecutor);
+                nextStageExecutor->run((&stage + 1)->_task);
             }
+        } catch (InferenceEngine::details::InferenceEngineException& ie_ex) {
+            _requestStatus = ie_ex.hasStatus() ? ie_ex.getStatus() : StatusCode::GENERAL_ERROR;
+            _requestException = std::make_exception_ptr(ie_ex);
+            hasException = true;
+        } catch (...) {
+            _requestStatus = StatusCode::GENERAL_ERROR;
+            _requestException = std::current_exception();
+            hasException = true;
+        }
 
-            if ((itEndStage == itNextStage) || (nullptr != localCurrentException)) {
-                auto lastStageTask = [this, requestStatus, localCurrentException]() mutable {
-                    auto promise = std::move(_promise);
-                    auto callback = _callback.load();
-                    if (setIsRequestBusy(false)) {
-                        if (nullptr != callback) {
-                            InferenceEngine::CurrentException() = localCurrentException;
-                            try {
-                                callback(_publicInterface, requestStatus);
-                            } catch (...) {
-                                localCurrentException = std::current_exception();
-                            }
-                            InferenceEngine::CurrentException() = nullptr;
-                        }
-                        if (nullptr == localCurrentException) {
-                            promise.set_value();
-                        } else {
-                            promise.set_exception(localCurrentException);
-                        }
-                    }
-                };
-
-                if (nullptr == callbackExecutor) {
-                    lastStageTask();
-                } else {
-                    callbackExecutor->run(std::move(lastStageTask));
+        if (isLastStage || hasException) {
+            auto callbackExecutor = std::move(_requestCallbackExecutor);
+            if (nullptr == callbackExecutor) {
+                RunLastStage();
+            } else {
+                callbackExecutor->run([this] {RunLastStage();});
+            }
+        }
+    }
+
+    /**
+     * @brief The last stage task calls the callback, if it is presented, and forwards completion or exception to
+     * the request completion state
+     * @note The exception is stored before the request is released, as the callback or other threads can start
+     *       the next pipeline generation right after that
+     */
+    void RunLastStage() {
+        const auto generation = _state.load() >> phaseBits;
+        auto requestStatus = _requestStatus;
+        auto localCurrentException = std::move(_requestException);
+        bool hasException = nullptr != localCurrentException;
+        if (hasException) {
+            SetException(generation, localCurrentException);
+        }
+        auto callback = _callback.load();
+        if (setIsRequestBusy(false)) {
+            if (nullptr != callback) {
+                InferenceEngine::CurrentException() = localCurrentException;
+                try {
+                    callback(_publicInterface, requestStatus);
+                } catch (...) {
+                    SetException(generation, std::current_exception());
+                    hasException = true;
                 }
+                InferenceEngine::CurrentException() = nullptr;
             }
-        }, std::move(callbackExecutor));
+        }
+        Finish(generation, hasException);
+        ReleasePipeline();
+    }
+
+    /**
+     * @brief Stores an exception of the pipeline generation to be rethrown by Wait()
+     * @param[in]  generation A generation of the pipeline
+     * @param[in]  exception An exception raised from the pipeline or the callback
+     */
+    void SetException(const std::uint64_t generation, std::exception_ptr exception) {
+        std::lock_guard<std::mutex> lock {_mutex};
+        auto& failure = _failures[generation % historySize];
+        failure.first = generation;
+        failure.second = std::move(exception);
+    }
+
+    /**
+     * @brief Marks the pipeline generation as finished and wakes up waiting threads
+     * @param[in]  generation A generation of the finished pipeline
+     * @param[in]  hasException Whether the pipeline or the callback raised an exception stored by SetException()
+     */
+    void Finish(const std::uint64_t generation, const bool hasException) {
+        _finishedGenerations[generation % historySize] = generation;
+        auto expected = generation << phaseBits | running;
+        _state.compare_exchange_strong(expected, generation << phaseBits | (hasException ? failed : done));
+        // The next pipeline could be started from the callback, so waiters of the previous one are notified anyway.
+        // Waiters check the state under the mutex, so it is locked to not miss a waiter that is going to sleep,
+        // but notified after unlock to not wake up it just to block on the mutex again
+        if (0 != _waiters.load()) {
+            { std::lock_guard<std::mutex> lock {_mutex}; }
+            _cv.notify_all();
+        }
+    }
+
+    /**
+     * @brief Decrements the active pipelines counter. It is lock-free until StopAndWait() is called.
+     */
+    void ReleasePipeline() {
+        auto activePipelines = _activePipelines.load();
+        while (0 == (stopFlag & activePipelines)) {
+            if (_activePipelines.compare_exchange_weak(activePipelines, activePipelines - 1)) {
+                return;
+            }
+        }
+        std::lock_guard<std::mutex> lock {_mutex};
+        _activePipelines.fetch_sub(1);
+        _cv.notify_all();
+    }
+
+    /**
+     * @brief Checks whether Finish() was called for the pipeline generation.
+     * A slot of the history is overwritten only by a later generation, so it never goes back
+     * @param[in]  generation A generation of the pipeline
+     * @return true if the pipeline generation is finished
+     */
+    bool IsFinished(const std::uint64_t generation) const {
+        return _finishedGenerations[generation % historySize].load() >= generation;
+    }
+
+    /**
+     * @brief Rethrows an exception of the pipeline generation if the pipeline was failed
+     * @note Should be called under AsyncInferRequestThreadSafeDefault::_mutex
+     * @param[in]  generation A generation of the pipeline
+     */
+    void RethrowIfFailed(const std::uint64_t generation) {
+        const auto& failure = _failures[generation % historySize];
+        if (generation == failure.first && nullptr != failure.second) {
+            std::rethrow_exception(failure.second);
+        }
     }
 
     void* _userData = nullptr;
+    const BlobMap* _chunkedInputs = nullptr;
+    const BlobMap* _chunkedOutputs = nullptr;
+    size_t _chunkSize = 0;
     AtomicCallback _callback = {nullptr};
     IInferRequest::Ptr _publicInterface;
-    std::promise<void> _promise;
+    std::vector<std::unique_ptr<PipelineContext>> _pipelineContexts;
+    // Per pipeline run data, it is passed between stages by executors
+    ITaskExecutor::Ptr _requestCallbackExecutor;
+    StatusCode _requestStatus = StatusCode::OK;
+    std::exception_ptr _requestException;
+    // Completion state of the last started pipeline
+    std::atomic<std::uint64_t> _state = {0};
+    std::atomic<std::uint32_t> _activePipelines = {0};
+    std::atomic<std::uint32_t> _waiters = {0};
+    std::array<std::atomic<std::uint64_t>, historySize> _finishedGenerations = {};
+    std::array<std::pair<std::uint64_t, std::exception_ptr>, historySize> _failures;
     mutable std::mutex _mutex;
-    Futures _futures;
-    bool _stop = false;
+    std::condition_variable _cv;
 };
 }  // namespace InferenceEngine
@@ -131,6 +131,17 @@ public:
         SetBatch_ThreadUnsafe(batch);
     };
 
+    void InferChunked(const BlobMap& inputs, const BlobMap& outputs, size_t chunkSize) override {
+        if (setIsRequestBusy(true)) ThrowBusy();
+        try {
+            InferChunked_ThreadUnsafe(inputs, outputs, chunkSize);
+        } catch (...) {
+            setIsRequestBusy(false);
+            throw;
+        }
+        setIsRequestBusy(false);
+    }
+
 protected:
     /**
      * @brief Starts an asynchronous pipeline thread unsafe.
@@ -170,6 +181,16 @@ protected:
      */
     virtual void Infer_ThreadUnsafe() = 0;
 
+    /**
+     * @brief Performs chunked inference of a sequence in syncronous mode
+     * @note Used by AsyncInferRequestThreadSafeInternal::InferChunked which ensures thread-safety
+     *       and calls this method after.
+     * @param[in] inputs  The input sequences
+     * @param[in] outputs The preallocated output sequences
+     * @param[in] chunkSize The number of sequence elements inferred at once
+     */
+    virtual void InferChunked_ThreadUnsafe(const BlobMap& inputs, const BlobMap& outputs, size_t chunkSize) = 0;
+
     /**
      * @brief Gets the performance counts thread unsafe.
      * @note Used by AsyncInferRequestThreadSafeInternal::GetPerformanceCounts which ensures thread-safety
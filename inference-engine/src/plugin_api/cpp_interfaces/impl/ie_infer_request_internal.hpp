@@ -6,10 +6,13 @@
 
 #include <ie_icnn_network.hpp>
 #include <ie_input_info.hpp>
+#include <algorithm>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "cpp_interfaces/exception2status.hpp"
 #include "cpp_interfaces/interface/ie_iinfer_request_internal.hpp"
@@ -222,6 +225,81 @@ public:
         THROW_IE_EXCEPTION << "Dynamic batch is not supported";
     };
 
+    /**
+     * @brief Default implementation of chunked inference, every chunk is inferred by Infer()
+     * @param inputs - a map of input names to blobs with input sequences along the outermost dimension.
+     * @param outputs - a map of output names to preallocated blobs for output sequences.
+     * @param chunkSize - a number of sequence elements inferred at once, it is the first dimension of network inputs.
+     */
+    void InferChunked(const BlobMap& inputs, const BlobMap& outputs, size_t chunkSize) override {
+        InferChunks(inputs, outputs, chunkSize, [this] {Infer();});
+    }
+
+    /**
+     * @brief Infers sequences chunk by chunk. Inputs and outputs of every chunk are set as blobs
+     * which point to slices of the sequences, so plugins which use user blobs in-place don't copy the data.
+     * A blob of every sequence is created once and its data pointer is moved to the next chunk, it is set
+     * again only to let plugins update the pointer. Previously set blobs are restored after the last chunk.
+     * @note Asynchronous requests pass their own inference of a chunk, so chunks run through the plugin pipeline
+     * @param inputs - a map of input names to blobs with input sequences along the outermost dimension.
+     * @param outputs - a map of output names to preallocated blobs for output sequences.
+     * @param chunkSize - a number of sequence elements inferred at once, it is the first dimension of network inputs.
+     * @param infer - infers a single chunk which blobs are set to the request
+     */
+    void InferChunks(const BlobMap& inputs, const BlobMap& outputs, size_t chunkSize,
+                     const std::function<void()>& infer) {
+        IE_PROFILING_AUTO_SCOPE(InferChunked)
+        if (chunkSize == 0) {
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Chunk size can't be zero";
+        }
+
+        size_t numChunks = 0;
+        std::vector<std::pair<std::string, Blob::Ptr>> savedBlobs;
+        std::vector<ChunkView> views;
+        for (const auto& blobs : {&inputs, &outputs}) {
+            for (const auto& blob : *blobs) {
+                const size_t blobChunks = getNumChunks(blob.first, blob.second, chunkSize);
+                if (numChunks != 0 && blobChunks != numChunks) {
+                    THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Blob '" << blob.first << "' has " << blobChunks
+                                       << " chunks while other blobs have " << numChunks;
+                }
+                numChunks = blobChunks;
+
+                Blob::Ptr savedBlob;
+                GetBlob(blob.first.c_str(), savedBlob);
+                savedBlobs.emplace_back(blob.first, savedBlob);
+                views.push_back(makeChunkView(blob.first, blob.second, chunkSize, blobs == &inputs));
+            }
+        }
+
+        auto restoreBlobs = [&] {
+            for (const auto& savedBlob : savedBlobs) {
+                SetBlob(savedBlob.first.c_str(), savedBlob.second);
+            }
+        };
+
+        try {
+            for (size_t chunk = 0; chunk < numChunks; ++chunk) {
+                for (auto& view : views) {
+                    view.allocator->rebind(view.sequence + chunk * view.chunkBytes);
+                    SetBlob(view.name.c_str(), view.blob);
+                }
+                if (chunk + 1 < numChunks) {
+                    for (const auto& view : views) {
+                        if (view.isInput) {
+                            prefetchChunk(view.sequence + (chunk + 1) * view.chunkBytes, view.chunkBytes);
+                        }
+                    }
+                }
+                infer();
+            }
+        } catch (...) {
+            restoreBlobs();
+            throw;
+        }
+        restoreBlobs();
+    }
+
     /**
      * @brief Checks and executes input data pre-processing if needed.
      * @param inputs Inputs blobs to perform preprocessing on
@@ -253,6 +331,142 @@ protected:
      */
     std::shared_ptr<ExecutableNetworkInternal> _exeNetwork;
 
+    /**
+     * @brief Checks that a sequence blob matches the network input or output and returns the number of chunks in it
+     * @param name A name of input or output blob.
+     * @param blob A blob with the sequence.
+     * @param chunkSize A number of sequence elements inferred at once.
+     * @return The number of chunks
+     */
+    size_t getNumChunks(const std::string& name, const Blob::Ptr& blob, size_t chunkSize) const {
+        InputInfo::Ptr foundInput;
+        DataPtr foundOutput;
+        const SizeVector networkDims = findInputAndOutputBlobByName(name.c_str(), foundInput, foundOutput)
+            ? foundInput->getTensorDesc().getDims()
+            : foundOutput->getTensorDesc().getDims();
+
+        if (blob == nullptr || blob->buffer() == nullptr) {
+            THROW_IE_EXCEPTION << NOT_ALLOCATED_str << "Sequence blob '" << name << "' is not allocated";
+        }
+        const auto& desc = blob->getTensorDesc();
+        const auto& dims = desc.getDims();
+        const auto& blockingDesc = desc.getBlockingDesc();
+        if (networkDims.empty() || networkDims[0] != chunkSize) {
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "The first dimension of '" << name
+                               << "' is not equal to the chunk size " << chunkSize;
+        }
+        if (dims.size() != networkDims.size() || !std::equal(dims.begin() + 1, dims.end(), networkDims.begin() + 1) ||
+            dims[0] % chunkSize != 0) {
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Sequence blob '" << name
+                               << "' can't be split to chunks of size " << chunkSize;
+        }
+        // chunks must be dense slices along the outermost dimension
+        if (blockingDesc.getOrder()[0] != 0 || blockingDesc.getOffsetPadding() != 0 ||
+            blockingDesc.getStrides()[0] * blockingDesc.getBlockDims()[0] != blob->size()) {
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Sequence blob '" << name
+                               << "' must be dense along the outermost dimension";
+        }
+        return dims[0] / chunkSize;
+    }
+
+    /**
+     * @brief Allocator of a chunk blob which memory is moved along the sequence without creating a new blob
+     */
+    class ChunkAllocator : public IAllocator {
+    public:
+        explicit ChunkAllocator(uint8_t* data): _data(data) {}
+
+        void* lock(void*, LockOp = LOCK_FOR_WRITE) noexcept override {
+            return _data;
+        }
+
+        void unlock(void*) noexcept override {}  // NOLINT
+
+        void* alloc(size_t) noexcept override {
+            return _data;
+        }
+
+        bool free(void*) noexcept override {  // NOLINT
+            return false;
+        }
+
+        void Release() noexcept override {
+            delete this;
+        }
+
+        void rebind(uint8_t* data) noexcept {
+            _data = data;
+        }
+
+    protected:
+        ~ChunkAllocator() override = default;
+
+    private:
+        uint8_t* _data;
+    };
+
+    /**
+     * @brief A blob of the current chunk of a sequence
+     */
+    struct ChunkView {
+        std::string name;
+        Blob::Ptr blob;
+        std::shared_ptr<ChunkAllocator> allocator;
+        uint8_t* sequence;
+        size_t chunkBytes;
+        bool isInput;
+    };
+
+    /**
+     * @brief Creates a blob which points to the first chunk of the sequence without copying the data
+     * @param name A name of input or output blob.
+     * @param blob A blob with the sequence.
+     * @param chunkSize A number of sequence elements in a chunk.
+     * @param isInput Whether the sequence is an input.
+     * @return A view of the chunk
+     */
+    static ChunkView makeChunkView(const std::string& name, const Blob::Ptr& blob, size_t chunkSize, bool isInput) {
+        const auto& desc = blob->getTensorDesc();
+        const auto& blockingDesc = desc.getBlockingDesc();
+
+        auto dims = desc.getDims();
+        dims[0] = chunkSize;
+        auto blockDims = blockingDesc.getBlockDims();
+        blockDims[0] = chunkSize;
+        const BlockingDesc chunkBlockingDesc(blockDims, blockingDesc.getOrder(), 0,
+                                             blockingDesc.getOffsetPaddingToData(), blockingDesc.getStrides());
+
+        ChunkView view;
+        view.name = name;
+        view.sequence = blob->buffer().as<uint8_t*>();
+        view.chunkBytes = chunkSize * blockingDesc.getStrides()[0] * desc.getPrecision().size();
+        view.isInput = isInput;
+        view.allocator = details::shared_from_irelease(new ChunkAllocator(view.sequence));
+        view.blob = make_blob_with_precision(TensorDesc(desc.getPrecision(), dims, chunkBlockingDesc), view.allocator);
+        view.blob->allocate();
+        return view;
+    }
+
+    /**
+     * @brief Hints the CPU to load the beginning of the next input chunk while the current one is inferred
+     * @param data A pointer to the chunk.
+     * @param bytes A size of the chunk in bytes.
+     */
+    static void prefetchChunk(const uint8_t* data, size_t bytes) {
+#if defined(__GNUC__)
+        // the rest of a large chunk is brought by the hardware prefetcher once it is read sequentially
+        constexpr size_t maxPrefetchBytes = 64 * 1024;
+        constexpr size_t cacheLineBytes = 64;
+        const size_t prefetchBytes = std::min(bytes, maxPrefetchBytes);
+        for (size_t offset = 0; offset < prefetchBytes; offset += cacheLineBytes) {
+            __builtin_prefetch(data + offset, 0, 2);
+        }
+#else
+        (void)data;
+        (void)bytes;
+#endif
+    }
+
     /**
      * @brief Helper function to find input or output blob by name
      * @param name A name of input or output blob.
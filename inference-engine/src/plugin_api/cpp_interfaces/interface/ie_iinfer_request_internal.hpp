@@ -83,6 +83,14 @@ public:
      * @param batch - new batch size to be used by all the following inference calls for this request.
      */
     virtual void SetBatch(int batch) = 0;
+
+    /**
+     * @brief Infers a long sequence chunk by chunk in synchronous mode keeping the network state between chunks
+     * @param inputs - a map of input names to blobs with input sequences along the outermost dimension.
+     * @param outputs - a map of output names to preallocated blobs for output sequences.
+     * @param chunkSize - a number of sequence elements inferred at once, it is the first dimension of network inputs.
+     */
+    virtual void InferChunked(const BlobMap& inputs, const BlobMap& outputs, size_t chunkSize) = 0;
 };
 
 }  // namespace InferenceEngine
@@ -6,6 +6,7 @@
 
 #include <ie_blob.h>
 
+#include <cstring>
 #include <memory>
 #include <string>
 
@@ -24,6 +25,18 @@ public:
     virtual void Reset() = 0;
     virtual void SetState(Blob::Ptr newState) = 0;
     virtual Blob::CPtr GetLastState() const = 0;
+
+    /**
+     * @brief Copies the last state to a caller-provided blob
+     * @param state A blob of the same size as the state
+     */
+    virtual void SaveState(Blob::Ptr state) const {
+        auto lastState = GetLastState();
+        if (!lastState || !state || lastState->byteSize() != state->byteSize()) {
+            THROW_IE_EXCEPTION << "Cannot save state " << GetName() << " to a blob of a different size";
+        }
+        std::memcpy(state->buffer(), lastState->cbuffer(), state->byteSize());
+    }
 };
 
 }  // namespace InferenceEngine
@@ -53,4 +53,21 @@ static const char OUTPUT_LAYOUTS[] = "outputLayouts";
  */
 static const char EXECUTION_ORDER[] = "execOrder";
 
+/**
+ * @brief A general key for CNNLayer::params map. Used to get a share of denormal values among FP32 outputs
+ *        of the executable primitive. Set only if counting of denormals is enabled in the plugin.
+ */
+static const char OUTPUT_DENORMALS_SHARE[] = "outputDenormalsShare";
+
+/**
+ * @brief A general key for CNNLayer::params map. Used to get a precision the executable primitive computes in.
+ */
+static const char RUNTIME_PRECISION[] = "runtimePrecision";
+
+/**
+ * @brief A general key for CNNLayer::params map. Used to get a precision constant weights of the executable primitive
+ *        are stored in. Set only if the primitive keeps weights in a precision other than its input precision.
+ */
+static const char WEIGHTS_PRECISION[] = "weightsPrecision";
+
 }  // namespace ExecGraphInfoSerialization
@@ -16,7 +16,8 @@
 /**
  * @brief      Copies bytes between buffers with security enhancements
  *             Copies count bytes from src to dest. If the source and destination
- *             overlap, the behavior is undefined.
+ *             overlap, the behavior is undefined. Large copies are split between the threads
+ *             of the current stream and bypass the cache with non-temporal stores.
  * @ingroup    ie_dev_api_memory 
  * 
  * @param dest A Pointer to the object to copy to
@@ -44,6 +44,81 @@ INFERENCE_ENGINE_API_CPP(std::vector<int>) getAvailableNUMANodes();
  */
 INFERENCE_ENGINE_API_CPP(int) getNumberOfCPUCores();
 
+/**
+ * @brief      Describes how logical processors available to the process are grouped into physical cores,
+ *             shared caches and NUMA nodes
+ * @ingroup    ie_dev_api_system_conf
+ */
+class INFERENCE_ENGINE_API_CLASS(CPUTopology) {
+public:
+    /**
+     * @brief A logical processor. Domains are identified by the smallest processor id in them
+     */
+    struct Processor {
+        int id       = 0;  //!< A processor number as used in affinity masks
+        int core     = 0;  //!< A physical core, processors of the same core are SMT siblings
+        int l2       = 0;  //!< A group of processors sharing L2 cache
+        int l3       = 0;  //!< A group of processors sharing L3 (last level) cache
+        int numaNode = 0;  //!< A NUMA node
+    };
+
+    /**
+     * @brief      Default constructor, creates empty topology
+     */
+    CPUTopology() = default;
+
+    /**
+     * @brief      Builds the topology from the list of processors
+     * @param[in]  processors  Logical processors available to the process
+     */
+    explicit CPUTopology(std::vector<Processor> processors);
+
+    /**
+     * @brief      Returns logical processors sorted by id
+     * @return     A vector of processors
+     */
+    const std::vector<Processor>& getProcessors() const;
+
+    /**
+     * @brief      Returns ids of processors in the order threads should be placed on them: one thread per
+     *             physical core first, with neighbouring cores sharing a NUMA node and L3 cache, and only then
+     *             the SMT siblings in the same order
+     * @return     A vector of processor ids
+     */
+    const std::vector<int>& getPlacementOrder() const;
+
+    /**
+     * @brief      Returns number of physical cores
+     * @return     Number of cores
+     */
+    int getCoresNumber() const;
+
+    /**
+     * @brief      Returns number of physical cores in every L3 cache domain in the placement order
+     * @return     A vector of cores numbers
+     */
+    std::vector<int> getCoresPerL3Domain() const;
+
+    /**
+     * @brief      Returns ids of NUMA nodes which have available processors
+     * @return     A vector of NUMA nodes ids
+     */
+    std::vector<int> getNUMANodes() const;
+
+private:
+    std::vector<Processor> _processors;
+    std::vector<int>       _placementOrder;
+    int                    _cores = 0;
+};
+
+/**
+ * @brief      Returns the topology of processors the process is allowed to run on. On Linux it is read from
+ *             /sys/devices/system, on other OSes every logical processor is considered as a separate core
+ * @ingroup    ie_dev_api_system_conf
+ * @return     The CPU topology detected on the first call
+ */
+INFERENCE_ENGINE_API_CPP(const CPUTopology&) getCPUTopology();
+
 /**
  * @brief      Checks whether CPU supports SSE 4.2 capability
  * @ingroup    ie_dev_api_system_conf
@@ -65,6 +140,13 @@ INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_avx();
  */
 INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_avx2();
 
+/**
+ * @brief      Checks whether CPU supports F16C capability
+ * @ingroup    ie_dev_api_system_conf
+ * @return     `True` is F16C (FP16 conversion) instructions are available, `false` otherwise
+ */
+INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_f16c();
+
 /**
  * @brief      Checks whether CPU supports AVX 512 capability
  * @ingroup    ie_dev_api_system_conf
@@ -79,6 +161,13 @@ INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_avx512f();
  */
 INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_avx512_core();
 
+/**
+ * @brief      Checks whether CPU supports AVX 512 VNNI capability
+ * @ingroup    ie_dev_api_system_conf
+ * @return     `True` is AVX512F, AVX512BW, AVX512DQ, AVX512VL and AVX512_VNNI instructions are available, `false` otherwise
+ */
+INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_avx512_core_vnni();
+
 /**
  * @brief      Checks whether CPU supports BFloat16 capability
  * @ingroup    ie_dev_api_system_conf
@@ -86,4 +175,15 @@ INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_avx512_core();
  */
 INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_bfloat16();
 
+/**
+ * @brief      Enables or disables flush-to-zero and denormals-are-zero modes of the current thread.
+ *             In these modes denormal results of floating point operations are replaced by zeros and
+ *             denormal operands are treated as zeros, so the operations don't fall into slow microcode paths.
+ * @ingroup    ie_dev_api_system_conf
+ * @param[in]  on    `true` to enable the modes, `false` to disable them
+ * @return     `true` if both modes were enabled before the call, `false` otherwise.
+ *             The call does nothing and returns `false` on CPUs without SSE control register
+ */
+INFERENCE_ENGINE_API_CPP(bool) set_denormals_as_zero(bool on);
+
 }  // namespace InferenceEngine
@@ -3,7 +3,7 @@
 //
 
 /**
- * @brief Basic functions to convert from FP16 to FP32 and vice versa
+ * @brief Basic functions to convert from FP16 and BF16 to FP32 and vice versa
  * @file precision_utils.h
  */
 
@@ -71,6 +71,12 @@ namespace InferenceEngine {
  */
 using ie_fp16 = short;
 
+/**
+ * @brief A type definition for BF16 data type. Defined as a signed short
+ * @ingroup ie_dev_api_precision
+ */
+using ie_bf16 = short;
+
 /**
  * @brief Namespace for precision utilities
  * @ingroup ie_dev_api_precision
@@ -95,9 +101,30 @@ INFERENCE_ENGINE_API_CPP(ie_fp16) f32tof16(float x);
  */
 INFERENCE_ENGINE_API_CPP(float) f16tof32(ie_fp16 x);
 
+/**
+ * @brief      Converts a single-precision floating point value to a bfloat16 value
+ *             rounding it to nearest even like ngraph::bfloat16
+ * @ingroup    ie_dev_api_precision
+ *
+ * @param[in]  x     A single-precision floating point value
+ * @return     A bfloat16 value
+ */
+INFERENCE_ENGINE_API_CPP(ie_bf16) f32tobf16(float x);
+
+/**
+ * @brief      Converts a bfloat16 value to a single-precision floating point value
+ * @ingroup    ie_dev_api_precision
+ *
+ * @param[in]  x     A bfloat16 value
+ * @return     A single-precision floating point value
+ */
+INFERENCE_ENGINE_API_CPP(float) bf16tof32(ie_bf16 x);
+
 /**
  * @brief      Converts a half-precision floating point array to single-precision floating point array
  * 	           and applies `scale` and `bias` is needed
+ * @details    Uses F16C or AVX-512 instructions if they are supported by the CPU and splits large arrays
+ *             between the threads of the current stream
  * @ingroup    ie_dev_api_precision
  *
  * @param      dst    A destination array of single-precision floating point values
@@ -112,6 +139,7 @@ f16tof32Arrays(float* dst, const ie_fp16* src, size_t nelem, float scale = 1.f,
 /**
  * @brief      Converts a single-precision floating point array to a half-precision floating point array
  *             and applies `scale` and `bias` if needed 
+ * @details    The vectorized paths produce the same values as f32tof16 applied to every element
  * @ingroup    ie_dev_api_precision
  *
  * @param      dst    A destination array of half-precision floating point values
@@ -123,6 +151,29 @@ f16tof32Arrays(float* dst, const ie_fp16* src, size_t nelem, float scale = 1.f,
 INFERENCE_ENGINE_API_CPP(void)
 f32tof16Arrays(ie_fp16* dst, const float* src, size_t nelem, float scale = 1.f, float bias = 0.f);
 
+/**
+ * @brief      Converts a bfloat16 array to a single-precision floating point array
+ * @ingroup    ie_dev_api_precision
+ *
+ * @param      dst    A destination array of single-precision floating point values
+ * @param[in]  src    A source array of bfloat16 values
+ * @param[in]  nelem  A number of elements in arrays
+ */
+INFERENCE_ENGINE_API_CPP(void)
+bf16tof32Arrays(float* dst, const ie_bf16* src, size_t nelem);
+
+/**
+ * @brief      Converts a single-precision floating point array to a bfloat16 array
+ * @details    The vectorized paths produce the same values as f32tobf16 applied to every element
+ * @ingroup    ie_dev_api_precision
+ *
+ * @param      dst    A destination array of bfloat16 values
+ * @param[in]  src    A source array of single-precision floating point values
+ * @param[in]  nelem  A number of elements in arrays
+ */
+INFERENCE_ENGINE_API_CPP(void)
+f32tobf16Arrays(ie_bf16* dst, const float* src, size_t nelem);
+
 }  // namespace PrecisionUtils
 
 }  // namespace InferenceEngine
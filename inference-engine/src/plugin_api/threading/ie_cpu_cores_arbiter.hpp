@@ -0,0 +1,110 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_cpu_cores_arbiter.hpp
+ * @brief A header file for the process-wide CPU cores arbiter
+ */
+
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <mutex>
+
+#include "ie_api.h"
+
+namespace InferenceEngine {
+
+/**
+ * @class CPUCoresArbiter
+ * @ingroup ie_dev_api_threading
+ * @brief Splits CPU cores of the process between streams executors which bind threads to cores.
+ *        Each executor acquires a share with a weight. The cores are divided into contiguous, disjoint
+ *        partitions proportional to the weights of all active shares. Partitions are rebalanced
+ *        every time a share is acquired or released. Every share gets at least one core, so
+ *        partitions overlap only if there are more shares than cores.
+ *        Executors without a share get starting cores one after another, so they don't all start at the first core.
+ */
+class INFERENCE_ENGINE_API_CLASS(CPUCoresArbiter) {
+public:
+    /**
+     * @brief A range of cores in the space of thread binding offsets (see IStreamsExecutor::Config::_threadBindingOffset)
+     */
+    struct Partition {
+        int offset = 0;  //!< The first core of the partition
+        int size   = 0;  //!< Number of cores in the partition
+    };
+
+    /**
+     * @brief Constructor
+     * @param cores Number of cores to distribute. If zero, the number of physical CPU cores is used
+     */
+    explicit CPUCoresArbiter(int cores = 0);
+
+    /**
+     * @brief Registers a new share and rebalances partitions
+     * @param weight A positive weight of the share
+     * @return An identifier of the share
+     */
+    int acquire(int weight);
+
+    /**
+     * @brief Unregisters the share and rebalances partitions of the remaining shares
+     * @param id An identifier returned by acquire()
+     */
+    void release(int id);
+
+    /**
+     * @brief Returns the current partition of the share
+     * @param id An identifier returned by acquire()
+     * @return The partition, or the whole set of cores if the share is unknown
+     */
+    Partition getPartition(int id) const;
+
+    /**
+     * @brief Returns the number of cores a share with the given weight would get if it was acquired now
+     * @param weight A positive weight of the share
+     * @return Number of cores
+     */
+    int quote(int weight) const;
+
+    /**
+     * @brief Returns a counter incremented on every rebalancing. It is read without locking,
+     *        so bound threads can cheaply check whether they have to be pinned again
+     * @return The number of rebalancings
+     */
+    unsigned getGeneration() const;
+
+    /**
+     * @brief Returns the first core for an executor without a share. Consecutive calls return
+     *        consecutive ranges of cores, wrapping around the number of cores
+     * @param threads Number of threads the executor binds
+     * @return The first core of the range
+     */
+    int nextOffset(int threads);
+
+    /**
+     * @brief Returns the number of distributed cores
+     * @return Number of cores
+     */
+    int getCoresNumber() const;
+
+private:
+    struct Share {
+        int weight;
+        Partition partition;
+    };
+
+    void rebalance();
+
+    int _cores = 0;
+    int _nextId = 0;
+    int _nextOffset = 0;
+    std::atomic<unsigned> _generation{0};
+    std::map<int, Share> _shares;
+    mutable std::mutex _mutex;
+};
+
+}  // namespace InferenceEngine
@@ -17,6 +17,7 @@
 
 #include "threading/ie_itask_executor.hpp"
 #include "threading/ie_istreams_executor.hpp"
+#include "threading/ie_cpu_cores_arbiter.hpp"
 #include "ie_api.h"
 
 namespace InferenceEngine {
@@ -30,6 +31,8 @@ public:
 
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    CPUCoresArbiter& getCoresArbiter();
+
     // for tests purposes
     size_t getExecutorsNumber();
 
@@ -43,6 +46,7 @@ private:
     std::vector<std::pair<IStreamsExecutor::Config, IStreamsExecutor::Ptr> > cpuStreamsExecutors;
     std::mutex streamExecutorMutex;
     std::mutex taskExecutorMutex;
+    CPUCoresArbiter coresArbiter;
 };
 
 /**
@@ -84,6 +88,12 @@ public:
     /// @private
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    /**
+     * @brief Returns the process-wide arbiter which splits CPU cores between streams executors
+     * @return A reference to the arbiter
+     */
+    CPUCoresArbiter& getCoresArbiter();
+
     /**
      * @cond
      */
@@ -75,6 +75,11 @@ public:
         int                _threadBindingStep       = 1;  //!< In case of @ref CORES binding offset type thread binded to cores with defined step
         int                _threadBindingOffset     = 0;  //!< In case of @ref CORES binding offset type thread binded to cores starting from offset
         int                _threads                 = 0;  //!< Number of threads distributed between streams. Reserved. Should not be used.
+        int                _coresWeight             = 0;  //!< In case of @ref CORES binding a positive weight makes the executor
+                                                              //!< bind threads to its own partition of cores given by CPUCoresArbiter
+                                                              //!< instead of using @ref _threadBindingOffset
+        bool               _denormalsAsZero         = false;  //!< Enables flush-to-zero and denormals-are-zero modes
+                                                                  //!< on all the threads that execute the executor tasks
 
         /**
          * @brief      A constructor with arguments
@@ -0,0 +1,598 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_binary_ir.hpp"
+
+#include <ie_common.h>
+#include <details/ie_exception.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <ngraph/ngraph.hpp>
+#include <ngraph/opsets/opset.hpp>
+#include <ngraph/variant.hpp>
+
+namespace InferenceEngine {
+namespace BinaryIR {
+namespace {
+
+constexpr char magic[8] = {'I', 'E', 'B', 'I', 'N', 'I', 'R', '\0'};
+constexpr uint32_t formatVersion = 1;
+// Constant section is page aligned and every constant is aligned to a cache line
+constexpr uint64_t constantsAlignment = 4096;
+constexpr uint64_t constantAlignment = 64;
+
+struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t headerSize;
+    uint64_t graphOffset;
+    uint64_t graphSize;
+    uint64_t constantsOffset;
+    uint64_t constantsSize;
+};
+
+enum class AttributeKind : uint8_t {
+    Bool,
+    Int64,
+    Double,
+    String,
+    Int8Vector,
+    Int16Vector,
+    Int32Vector,
+    Int64Vector,
+    UInt8Vector,
+    UInt16Vector,
+    UInt32Vector,
+    UInt64Vector,
+    FloatVector,
+    DoubleVector,
+    StringVector,
+    Data
+};
+
+template <typename T> struct VectorKind;
+template <> struct VectorKind<int8_t> { static constexpr AttributeKind value = AttributeKind::Int8Vector; };
+template <> struct VectorKind<int16_t> { static constexpr AttributeKind value = AttributeKind::Int16Vector; };
+template <> struct VectorKind<int32_t> { static constexpr AttributeKind value = AttributeKind::Int32Vector; };
+template <> struct VectorKind<int64_t> { static constexpr AttributeKind value = AttributeKind::Int64Vector; };
+template <> struct VectorKind<uint8_t> { static constexpr AttributeKind value = AttributeKind::UInt8Vector; };
+template <> struct VectorKind<uint16_t> { static constexpr AttributeKind value = AttributeKind::UInt16Vector; };
+template <> struct VectorKind<uint32_t> { static constexpr AttributeKind value = AttributeKind::UInt32Vector; };
+template <> struct VectorKind<uint64_t> { static constexpr AttributeKind value = AttributeKind::UInt64Vector; };
+template <> struct VectorKind<float> { static constexpr AttributeKind value = AttributeKind::FloatVector; };
+template <> struct VectorKind<double> { static constexpr AttributeKind value = AttributeKind::DoubleVector; };
+
+uint64_t alignUp(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+std::map<std::string, ngraph::OpSet> getOpSets(const std::vector<IExtensionPtr>& exts) {
+    std::map<std::string, ngraph::OpSet> opsets;
+    opsets["opset1"] = ngraph::get_opset1();
+    opsets["opset2"] = ngraph::get_opset2();
+    opsets["opset3"] = ngraph::get_opset3();
+
+    for (const auto& ext : exts) {
+        for (const auto& it : ext->getOpSets()) {
+            if (opsets.find(it.first) != opsets.end())
+                THROW_IE_EXCEPTION << "Cannot add opset with name: " << it.first << ". Opset with the same name already exists.";
+            opsets[it.first] = it.second;
+        }
+    }
+    return opsets;
+}
+
+/**
+ * @brief Appends plain values to the in-memory graph section
+ */
+class GraphWriter {
+public:
+    template <typename T>
+    void write(const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values are written as is");
+        buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void writeString(const std::string& value) {
+        write(static_cast<uint32_t>(value.size()));
+        buffer.append(value);
+    }
+
+    template <typename T>
+    void writeVector(const std::vector<T>& values) {
+        write(static_cast<uint32_t>(values.size()));
+        buffer.append(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+    }
+
+    void append(const GraphWriter& other) {
+        buffer.append(other.buffer);
+    }
+
+    const std::string& data() const {
+        return buffer;
+    }
+
+private:
+    std::string buffer;
+};
+
+/**
+ * @brief Reads plain values from the in-memory graph section, every read is bounds checked
+ */
+class GraphReader {
+public:
+    GraphReader(const char* begin, const char* end): ptr(begin), end(end) {}
+
+    template <typename T>
+    T read() {
+        T value;
+        std::memcpy(&value, take(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    std::string readString() {
+        const auto size = read<uint32_t>();
+        return std::string(take(size), size);
+    }
+
+    /**
+     * @brief Reads a number of elements, each of them takes at least elementSize bytes. The number is checked
+     * against the remaining bytes, so a corrupted number doesn't make the caller allocate memory for the elements
+     */
+    uint32_t readCount(size_t elementSize) {
+        const auto count = read<uint32_t>();
+        if (static_cast<size_t>(end - ptr) / elementSize < count)
+            THROW_IE_EXCEPTION << "Binary IR graph section is corrupted";
+        return count;
+    }
+
+    template <typename T>
+    std::vector<T> readVector() {
+        const auto size = readCount(sizeof(T));
+        std::vector<T> values(size);
+        if (size != 0)
+            std::memcpy(values.data(), take(size * sizeof(T)), size * sizeof(T));
+        return values;
+    }
+
+    GraphReader sub(size_t size) {
+        const char* begin = take(size);
+        return GraphReader(begin, begin + size);
+    }
+
+private:
+    const char* take(size_t size) {
+        if (static_cast<size_t>(end - ptr) < size)
+            THROW_IE_EXCEPTION << "Binary IR graph section is corrupted";
+        const char* result = ptr;
+        ptr += size;
+        return result;
+    }
+
+    const char* ptr;
+    const char* end;
+};
+
+/**
+ * @brief Writes node attributes as records of name, kind, payload size and payload,
+ * constant data is placed to the constant section
+ */
+class AttributeSerializer : public ngraph::AttributeVisitor {
+public:
+    AttributeSerializer(const ngraph::Node& node, std::string& constants): node(node), constants(constants) {}
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        THROW_IE_EXCEPTION << "Binary IR doesn't support attribute " << name << " of type " << adapter.get_type_info().name
+                           << " of operation " << node.get_type_name() << " " << node.get_friendly_name();
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void*>& adapter) override {
+        const uint64_t offset = alignUp(constants.size(), constantAlignment);
+        constants.resize(offset);
+        constants.append(static_cast<const char*>(adapter.get_ptr()), adapter.size());
+        GraphWriter payload;
+        payload.write(offset);
+        payload.write(static_cast<uint64_t>(adapter.size()));
+        add(name, AttributeKind::Data, payload);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        GraphWriter payload;
+        payload.writeString(adapter.get());
+        add(name, AttributeKind::String, payload);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        GraphWriter payload;
+        payload.write(static_cast<uint8_t>(adapter.get()));
+        add(name, AttributeKind::Bool, payload);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int8_t>& adapter) override { addInt(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int16_t>& adapter) override { addInt(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int32_t>& adapter) override { addInt(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override { addInt(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint8_t>& adapter) override { addInt(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint16_t>& adapter) override { addInt(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint32_t>& adapter) override { addInt(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint64_t>& adapter) override { addInt(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<float>& adapter) override { addDouble(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override { addDouble(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override { addVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override { addVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override { addVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override { addVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override { addVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override { addVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override { addVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override { addVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override { addVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override { addVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        GraphWriter payload;
+        const auto& values = adapter.get();
+        payload.write(static_cast<uint32_t>(values.size()));
+        for (const auto& value : values)
+            payload.writeString(value);
+        add(name, AttributeKind::StringVector, payload);
+    }
+
+    void writeTo(GraphWriter& graph) const {
+        graph.write(count);
+        graph.append(attributes);
+    }
+
+private:
+    template <typename T>
+    void addInt(const std::string& name, ngraph::ValueAccessor<T>& adapter) {
+        GraphWriter payload;
+        payload.write(static_cast<int64_t>(adapter.get()));
+        add(name, AttributeKind::Int64, payload);
+    }
+
+    template <typename T>
+    void addDouble(const std::string& name, ngraph::ValueAccessor<T>& adapter) {
+        GraphWriter payload;
+        payload.write(static_cast<double>(adapter.get()));
+        add(name, AttributeKind::Double, payload);
+    }
+
+    template <typename T>
+    void addVector(const std::string& name, ngraph::ValueAccessor<std::vector<T>>& adapter) {
+        GraphWriter payload;
+        payload.writeVector(adapter.get());
+        add(name, VectorKind<T>::value, payload);
+    }
+
+    void add(const std::string& name, AttributeKind kind, const GraphWriter& payload) {
+        attributes.writeString(name);
+        attributes.write(kind);
+        attributes.write(static_cast<uint32_t>(payload.data().size()));
+        attributes.append(payload);
+        count++;
+    }
+
+    const ngraph::Node& node;
+    std::string& constants;
+    GraphWriter attributes;
+    uint32_t count = 0;
+};
+
+/**
+ * @brief Sets node attributes from the records written by AttributeSerializer,
+ * constant data is read from the model stream directly to the constant buffer
+ */
+class AttributeDeserializer : public ngraph::AttributeVisitor {
+public:
+    AttributeDeserializer(GraphReader& graph, std::istream& model, uint64_t constantsOffset, uint64_t constantsSize)
+        : model(model), constantsOffset(constantsOffset), constantsSize(constantsSize) {
+        // name size, kind and payload size
+        const auto count = graph.readCount(sizeof(uint32_t) + sizeof(AttributeKind) + sizeof(uint32_t));
+        attributes.reserve(count);
+        for (uint32_t i = 0; i < count; i++) {
+            auto name = graph.readString();
+            const auto kind = graph.read<AttributeKind>();
+            const auto size = graph.read<uint32_t>();
+            attributes.push_back({std::move(name), kind, graph.sub(size)});
+        }
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        if (find(name, AttributeKind::Data, false))
+            THROW_IE_EXCEPTION << "Binary IR doesn't support attribute " << name << " of type " << adapter.get_type_info().name;
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void*>& adapter) override {
+        auto payload = find(name, AttributeKind::Data);
+        if (!payload) return;
+        const auto offset = payload->read<uint64_t>();
+        const auto size = payload->read<uint64_t>();
+        if (size != adapter.size() || offset > constantsSize || size > constantsSize - offset)
+            THROW_IE_EXCEPTION << "Binary IR constant " << name << " has wrong size";
+        // constants are stored in the order of operations, so the stream is read sequentially
+        const auto position = static_cast<std::streamoff>(constantsOffset + offset);
+        if (model.tellg() != position)
+            model.seekg(position);
+        model.read(static_cast<char*>(adapter.get_ptr()), static_cast<std::streamsize>(size));
+        if (!model)
+            THROW_IE_EXCEPTION << "Binary IR constant section is truncated";
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        if (auto payload = find(name, AttributeKind::String))
+            adapter.set(payload->readString());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        if (auto payload = find(name, AttributeKind::Bool))
+            adapter.set(payload->read<uint8_t>() != 0);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int8_t>& adapter) override { setInt(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int16_t>& adapter) override { setInt(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int32_t>& adapter) override { setInt(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override { setInt(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint8_t>& adapter) override { setInt(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint16_t>& adapter) override { setInt(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint32_t>& adapter) override { setInt(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint64_t>& adapter) override { setInt(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<float>& adapter) override { setDouble(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override { setDouble(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override { setVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override { setVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override { setVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override { setVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override { setVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override { setVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override { setVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override { setVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override { setVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override { setVector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        auto payload = find(name, AttributeKind::StringVector);
+        if (!payload) return;
+        std::vector<std::string> values(payload->readCount(sizeof(uint32_t)));
+        for (auto& value : values)
+            value = payload->readString();
+        adapter.set(values);
+    }
+
+private:
+    struct Attribute {
+        std::string name;
+        AttributeKind kind;
+        GraphReader payload;
+    };
+
+    // Operations have a few attributes, so the linear search is the fastest one
+    GraphReader* find(const std::string& name, AttributeKind kind, bool checkKind = true) {
+        for (auto& attribute : attributes) {
+            if (attribute.name != name) continue;
+            if (checkKind && attribute.kind != kind)
+                THROW_IE_EXCEPTION << "Binary IR attribute " << name << " has unexpected type";
+            return &attribute.payload;
+        }
+        return nullptr;
+    }
+
+    template <typename T>
+    void setInt(const std::string& name, ngraph::ValueAccessor<T>& adapter) {
+        if (auto payload = find(name, AttributeKind::Int64))
+            adapter.set(static_cast<T>(payload->read<int64_t>()));
+    }
+
+    template <typename T>
+    void setDouble(const std::string& name, ngraph::ValueAccessor<T>& adapter) {
+        if (auto payload = find(name, AttributeKind::Double))
+            adapter.set(static_cast<T>(payload->read<double>()));
+    }
+
+    template <typename T>
+    void setVector(const std::string& name, ngraph::ValueAccessor<std::vector<T>>& adapter) {
+        if (auto payload = find(name, VectorKind<T>::value))
+            adapter.set(payload->template readVector<T>());
+    }
+
+    std::vector<Attribute> attributes;
+    std::istream& model;
+    const uint64_t constantsOffset;
+    const uint64_t constantsSize;
+};
+
+bool readHeader(std::istream& model, Header& header) {
+    model.seekg(0, model.beg);
+    model.read(reinterpret_cast<char*>(&header), sizeof(header));
+    return model && std::memcmp(header.magic, magic, sizeof(magic)) == 0;
+}
+
+}  // namespace
+
+void serialize(const ngraph::Function& function, std::ostream& stream) {
+    const auto opsets = getOpSets({});
+    const auto ops = function.get_ordered_ops();
+
+    std::unordered_map<const ngraph::Node*, uint32_t> ids;
+    GraphWriter graph;
+    std::string constants;
+
+    graph.writeString(function.get_friendly_name());
+    graph.write(static_cast<uint32_t>(ops.size()));
+    for (const auto& op : ops) {
+        auto opset = std::find_if(opsets.begin(), opsets.end(), [&](const std::pair<const std::string, ngraph::OpSet>& it) {
+            return it.second.contains_op_type(op.get());
+        });
+        if (opset == opsets.end())
+            THROW_IE_EXCEPTION << "Binary IR doesn't support operation " << op->get_type_name() << " "
+                               << op->get_friendly_name() << " which doesn't belong to any opset";
+
+        graph.writeString(opset->first);
+        graph.writeString(op->get_type_name());
+        graph.writeString(op->get_friendly_name());
+
+        graph.write(static_cast<uint32_t>(op->get_input_size()));
+        for (const auto& input : op->inputs()) {
+            const auto output = input.get_source_output();
+            graph.write(ids.at(output.get_node()));
+            graph.write(static_cast<uint32_t>(output.get_index()));
+        }
+
+        const auto& dependencies = op->get_control_dependencies();
+        graph.write(static_cast<uint32_t>(dependencies.size()));
+        for (const auto& dependency : dependencies)
+            graph.write(ids.at(dependency.get()));
+
+        AttributeSerializer attributes(*op, constants);
+        if (!op->visit_attributes(attributes))
+            THROW_IE_EXCEPTION << "Binary IR doesn't support operation " << op->get_type_name() << " "
+                               << op->get_friendly_name() << " which doesn't support attributes visiting";
+        attributes.writeTo(graph);
+
+        std::vector<std::pair<std::string, std::string>> rtInfo;
+        for (const auto& it : op->get_rt_info()) {
+            if (auto value = std::dynamic_pointer_cast<ngraph::VariantWrapper<std::string>>(it.second))
+                rtInfo.emplace_back(it.first, value->get());
+        }
+        graph.write(static_cast<uint32_t>(rtInfo.size()));
+        for (const auto& it : rtInfo) {
+            graph.writeString(it.first);
+            graph.writeString(it.second);
+        }
+
+        const auto id = static_cast<uint32_t>(ids.size());
+        ids[op.get()] = id;
+    }
+
+    const auto& parameters = function.get_parameters();
+    graph.write(static_cast<uint32_t>(parameters.size()));
+    for (const auto& parameter : parameters)
+        graph.write(ids.at(parameter.get()));
+
+    const auto& results = function.get_results();
+    graph.write(static_cast<uint32_t>(results.size()));
+    for (const auto& result : results)
+        graph.write(ids.at(result.get()));
+
+    Header header = {};
+    std::memcpy(header.magic, magic, sizeof(magic));
+    header.version = formatVersion;
+    header.headerSize = sizeof(Header);
+    header.graphOffset = sizeof(Header);
+    header.graphSize = graph.data().size();
+    header.constantsOffset = alignUp(header.graphOffset + header.graphSize, constantsAlignment);
+    header.constantsSize = constants.size();
+
+    stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    stream.write(graph.data().data(), graph.data().size());
+    const std::string padding(header.constantsOffset - header.graphOffset - header.graphSize, '\0');
+    stream.write(padding.data(), padding.size());
+    stream.write(constants.data(), constants.size());
+    if (!stream)
+        THROW_IE_EXCEPTION << "Cannot write Binary IR";
+}
+
+bool isBinaryIR(std::istream& model) {
+    Header header;
+    return readHeader(model, header);
+}
+
+std::shared_ptr<ngraph::Function> parse(std::istream& model, const std::vector<IExtensionPtr>& exts) {
+    Header header;
+    if (!readHeader(model, header))
+        THROW_IE_EXCEPTION << "The model is not a Binary IR";
+    if (header.version != formatVersion || header.headerSize != sizeof(Header))
+        THROW_IE_EXCEPTION << "Binary IR version " << header.version << " is not supported";
+
+    const auto opsets = getOpSets(exts);
+
+    model.seekg(0, model.end);
+    const auto modelSize = static_cast<uint64_t>(model.tellg());
+    if (header.graphOffset > modelSize || header.graphSize > modelSize - header.graphOffset)
+        THROW_IE_EXCEPTION << "Binary IR graph section is truncated";
+
+    std::vector<char> graphData(header.graphSize);
+    model.seekg(static_cast<std::streamoff>(header.graphOffset));
+    model.read(graphData.data(), static_cast<std::streamsize>(graphData.size()));
+    if (!model)
+        THROW_IE_EXCEPTION << "Binary IR graph section is truncated";
+    GraphReader graph(graphData.data(), graphData.data() + graphData.size());
+
+    const auto name = graph.readString();
+    // opset, type and name sizes are the least a node takes
+    const auto count = graph.readCount(3 * sizeof(uint32_t));
+    std::vector<std::shared_ptr<ngraph::Node>> nodes;
+    nodes.reserve(count);
+    for (uint32_t i = 0; i < count; i++) {
+        const auto opsetName = graph.readString();
+        const auto type = graph.readString();
+        const auto friendlyName = graph.readString();
+
+        auto opset = opsets.find(opsetName);
+        if (opset == opsets.end())
+            THROW_IE_EXCEPTION << "Cannot create " << type << " layer " << friendlyName << ": unknown opset " << opsetName;
+        std::shared_ptr<ngraph::Node> node(opset->second.create(type));
+        if (!node)
+            THROW_IE_EXCEPTION << "Cannot create " << type << " layer " << friendlyName << " from " << opsetName;
+
+        // node id and port
+        ngraph::OutputVector inputs(graph.readCount(2 * sizeof(uint32_t)));
+        for (auto& input : inputs) {
+            const auto id = graph.read<uint32_t>();
+            const auto port = graph.read<uint32_t>();
+            if (id >= nodes.size() || port >= nodes[id]->get_output_size())
+                THROW_IE_EXCEPTION << "Binary IR graph section is corrupted";
+            input = nodes[id]->output(port);
+        }
+        node->set_arguments(inputs);
+
+        AttributeDeserializer attributes(graph, model, header.constantsOffset, header.constantsSize);
+        if (!node->visit_attributes(attributes))
+            THROW_IE_EXCEPTION << "Cannot create " << type << " layer " << friendlyName << ": visitor API is not supported";
+        node->constructor_validate_and_infer_types();
+        node->set_friendly_name(friendlyName);
+
+        const auto dependencies = graph.read<uint32_t>();
+        for (uint32_t d = 0; d < dependencies; d++) {
+            const auto id = graph.read<uint32_t>();
+            if (id >= nodes.size())
+                THROW_IE_EXCEPTION << "Binary IR graph section is corrupted";
+            node->add_control_dependency(nodes[id]);
+        }
+
+        auto& rtInfo = node->get_rt_info();
+        const auto rtInfoSize = graph.read<uint32_t>();
+        for (uint32_t r = 0; r < rtInfoSize; r++) {
+            const auto key = graph.readString();
+            rtInfo[key] = std::make_shared<ngraph::VariantWrapper<std::string>>(graph.readString());
+        }
+
+        nodes.push_back(node);
+    }
+
+    auto getNode = [&](uint32_t id) {
+        if (id >= nodes.size())
+            THROW_IE_EXCEPTION << "Binary IR graph section is corrupted";
+        return nodes[id];
+    };
+
+    ngraph::ParameterVector parameters(graph.readCount(sizeof(uint32_t)));
+    for (auto& parameter : parameters) {
+        parameter = ngraph::as_type_ptr<ngraph::op::Parameter>(getNode(graph.read<uint32_t>()));
+        if (!parameter)
+            THROW_IE_EXCEPTION << "Binary IR graph section is corrupted";
+    }
+
+    ngraph::ResultVector results(graph.readCount(sizeof(uint32_t)));
+    for (auto& result : results) {
+        result = ngraph::as_type_ptr<ngraph::op::Result>(getNode(graph.read<uint32_t>()));
+        if (!result)
+            THROW_IE_EXCEPTION << "Binary IR graph section is corrupted";
+    }
+
+    return std::make_shared<ngraph::Function>(results, parameters, name);
+}
+
+}  // namespace BinaryIR
+}  // namespace InferenceEngine
@@ -0,0 +1,65 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_api.h>
+#include <ie_iextension.h>
+
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+namespace ngraph {
+class Function;
+}  // namespace ngraph
+
+namespace InferenceEngine {
+
+/**
+ * @brief Binary IR is a single file form of IR v10 that is loaded without text parsing.
+ *
+ * The file consists of a fixed header, a graph section and a constant section:
+ *  * the graph section lists operations in topological order; every operation is stored as its opset and type,
+ *    friendly name, input ports, control dependencies, attributes obtained with ngraph::AttributeVisitor
+ *    in binary form and string runtime info;
+ *  * the constant section starts at a page boundary and keeps Constant values in the order of operations,
+ *    so they are read sequentially directly into the Constant buffers.
+ *
+ * Operations are created from the same opsets as IR v10 operations, so only operations which implement
+ * ngraph::Node::visit_attributes can be serialized. Operations with sub-graphs are not supported.
+ */
+namespace BinaryIR {
+
+/**
+ * @brief File extension of the Binary IR
+ */
+constexpr auto fileExtension = "irb";
+
+/**
+ * @brief Serializes ngraph function to Binary IR
+ * @param function A function to serialize
+ * @param stream An output stream opened in binary mode
+ */
+INFERENCE_ENGINE_API_CPP(void) serialize(const ngraph::Function& function, std::ostream& stream);
+
+/**
+ * @brief Checks that the stream contains Binary IR
+ * @param model A stream with a model
+ * @return true if the stream starts with Binary IR header
+ */
+INFERENCE_ENGINE_API_CPP(bool) isBinaryIR(std::istream& model);
+
+/**
+ * @brief Reads ngraph function from Binary IR
+ * @param model A stream with Binary IR
+ * @param exts Extensions with custom opsets
+ * @return A function
+ */
+INFERENCE_ENGINE_API_CPP(std::shared_ptr<ngraph::Function>) parse(std::istream& model,
+                                                                   const std::vector<IExtensionPtr>& exts);
+
+}  // namespace BinaryIR
+}  // namespace InferenceEngine
@@ -10,6 +10,7 @@
 #include <unordered_set>
 #include <algorithm>
 #include <deque>
+#include <future>
 #include <map>
 #include <memory>
 #include <ngraph/ngraph.hpp>
@@ -72,18 +73,63 @@ public:
         originBlob(weights) { }
 };
 
-std::shared_ptr<ICNNNetwork> CNNParser::parse(const pugi::xml_node& root, std::istream& binStream) {
-    auto getBlobStream = [](std::istream& binStream) {
-        details::BlobStream* blobStream = dynamic_cast<details::BlobStream*>(&binStream);
-        if (blobStream == nullptr) {
-            details::BlobStream helper({});
-            std::string typeStream = typeid(binStream).name();
-            std::string typeBlobStream = typeid(helper).name();
-            if (typeStream == typeBlobStream)
-                blobStream = static_cast<details::BlobStream*>(&binStream);
+namespace {
+
+details::BlobStream* getBlobStream(std::istream& binStream) {
+    details::BlobStream* blobStream = dynamic_cast<details::BlobStream*>(&binStream);
+    if (blobStream == nullptr) {
+        details::BlobStream helper({});
+        std::string typeStream = typeid(binStream).name();
+        std::string typeBlobStream = typeid(helper).name();
+        if (typeStream == typeBlobStream)
+            blobStream = static_cast<details::BlobStream*>(&binStream);
+    }
+    return blobStream;
+}
+
+struct ConstantData {
+    char* data;
+    size_t offset;
+    size_t size;
+};
+
+// Constants are read in the order of offsets, so the weights are read sequentially without seeking back
+void loadConstants(std::istream& binStream, std::vector<ConstantData> constants) {
+    std::sort(constants.begin(), constants.end(), [](const ConstantData& a, const ConstantData& b) {
+        return a.offset < b.offset;
+    });
+
+    // Weights are already in memory, the copy of large constants is parallel
+    if (auto blobStream = getBlobStream(binStream)) {
+        const auto blob = blobStream->getBlob();
+        const auto buffer = blob->cbuffer();
+        const auto weights = buffer.as<const char*>();
+        for (const auto& constant : constants) {
+            ie_memcpy(constant.data, constant.size, weights + constant.offset, constant.size);
         }
-        return blobStream;
-    };
+        return;
+    }
+
+    for (const auto& constant : constants) {
+        if (binStream.tellg() != static_cast<std::streampos>(constant.offset))
+            binStream.seekg(constant.offset, std::ios::beg);
+        binStream.read(constant.data, constant.size);
+        if (!binStream)
+            THROW_IE_EXCEPTION << "Cannot read network! Weights data is truncated.";
+    }
+}
+
+// Integer constants and small constants are used by shape inference of the following operations, so they are
+// read before the graph is built, other constants are read in parallel with the graph construction
+constexpr size_t maxShapeConstantSize = 1024;
+
+bool isShapeConstant(const ngraph::op::Constant& constant, size_t size) {
+    return !constant.get_element_type().is_real() || size <= maxShapeConstantSize;
+}
+
+}  // namespace
+
+std::shared_ptr<ICNNNetwork> CNNParser::parse(const pugi::xml_node& root, std::istream& binStream) {
     details::CNNNetReaderImpl reader(std::make_shared<details::V2FormatParserCreator>());
     ResponseDesc resp;
     StatusCode ret = reader.ReadNetwork(root, &resp);
@@ -176,6 +222,43 @@ std::shared_ptr<ICNNNetwork> V10Parser::parse(const pugi::xml_node& root, std::i
     };
     std::for_each(outputs.begin(), outputs.end(), dfs);
 
+    // Constants don't have inputs, so they are created before other operations and their data is loaded
+    // by large sequential reads instead of a seek and a read per constant
+    std::vector<ConstantData> shapeConstants, weightsConstants;
+    bool streamIsUsedByLayers = false;
+    for (auto& layer_id : order) {
+        auto& p = params[layer_id];
+        if (p.params.type == "TensorIterator" || !p.xml.child("blobs").empty())
+            streamIsUsedByLayers = true;
+        if (p.params.type != "Const")
+            continue;
+
+        auto node = createNode({}, p.xml, binStream, p.params);
+        id_to_node[layer_id] = node;
+        auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(node);
+        pugi::xml_node dn = p.xml.child("data");
+        if (!constant || dn.empty() || dn.attribute("size").empty())
+            continue;
+
+        const size_t bufferSize = ngraph::shape_size(constant->get_shape()) * constant->get_element_type().size();
+        ConstantData data = {const_cast<char*>(reinterpret_cast<const char*>(constant->get_data_ptr())),
+                             static_cast<size_t>(GetUInt64Attr(dn, "offset")),
+                             std::min(static_cast<size_t>(GetUInt64Attr(dn, "size")), bufferSize)};
+        (isShapeConstant(*constant, data.size) ? shapeConstants : weightsConstants).push_back(data);
+    }
+    loadConstants(binStream, std::move(shapeConstants));
+
+    // The stream is shared with TensorIterator bodies and blobs of GenericIE layers, in this case only weights
+    // which are already in memory are copied in parallel
+    std::future<void> weightsLoaded;
+    if (streamIsUsedByLayers && !getBlobStream(binStream)) {
+        loadConstants(binStream, std::move(weightsConstants));
+    } else if (!weightsConstants.empty()) {
+        weightsLoaded = std::async(std::launch::async, [&binStream](std::vector<ConstantData> constants) {
+            loadConstants(binStream, std::move(constants));
+        }, std::move(weightsConstants));
+    }
+
     ngraph::ParameterVector parameter_nodes;
     ngraph::ResultVector result_nodes;
     ngraph::NodeVector allNodes;
@@ -185,6 +268,10 @@ std::shared_ptr<ICNNNetwork> V10Parser::parse(const pugi::xml_node& root, std::i
     //  Following topological order create nGraph operations
     for (auto& layer_id : order) {
         auto& p = params[layer_id];
+        if (id_to_node[layer_id]) {
+            allNodes.emplace_back(id_to_node[layer_id]);
+            continue;
+        }
         ngraph::OutputVector inputs(edges[layer_id].size());
         for (auto& e : edges[layer_id]) {
             auto input_node = id_to_node[e.fromLayerId];
@@ -242,6 +329,8 @@ std::shared_ptr<ICNNNetwork> V10Parser::parse(const pugi::xml_node& root, std::i
             result_nodes[0]->add_control_dependency(assign);
         }
     }
+    if (weightsLoaded.valid())
+        weightsLoaded.get();
     return CNNNetwork(function);
 }
 
@@ -1466,11 +1555,8 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Constant>::cre
     if (size < std::ceil(ngraph::shape_size(shape) * el_type.bitwidth() / 8.f))
         THROW_IE_EXCEPTION << "Cannot create Constant op " << layerParsePrms.name << " size attribute and shape size are inconsistent!";
 
-    auto constant = std::make_shared<ngraph::op::Constant>(port.precision, shape);
-    char* data = const_cast<char*>(reinterpret_cast<const char*>(constant->get_data_ptr()));
-    binStream.seekg(offset, std::ios::beg);
-    binStream.read(data, size);
-    return constant;
+    // The data is loaded by V10Parser::parse together with other constants
+    return std::make_shared<ngraph::op::Constant>(port.precision, shape);
 }
 
 // Power layer
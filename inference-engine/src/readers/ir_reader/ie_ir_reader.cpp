@@ -13,6 +13,7 @@
 #include <sstream>
 
 #include "description_buffer.hpp"
+#include "ie_binary_ir.hpp"
 #include "ie_ir_parser.hpp"
 #include "ie_ngraph_utils.hpp"
 
@@ -23,6 +24,9 @@ static size_t GetIRVersion(pugi::xml_node& root) {
 }
 
 bool IRReader::supportModel(std::istream& model) const {
+    if (BinaryIR::isBinaryIR(model))
+        return true;
+    model.clear();
     model.seekg(0, model.beg);
     const int header_size = 128;
     std::string header(header_size, ' ');
@@ -36,6 +40,10 @@ CNNNetwork IRReader::read(std::istream& model, const std::vector<IExtensionPtr>&
     return read(model, emptyStream, exts);
 }
 CNNNetwork IRReader::read(std::istream& model, std::istream& weights, const std::vector<IExtensionPtr>& exts) const {
+    // Binary IR keeps weights in the same file
+    if (BinaryIR::isBinaryIR(model))
+        return CNNNetwork(BinaryIR::parse(model, exts));
+    model.clear();
     model.seekg(0, model.beg);
     weights.seekg(0, weights.beg);
     pugi::xml_document xmlDoc;
@@ -0,0 +1,59 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <ie_icnn_network.hpp>
+
+#include <vpu/graph_transformer.hpp>
+#include <vpu/utils/logger.hpp>
+
+namespace vpu {
+
+namespace ie = InferenceEngine;
+
+//
+// CompiledGraphCache
+//
+
+// On-disk cache of compiled graphs.
+//
+// Every entry is stored in a separate file <directory>/<key>.vpublob. The key is a hash of the network
+// (topology, attributes, weights, inputs and outputs info), the compilation config, the platform, the blob
+// version and the Inference Engine build number. The index file keeps the sizes of the entries and the order
+// of their last use, least recently used entries are removed when the total size exceeds the limit.
+//
+// Entries are written to a temporary file and renamed, so a partially written entry is never loaded.
+// The index is shared between processes on the best effort basis: a lost index update may only cause
+// a stale entry to stay on disk until it is overwritten.
+class CompiledGraphCache final {
+public:
+    CompiledGraphCache(std::string directory, std::uint64_t maxSize, Logger::Ptr log);
+
+    // Returns an empty key if the cache can't be used for the network or the config:
+    // the network has operations or attributes the hash doesn't support, or the compilation
+    // has side effects (custom layers, dumps of the internal graph or of the IR with scales).
+    static std::string computeKey(
+            const ie::ICNNNetwork& network,
+            Platform platform,
+            const CompilationConfig& config);
+
+    // Returns nullptr if there is no valid entry for the key.
+    CompiledGraph::Ptr load(const std::string& key) const;
+
+    void store(const std::string& key, const CompiledGraph& compiledGraph) const;
+
+private:
+    std::string entryPath(const std::string& key) const;
+    std::string indexPath() const;
+
+    std::string _directory;
+    std::uint64_t _maxSize = 0;
+    Logger::Ptr _log;
+};
+
+}  // namespace vpu
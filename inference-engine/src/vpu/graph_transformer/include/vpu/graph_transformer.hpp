@@ -64,6 +64,13 @@ struct CompilationConfig final {
 
     std::map<std::string, std::vector<int>> ioStrides;
 
+    //
+    // Compiled blobs cache options, they don't affect compilation results
+    //
+
+    std::string compiledBlobCacheDir;
+    int compiledBlobCacheSizeMB = 1024;
+
     //
     // Debug options
     //
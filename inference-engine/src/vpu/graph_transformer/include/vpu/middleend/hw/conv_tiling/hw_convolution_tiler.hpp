@@ -11,6 +11,7 @@
 #include <limits>
 #include <algorithm>
 #include <vector>
+#include <map>
 #include <unordered_map>
 #include <vpu/model/data_desc.hpp>
 #include <vpu/middleend/hw/tiling.hpp>
@@ -131,6 +132,29 @@ public:
 
 class HWConvolutionTileLayoutCut;
 
+// Memoizes tiling options of convolutions with the same configuration: the search result depends only on
+// the convolution parameters (not on the stage name), the direction and the number of CMX slices.
+class HWConvolutionTilingCache final {
+public:
+    // searches tiling options for all the configurations which are not cached yet, independent searches run in parallel
+    void prefetch(const std::vector<ConvolutionOptions>& convolutionOptions, const Direction& direction,
+                  std::size_t maxTilingOptions);
+
+    // returns cached tiling options, searches for them if the configuration was not seen yet
+    const std::vector<TilingOption>& get(const ConvolutionOptions& convolutionOptions, const Direction& direction,
+                                         std::size_t maxTilingOptions);
+
+    std::size_t size() const { return _tilingOptions.size(); }
+
+private:
+    using Key = std::vector<int>;
+
+    static Key makeKey(const ConvolutionOptions& convolutionOptions, const Direction& direction,
+                       std::size_t maxTilingOptions, int numCMXSlices);
+
+    std::map<Key, std::vector<TilingOption>> _tilingOptions;
+};
+
 // iterates over all the tiling options and chooses few with minimal cost
 class HWConvolutionTilingSearcher {
 public:
@@ -142,13 +166,16 @@ public:
         _dirTiling(ConvGraphDataTilingFactory::makeDirTiling(*other._dirTiling)),
         _tilingOptions(other._tilingOptions) {}
     HWConvolutionTilingSearcher(ConvolutionOptions convolutionOptions, const Direction& direction,
-                                std::size_t maxTilingOptions) :
+                                std::size_t maxTilingOptions, HWConvolutionTilingCache* cache = nullptr) :
         _convolutionOptions(std::move(convolutionOptions)),
         _dirTiling(ConvGraphDataTilingFactory::makeDirTiling(_convolutionOptions, direction)),
         _maxTilingOptions(maxTilingOptions) {
             IE_ASSERT(maxTilingOptions > 0);
             _dirTiling->initTileSizes();
-            _tilingOptions = selectBetterTiling();
+            _tilingOptions = cache != nullptr ?
+                cache->get(_convolutionOptions, direction, maxTilingOptions) :
+                searchTilingOptions(_convolutionOptions, direction, maxTilingOptions,
+                                    CompileEnv::get().resources.numCMXSlices);
         }
 
     const std::vector<TilingOption>& tilingOptions() const {
@@ -159,8 +186,14 @@ public:
 
     HWConvolutionTileLayoutCut tileLayoutCut(const TilingOption& option) const;
 
+    // Doesn't access CompileEnv, so it can be called from any thread
+    static std::vector<TilingOption> searchTilingOptions(const ConvolutionOptions& convolutionOptions,
+                                                         const Direction& direction, std::size_t maxTilingOptions,
+                                                         int numCMXSlices);
+
 private:
-    std::vector<TilingOption> selectBetterTiling() const;
+    static std::vector<TilingOption> selectBetterTiling(GraphDataTiling& dirTiling, std::size_t maxTilingOptions,
+                                                        int numCMXSlices);
 
     const ConvolutionOptions _convolutionOptions;
     const std::size_t _maxTilingOptions;
@@ -173,7 +206,8 @@ class HWConvolutionTiler final {
 public:
     HWConvolutionTiler() = delete;
     HWConvolutionTiler(const HWConvolutionTiler&) = default;
-    HWConvolutionTiler(ConvolutionOptions convolutionOptions, const Direction& direction, std::size_t maxTilingOptions);
+    HWConvolutionTiler(ConvolutionOptions convolutionOptions, const Direction& direction, std::size_t maxTilingOptions,
+                       HWConvolutionTilingCache* cache = nullptr);
 
 
     bool isTilingPossible() const {
@@ -54,7 +54,12 @@ class PassSet final {
 public:
     using Ptr = std::shared_ptr<PassSet>;
 
-    void run(const Model& model) const;
+    struct PassTiming final {
+        std::string name;
+        double durationMs;
+    };
+
+    void run(const Model& model);
 
     inline void addPass(
             const Pass::Ptr& pass,
@@ -62,8 +67,16 @@ public:
         _passes.emplace_back(pass, name);
     }
 
+    // durations of the passes in the order of execution, filled by the last run
+    const std::vector<PassTiming>& timings() const {
+        return _timings;
+    }
+
 private:
+    void logTimingsSummary() const;
+
     std::vector<std::pair<Pass::Ptr, std::string>> _passes;
+    std::vector<PassTiming> _timings;
 };
 
 //
@@ -0,0 +1,801 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vpu/compiled_graph_cache.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ie_version.hpp>
+#include <details/ie_cnn_network_tools.h>
+#include <ngraph/function.hpp>
+#include <ngraph/attribute_visitor.hpp>
+#include <ngraph/variant.hpp>
+
+namespace vpu {
+
+namespace {
+
+// bump when the entry layout or the hashed network representation changes
+constexpr std::uint32_t CACHE_FORMAT_VERSION = 1;
+constexpr char ENTRY_MAGIC[8] = {'V', 'P', 'U', 'G', 'C', 'A', 'C', 'H'};
+constexpr auto ENTRY_EXTENSION = ".vpublob";
+constexpr auto INDEX_FILE_NAME = "index.txt";
+
+// all the instances of the cache in the process share the index files
+std::mutex g_cacheMutex;
+
+//
+// Hashing
+//
+
+// Two 64-bit lanes with different seeds and multipliers give a 128-bit key,
+// the input is consumed 8 bytes at a time, so hashing weights is cheap compared to compilation.
+class Hasher final {
+public:
+    void bytes(const void* data, std::size_t size) {
+        const auto* ptr = static_cast<const std::uint8_t*>(data);
+        std::size_t offset = 0;
+        for (; offset + sizeof(std::uint64_t) <= size; offset += sizeof(std::uint64_t)) {
+            std::uint64_t chunk;
+            std::memcpy(&chunk, ptr + offset, sizeof(chunk));
+            mix(chunk);
+        }
+        std::uint64_t tail = 0;
+        std::memcpy(&tail, ptr + offset, size - offset);
+        // the size separates consecutive fields, so {"ab", "c"} and {"a", "bc"} differ
+        mix(tail ^ (static_cast<std::uint64_t>(size) << 56));
+    }
+
+    template <typename T>
+    void value(const T& v) {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "Unsupported type");
+        bytes(&v, sizeof(v));
+    }
+
+    void string(const std::string& s) {
+        bytes(s.data(), s.size());
+    }
+
+    template <typename T>
+    void vector(const std::vector<T>& v) {
+        value(static_cast<std::uint64_t>(v.size()));
+        bytes(v.data(), v.size() * sizeof(T));
+    }
+
+    std::string str() const {
+        std::ostringstream ostr;
+        ostr << std::hex << std::setfill('0') << std::setw(16) << _h1 << std::setw(16) << _h2;
+        return ostr.str();
+    }
+
+private:
+    void mix(std::uint64_t chunk) {
+        _h1 = (_h1 ^ chunk) * 0x100000001b3ull;
+        _h1 ^= _h1 >> 29;
+        _h2 = (_h2 ^ chunk) * 0x9e3779b97f4a7c15ull;
+        _h2 ^= _h2 >> 31;
+    }
+
+    std::uint64_t _h1 = 0xcbf29ce484222325ull;
+    std::uint64_t _h2 = 0x84222325cbf29ce4ull;
+};
+
+// Hashes attributes of ngraph operations, marks the network as unsupported if an attribute
+// can't be read through the typed value accessors.
+class AttributeHasher final : public ngraph::AttributeVisitor {
+public:
+    explicit AttributeHasher(Hasher& hasher) : _hasher(hasher) {}
+
+    bool supported() const { return _supported; }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>&) override {
+        _supported = false;
+        _hasher.string(name);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void*>& adapter) override {
+        _hasher.string(name);
+        _hasher.bytes(adapter.get_ptr(), adapter.size());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        _hasher.string(name);
+        _hasher.string(adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override { scalar(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int8_t>& adapter) override { scalar(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int16_t>& adapter) override { scalar(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int32_t>& adapter) override { scalar(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override { scalar(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint8_t>& adapter) override { scalar(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint16_t>& adapter) override { scalar(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint32_t>& adapter) override { scalar(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint64_t>& adapter) override { scalar(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<float>& adapter) override { scalar(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override { scalar(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override { vector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override { vector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override { vector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override { vector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override { vector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override { vector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override { vector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override { vector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override { vector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override { vector(name, adapter); }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        _hasher.string(name);
+        const auto& values = adapter.get();
+        _hasher.value(static_cast<std::uint64_t>(values.size()));
+        for (const auto& value : values) {
+            _hasher.string(value);
+        }
+    }
+    void on_adapter(const std::string& name, ngraph::VisitorAdapter&) override {
+        _supported = false;
+        _hasher.string(name);
+    }
+
+private:
+    template <typename T>
+    void scalar(const std::string& name, ngraph::ValueAccessor<T>& adapter) {
+        _hasher.string(name);
+        _hasher.value(adapter.get());
+    }
+
+    template <typename T>
+    void vector(const std::string& name, ngraph::ValueAccessor<std::vector<T>>& adapter) {
+        _hasher.string(name);
+        _hasher.vector(adapter.get());
+    }
+
+    Hasher& _hasher;
+    bool _supported = true;
+};
+
+void hashTensorDesc(Hasher& hasher, const ie::TensorDesc& desc) {
+    hasher.value(static_cast<int>(desc.getPrecision()));
+    hasher.value(static_cast<int>(desc.getLayout()));
+    hasher.vector(desc.getDims());
+}
+
+void hashBlob(Hasher& hasher, const ie::Blob::Ptr& blob) {
+    if (blob == nullptr) {
+        hasher.value(0);
+        return;
+    }
+
+    hashTensorDesc(hasher, blob->getTensorDesc());
+    hasher.bytes(blob->cbuffer().as<const void*>(), blob->byteSize());
+}
+
+bool hashFunction(Hasher& hasher, const ngraph::Function& function) {
+    const auto ops = function.get_ordered_ops();
+
+    std::map<const ngraph::Node*, std::uint64_t> ids;
+    for (const auto& op : ops) {
+        hasher.string(op->get_type_info().name);
+        hasher.value(op->get_type_info().version);
+        hasher.string(op->get_friendly_name());
+
+        hasher.value(static_cast<std::uint64_t>(op->get_input_size()));
+        for (const auto& input : op->inputs()) {
+            const auto source = input.get_source_output();
+            hasher.value(ids.at(source.get_node()));
+            hasher.value(static_cast<std::uint64_t>(source.get_index()));
+        }
+
+        const auto& dependencies = op->get_control_dependencies();
+        hasher.value(static_cast<std::uint64_t>(dependencies.size()));
+        for (const auto& dependency : dependencies) {
+            hasher.value(ids.at(dependency.get()));
+        }
+
+        hasher.value(static_cast<std::uint64_t>(op->get_output_size()));
+        for (size_t i = 0; i < op->get_output_size(); ++i) {
+            std::ostringstream shape;
+            shape << op->get_output_partial_shape(i);
+            hasher.string(op->get_output_element_type(i).get_type_name());
+            hasher.string(shape.str());
+        }
+
+        AttributeHasher attributes(hasher);
+        if (!op->visit_attributes(attributes) || !attributes.supported()) {
+            return false;
+        }
+
+        // runtime info affects transformations, e.g. fused names and primitives priority
+        for (const auto& it : op->get_rt_info()) {
+            hasher.string(it.first);
+            if (const auto value = std::dynamic_pointer_cast<ngraph::VariantWrapper<std::string>>(it.second)) {
+                hasher.string(value->get());
+            }
+        }
+
+        const auto id = static_cast<std::uint64_t>(ids.size());
+        ids[op.get()] = id;
+    }
+
+    for (const auto& parameter : function.get_parameters()) {
+        hasher.value(ids.at(parameter.get()));
+    }
+    for (const auto& result : function.get_results()) {
+        hasher.value(ids.at(result.get()));
+    }
+
+    return true;
+}
+
+void hashCNNNetwork(Hasher& hasher, const ie::ICNNNetwork& network) {
+    for (const auto& layer : ie::details::CNNNetSortTopologically(network)) {
+        hasher.string(layer->name);
+        hasher.string(layer->type);
+        hasher.value(static_cast<int>(layer->precision));
+
+        hasher.value(static_cast<std::uint64_t>(layer->params.size()));
+        for (const auto& param : layer->params) {
+            hasher.string(param.first);
+            hasher.string(param.second);
+        }
+
+        hasher.value(static_cast<std::uint64_t>(layer->insData.size()));
+        for (const auto& input : layer->insData) {
+            const auto data = input.lock();
+            hasher.string(data != nullptr ? data->getName() : std::string());
+        }
+
+        hasher.value(static_cast<std::uint64_t>(layer->outData.size()));
+        for (const auto& output : layer->outData) {
+            hasher.string(output->getName());
+            hashTensorDesc(hasher, output->getTensorDesc());
+        }
+
+        hasher.value(static_cast<std::uint64_t>(layer->blobs.size()));
+        for (const auto& blob : layer->blobs) {
+            hasher.string(blob.first);
+            hashBlob(hasher, blob.second);
+        }
+    }
+}
+
+void hashInputsOutputs(Hasher& hasher, const ie::ICNNNetwork& network) {
+    ie::InputsDataMap inputs;
+    network.getInputsInfo(inputs);
+    for (const auto& input : inputs) {
+        hasher.string(input.first);
+        hashTensorDesc(hasher, input.second->getTensorDesc());
+
+        const auto& preProcess = input.second->getPreProcess();
+        hasher.value(static_cast<int>(preProcess.getMeanVariant()));
+        hasher.value(static_cast<int>(preProcess.getResizeAlgorithm()));
+        hasher.value(static_cast<int>(preProcess.getColorFormat()));
+        hasher.value(static_cast<std::uint64_t>(preProcess.getNumberOfChannels()));
+        for (size_t c = 0; c < preProcess.getNumberOfChannels(); ++c) {
+            hasher.value(preProcess[c]->meanValue);
+            hasher.value(preProcess[c]->stdScale);
+            hashBlob(hasher, preProcess[c]->meanData);
+        }
+    }
+
+    ie::OutputsDataMap outputs;
+    network.getOutputsInfo(outputs);
+    for (const auto& output : outputs) {
+        hasher.string(output.first);
+        hashTensorDesc(hasher, output.second->getTensorDesc());
+    }
+}
+
+template <typename T>
+void hashOptional(Hasher& hasher, const Optional<T>& value) {
+    hasher.value(value.hasValue());
+    if (value.hasValue()) {
+        hasher.value(value.get());
+    }
+}
+
+template <class Set>
+void hashStringSet(Hasher& hasher, const Set& values) {
+    hasher.value(static_cast<std::uint64_t>(values.size()));
+    for (const auto& value : values) {
+        hasher.string(value);
+    }
+}
+
+// Every option which affects the compiled graph must be here, cache and debug options are skipped.
+void hashConfig(Hasher& hasher, const CompilationConfig& config) {
+    hasher.value(config.numSHAVEs);
+    hasher.value(config.numCMXSlices);
+    hasher.value(config.numExecutors);
+    hasher.value(config.hwOptimization);
+    hasher.value(config.hwExtraSplit);
+    hasher.value(config.ignoreIRStatistic);
+    hasher.value(config.detectBatch);
+    hashOptional(hasher, config.copyOptimization);
+    hashOptional(hasher, config.injectSwOps);
+    hashOptional(hasher, config.packDataInCmx);
+    hasher.value(config.mergeHwPoolToConv);
+    hasher.value(config.hwDilation);
+    hasher.value(config.forceDeprecatedCnnConversion);
+
+    hasher.value(static_cast<std::uint64_t>(config.ioStrides.size()));
+    for (const auto& strides : config.ioStrides) {
+        hasher.string(strides.first);
+        hasher.vector(strides.second);
+    }
+
+    hashStringSet(hasher, config.hwWhiteList);
+    hashStringSet(hasher, config.hwBlackList);
+    hashStringSet(hasher, config.noneLayers);
+    hasher.value(config.ignoreUnknownLayers);
+
+    hasher.value(config.disableReorder);
+    hasher.value(config.disableConvertStages);
+    hasher.value(config.enablePermuteMerging);
+    hasher.value(config.enableReplWithSCRelu);
+    hasher.value(config.enableReplaceWithReduceMean);
+    hasher.value(config.enableTensorIteratorUnrolling);
+    hasher.value(config.forcePureTensorIterator);
+
+    hasher.value(config.inputScale);
+    hasher.value(config.inputBias);
+}
+
+//
+// Entry serialization
+//
+
+class EntryWriter final {
+public:
+    template <typename T>
+    void value(const T& v) {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "Unsupported type");
+        _data.append(reinterpret_cast<const char*>(&v), sizeof(v));
+    }
+
+    void bytes(const char* data, std::size_t size) {
+        value(static_cast<std::uint64_t>(size));
+        _data.append(data, size);
+    }
+
+    void string(const std::string& s) {
+        bytes(s.data(), s.size());
+    }
+
+    template <typename T>
+    void vector(const std::vector<T>& v) {
+        bytes(reinterpret_cast<const char*>(v.data()), v.size() * sizeof(T));
+    }
+
+    void tensorDesc(const ie::TensorDesc& desc) {
+        value(static_cast<std::int32_t>(desc.getPrecision()));
+        value(static_cast<std::int32_t>(desc.getLayout()));
+        vector(desc.getDims());
+        if (desc.getLayout() == ie::Layout::BLOCKED) {
+            const auto& blockingDesc = desc.getBlockingDesc();
+            vector(blockingDesc.getBlockDims());
+            vector(blockingDesc.getOrder());
+            value(static_cast<std::uint64_t>(blockingDesc.getOffsetPadding()));
+            vector(blockingDesc.getOffsetPaddingToData());
+            vector(blockingDesc.getStrides());
+        }
+    }
+
+    void dataInfo(const DataInfo& info) {
+        const std::map<std::string, int> offsets(info.offset.begin(), info.offset.end());
+        value(static_cast<std::uint64_t>(offsets.size()));
+        for (const auto& offset : offsets) {
+            string(offset.first);
+            value(offset.second);
+        }
+
+        const std::map<std::string, ie::TensorDesc> descs(info.descFromPlugin.begin(), info.descFromPlugin.end());
+        value(static_cast<std::uint64_t>(descs.size()));
+        for (const auto& desc : descs) {
+            string(desc.first);
+            tensorDesc(desc.second);
+        }
+
+        value(info.totalSize);
+    }
+
+    void graphMeta(const GraphMetaInfo& meta) {
+        string(meta.graphName);
+
+        value(static_cast<std::uint64_t>(meta.stagesMeta.size()));
+        for (const auto& stage : meta.stagesMeta) {
+            value(static_cast<std::int32_t>(stage.status));
+            value(static_cast<std::uint64_t>(stage.outPrecisions.size()));
+            for (const auto& precision : stage.outPrecisions) {
+                value(static_cast<std::int32_t>(precision));
+            }
+            value(static_cast<std::uint64_t>(stage.outLayouts.size()));
+            for (const auto& layout : stage.outLayouts) {
+                value(static_cast<std::int32_t>(layout));
+            }
+            value(stage.inputsNum);
+            string(stage.layerName);
+            string(stage.layerType);
+            string(stage.displayStageName);
+            string(stage.stageName);
+            string(stage.stageType);
+            value(stage.execOrder);
+            value(stage.execTime);
+        }
+
+        value(static_cast<std::uint64_t>(meta.datasMeta.size()));
+        for (const auto& data : meta.datasMeta) {
+            string(data.name);
+            tensorDesc(data.desc);
+            value(static_cast<std::uint64_t>(data.parentIndex));
+            vector(data.childrenIndices);
+        }
+    }
+
+    const std::string& data() const { return _data; }
+
+private:
+    std::string _data;
+};
+
+class EntryReader final {
+public:
+    explicit EntryReader(const std::string& data) : _data(data) {}
+
+    template <typename T>
+    T value() {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "Unsupported type");
+        T v;
+        std::memcpy(&v, take(sizeof(v)), sizeof(v));
+        return v;
+    }
+
+    std::string string() {
+        const auto size = size_value();
+        return std::string(take(size), size);
+    }
+
+    template <typename T>
+    std::vector<T> vector() {
+        const auto size = size_value();
+        VPU_THROW_UNLESS(size % sizeof(T) == 0, "Compiled graph cache entry is broken");
+        std::vector<T> v(size / sizeof(T));
+        std::memcpy(v.data(), take(size), size);
+        return v;
+    }
+
+    ie::TensorDesc tensorDesc() {
+        const auto precision = static_cast<ie::Precision::ePrecision>(value<std::int32_t>());
+        const auto layout = static_cast<ie::Layout>(value<std::int32_t>());
+        const auto dims = vector<std::size_t>();
+        if (layout != ie::Layout::BLOCKED) {
+            return ie::TensorDesc(precision, dims, layout);
+        }
+
+        const auto blockDims = vector<std::size_t>();
+        const auto order = vector<std::size_t>();
+        const auto offsetPadding = static_cast<std::size_t>(value<std::uint64_t>());
+        const auto offsetPaddingToData = vector<std::size_t>();
+        const auto strides = vector<std::size_t>();
+        return ie::TensorDesc(precision, dims, ie::BlockingDesc(blockDims, order, offsetPadding, offsetPaddingToData, strides));
+    }
+
+    void dataInfo(DataInfo& info) {
+        const auto numOffsets = size_value();
+        for (std::uint64_t i = 0; i < numOffsets; ++i) {
+            auto name = string();
+            info.offset[name] = value<int>();
+        }
+
+        const auto numDescs = size_value();
+        for (std::uint64_t i = 0; i < numDescs; ++i) {
+            auto name = string();
+            info.descFromPlugin.emplace(name, tensorDesc());
+        }
+
+        info.totalSize = value<int>();
+    }
+
+    void graphMeta(GraphMetaInfo& meta) {
+        meta.graphName = string();
+
+        meta.stagesMeta.resize(count(sizeof(std::int32_t)));
+        for (auto& stage : meta.stagesMeta) {
+            stage.status = static_cast<ie::InferenceEngineProfileInfo::LayerStatus>(value<std::int32_t>());
+            stage.outPrecisions.resize(count(sizeof(std::int32_t)));
+            for (auto& precision : stage.outPrecisions) {
+                precision = static_cast<ie::Precision::ePrecision>(value<std::int32_t>());
+            }
+            stage.outLayouts.resize(count(sizeof(std::int32_t)));
+            for (auto& layout : stage.outLayouts) {
+                layout = static_cast<ie::Layout>(value<std::int32_t>());
+            }
+            stage.inputsNum = value<int>();
+            stage.layerName = string();
+            stage.layerType = string();
+            stage.displayStageName = string();
+            stage.stageName = string();
+            stage.stageType = string();
+            stage.execOrder = value<int>();
+            stage.execTime = value<float>();
+        }
+
+        const auto numDatas = count(sizeof(std::uint64_t));
+        meta.datasMeta.reserve(numDatas);
+        for (std::uint64_t i = 0; i < numDatas; ++i) {
+            DataMetaInfo data;
+            data.name = string();
+            data.desc = tensorDesc();
+            data.parentIndex = static_cast<std::size_t>(value<std::uint64_t>());
+            data.childrenIndices = vector<std::size_t>();
+            meta.datasMeta.push_back(std::move(data));
+        }
+    }
+
+    bool finished() const { return _offset == _data.size(); }
+
+private:
+    const char* take(std::size_t size) {
+        VPU_THROW_UNLESS(size <= _data.size() - _offset, "Compiled graph cache entry is broken");
+        const auto* ptr = _data.data() + _offset;
+        _offset += size;
+        return ptr;
+    }
+
+    std::uint64_t size_value() {
+        return value<std::uint64_t>();
+    }
+
+    // number of elements which take at least minElementSize bytes each, checked against the rest of the entry
+    std::size_t count(std::size_t minElementSize) {
+        const auto size = size_value();
+        VPU_THROW_UNLESS(size <= (_data.size() - _offset) / minElementSize, "Compiled graph cache entry is broken");
+        return static_cast<std::size_t>(size);
+    }
+
+    const std::string& _data;
+    std::size_t _offset = 0;
+};
+
+std::string serializeEntry(const CompiledGraph& compiledGraph) {
+    EntryWriter writer;
+    for (auto c : ENTRY_MAGIC) {
+        writer.value(c);
+    }
+    writer.value(CACHE_FORMAT_VERSION);
+
+    writer.string(compiledGraph.networkName);
+    writer.value(compiledGraph.networkBatch);
+    writer.value(compiledGraph.numActiveStages);
+    writer.value(compiledGraph.inputBufSize);
+    writer.value(compiledGraph.outputBufSize);
+    writer.value(compiledGraph.numShaves);
+    writer.value(compiledGraph.numSlices);
+    writer.value(compiledGraph.numExecutors);
+    writer.value(static_cast<std::uint64_t>(compiledGraph.blobHeader.second));
+    writer.dataInfo(compiledGraph.inputInfo);
+    writer.dataInfo(compiledGraph.outputInfo);
+    writer.graphMeta(compiledGraph.graphMeta);
+    writer.vector(compiledGraph.blob);
+
+    return writer.data();
+}
+
+CompiledGraph::Ptr deserializeEntry(const std::string& data) {
+    EntryReader reader(data);
+    for (auto c : ENTRY_MAGIC) {
+        VPU_THROW_UNLESS(reader.value<char>() == c, "Compiled graph cache entry is broken");
+    }
+    VPU_THROW_UNLESS(reader.value<std::uint32_t>() == CACHE_FORMAT_VERSION,
+        "Compiled graph cache entry has unsupported version");
+
+    auto compiledGraph = std::make_shared<CompiledGraph>();
+    compiledGraph->networkName = reader.string();
+    compiledGraph->networkBatch = reader.value<int>();
+    compiledGraph->numActiveStages = reader.value<int>();
+    compiledGraph->inputBufSize = reader.value<int>();
+    compiledGraph->outputBufSize = reader.value<int>();
+    compiledGraph->numShaves = reader.value<std::uint32_t>();
+    compiledGraph->numSlices = reader.value<std::uint32_t>();
+    compiledGraph->numExecutors = reader.value<std::uint32_t>();
+    const auto headerSize = static_cast<std::size_t>(reader.value<std::uint64_t>());
+    reader.dataInfo(compiledGraph->inputInfo);
+    reader.dataInfo(compiledGraph->outputInfo);
+    reader.graphMeta(compiledGraph->graphMeta);
+    compiledGraph->blob = reader.vector<char>();
+
+    VPU_THROW_UNLESS(reader.finished() && headerSize <= compiledGraph->blob.size(),
+        "Compiled graph cache entry is broken");
+    compiledGraph->blobHeader = {compiledGraph->blob.data(), headerSize};
+
+    return compiledGraph;
+}
+
+//
+// Index
+//
+
+struct IndexEntry final {
+    std::uint64_t size;
+    std::uint64_t lastUse;
+};
+
+// text file with lines "<key> <size> <last use>", where last use is a counter increased on every access
+struct Index final {
+    std::map<std::string, IndexEntry> entries;
+    std::uint64_t counter = 0;
+
+    void read(const std::string& path) {
+        std::ifstream file(path);
+        std::string key;
+        IndexEntry entry = {};
+        while (file >> key >> entry.size >> entry.lastUse) {
+            entries[key] = entry;
+            counter = std::max(counter, entry.lastUse);
+        }
+    }
+
+    void write(const std::string& path) const {
+        const auto tmpPath = path + ".tmp";
+        {
+            std::ofstream file(tmpPath);
+            for (const auto& entry : entries) {
+                file << entry.first << ' ' << entry.second.size << ' ' << entry.second.lastUse << '\n';
+            }
+        }
+        std::remove(path.c_str());
+        std::rename(tmpPath.c_str(), path.c_str());
+    }
+};
+
+bool readFile(const std::string& path, std::string& data) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::ostringstream ostr;
+    ostr << file.rdbuf();
+    data = ostr.str();
+    return static_cast<bool>(file);
+}
+
+}  // namespace
+
+CompiledGraphCache::CompiledGraphCache(std::string directory, std::uint64_t maxSize, Logger::Ptr log) :
+        _directory(std::move(directory)), _maxSize(maxSize), _log(std::move(log)) {
+}
+
+std::string CompiledGraphCache::computeKey(
+        const ie::ICNNNetwork& network,
+        Platform platform,
+        const CompilationConfig& config) {
+    if (!config.customLayers.empty() || !config.irWithVpuScalesDir.empty() ||
+        !config.dumpInternalGraphFileName.empty() || !config.dumpInternalGraphDirectory.empty()) {
+        return {};
+    }
+
+    Hasher hasher;
+    hasher.value(CACHE_FORMAT_VERSION);
+    hasher.value(BLOB_VERSION_MAJOR);
+    hasher.value(BLOB_VERSION_MINOR);
+    hasher.string(ie::GetInferenceEngineVersion()->buildNumber);
+    hasher.value(static_cast<int>(platform));
+    hashConfig(hasher, config);
+
+    hasher.string(network.getName());
+    hasher.value(static_cast<std::uint64_t>(network.getBatchSize()));
+    hashInputsOutputs(hasher, network);
+
+    if (const auto function = network.getFunction()) {
+        if (!hashFunction(hasher, *function)) {
+            return {};
+        }
+    } else {
+        hashCNNNetwork(hasher, network);
+    }
+
+    return hasher.str();
+}
+
+std::string CompiledGraphCache::entryPath(const std::string& key) const {
+    return _directory + "/" + key + ENTRY_EXTENSION;
+}
+
+std::string CompiledGraphCache::indexPath() const {
+    return _directory + "/" + INDEX_FILE_NAME;
+}
+
+CompiledGraph::Ptr CompiledGraphCache::load(const std::string& key) const {
+    std::lock_guard<std::mutex> lock(g_cacheMutex);
+
+    Index index;
+    index.read(indexPath());
+
+    auto entry = index.entries.find(key);
+    if (entry == index.entries.end()) {
+        return nullptr;
+    }
+
+    CompiledGraph::Ptr compiledGraph;
+    std::string data;
+    if (readFile(entryPath(key), data)) {
+        try {
+            compiledGraph = deserializeEntry(data);
+        } catch (const std::exception& e) {
+            _log->warning("Compiled graph cache entry %s is removed : %s", key, e.what());
+        }
+    }
+
+    if (compiledGraph == nullptr) {
+        std::remove(entryPath(key).c_str());
+        index.entries.erase(entry);
+    } else {
+        entry->second.lastUse = ++index.counter;
+    }
+    index.write(indexPath());
+
+    return compiledGraph;
+}
+
+void CompiledGraphCache::store(const std::string& key, const CompiledGraph& compiledGraph) const {
+    const auto data = serializeEntry(compiledGraph);
+    if (data.size() > _maxSize) {
+        _log->debug("Compiled graph of %d bytes exceeds the cache size limit", data.size());
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(g_cacheMutex);
+
+    const auto path = entryPath(key);
+    const auto tmpPath = path + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::binary);
+        file.write(data.data(), data.size());
+        if (!file) {
+            _log->warning("Can't write compiled graph cache entry %s", tmpPath);
+            file.close();
+            std::remove(tmpPath.c_str());
+            return;
+        }
+    }
+    std::remove(path.c_str());
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        _log->warning("Can't write compiled graph cache entry %s", path);
+        std::remove(tmpPath.c_str());
+        return;
+    }
+
+    Index index;
+    index.read(indexPath());
+    index.entries[key] = {data.size(), ++index.counter};
+
+    std::uint64_t totalSize = 0;
+    for (const auto& entry : index.entries) {
+        totalSize += entry.second.size;
+    }
+
+    while (totalSize > _maxSize) {
+        auto lru = index.entries.begin();
+        for (auto it = index.entries.begin(); it != index.entries.end(); ++it) {
+            if (it->second.lastUse < lru->second.lastUse) {
+                lru = it;
+            }
+        }
+
+        _log->debug("Compiled graph cache entry %s is evicted", lru->first);
+        std::remove(entryPath(lru->first).c_str());
+        totalSize -= lru->second.size;
+        index.entries.erase(lru);
+    }
+
+    index.write(indexPath());
+}
+
+}  // namespace vpu
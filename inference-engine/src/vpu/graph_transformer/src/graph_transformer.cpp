@@ -35,6 +35,7 @@
 
 #include <vpu/parsed_config.hpp>
 #include <vpu/compile_env.hpp>
+#include <vpu/compiled_graph_cache.hpp>
 #include <vpu/stage_builder.hpp>
 #include <vpu/frontend/frontend.hpp>
 #include <vpu/backend/backend.hpp>
@@ -198,7 +199,32 @@ CompiledGraph::Ptr compileNetwork(
 
     VPU_PROFILE(compileNetwork);
 
-    return compileImpl(network);
+    const auto& env = CompileEnv::get();
+
+    if (env.config.compiledBlobCacheDir.empty()) {
+        return compileImpl(network);
+    }
+
+    const CompiledGraphCache cache(
+        env.config.compiledBlobCacheDir,
+        static_cast<std::uint64_t>(env.config.compiledBlobCacheSizeMB) * 1024 * 1024,
+        env.log);
+
+    const auto key = CompiledGraphCache::computeKey(network, platform, env.config);
+    if (key.empty()) {
+        env.log->debug("Network [%s] can't be cached", network.getName());
+        return compileImpl(network);
+    }
+
+    if (auto compiledGraph = cache.load(key)) {
+        env.log->info("Network [%s] is loaded from the compiled blobs cache", network.getName());
+        return compiledGraph;
+    }
+
+    auto compiledGraph = compileImpl(network);
+    cache.store(key, *compiledGraph);
+
+    return compiledGraph;
 }
 
 CompiledGraph::Ptr compileModel(
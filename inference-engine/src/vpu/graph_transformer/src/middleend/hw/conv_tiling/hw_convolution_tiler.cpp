@@ -7,6 +7,8 @@
 #include <vector>
 #include <memory>
 #include <utility>
+#include <set>
+#include <ie_parallel.hpp>
 #include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
 
 namespace vpu {
@@ -257,9 +259,9 @@ public:
 };
 
 HWConvolutionTiler::HWConvolutionTiler(ConvolutionOptions convolutionOptions, const Direction& direction,
-                                       std::size_t maxTilingOptions) :
+                                       std::size_t maxTilingOptions, HWConvolutionTilingCache* cache) :
     _convolutionOptions(std::move(convolutionOptions)),
-    _searcher(_convolutionOptions, direction, maxTilingOptions) {
+    _searcher(_convolutionOptions, direction, maxTilingOptions, cache) {
     _tilingPossible = tileForHW();
 }
 
@@ -614,26 +616,102 @@ std::unique_ptr<GraphDataTiling> ConvGraphDataTilingFactory::makeDirTiling(const
     }
 }
 
+HWConvolutionTilingCache::Key HWConvolutionTilingCache::makeKey(const ConvolutionOptions& convolutionOptions,
+                                                                const Direction& direction,
+                                                                std::size_t maxTilingOptions, int numCMXSlices) {
+    Key key = {
+        static_cast<int>(direction),
+        static_cast<int>(maxTilingOptions),
+        numCMXSlices,
+        convolutionOptions._kernelSizeX,
+        convolutionOptions._kernelSizeY,
+        convolutionOptions._kernelStride,
+        convolutionOptions._paddingLeft,
+        convolutionOptions._paddingRight,
+        convolutionOptions._paddingTop,
+        convolutionOptions._paddingBottom,
+        convolutionOptions._withPool ? 1 : 0
+    };
+
+    for (const auto& dims : {convolutionOptions._inputDims, convolutionOptions._outputDims,
+                             convolutionOptions._origOutputDims}) {
+        const auto values = dims.toVector(-1);
+        key.insert(key.end(), values.begin(), values.end());
+    }
+
+    return key;
+}
+
+void HWConvolutionTilingCache::prefetch(const std::vector<ConvolutionOptions>& convolutionOptions,
+                                        const Direction& direction, std::size_t maxTilingOptions) {
+    const auto numCMXSlices = CompileEnv::get().resources.numCMXSlices;
+
+    std::vector<const ConvolutionOptions*> toSearch;
+    std::set<Key> toSearchKeys;
+    for (const auto& options : convolutionOptions) {
+        auto key = makeKey(options, direction, maxTilingOptions, numCMXSlices);
+        if (_tilingOptions.count(key) == 0 && toSearchKeys.insert(std::move(key)).second) {
+            toSearch.push_back(&options);
+        }
+    }
+
+    std::vector<std::vector<TilingOption>> results(toSearch.size());
+    InferenceEngine::parallel_for(toSearch.size(), [&](size_t ind) {
+        results[ind] = HWConvolutionTilingSearcher::searchTilingOptions(*toSearch[ind], direction,
+                                                                       maxTilingOptions, numCMXSlices);
+    });
+
+    for (size_t ind = 0; ind < toSearch.size(); ++ind) {
+        _tilingOptions.emplace(makeKey(*toSearch[ind], direction, maxTilingOptions, numCMXSlices),
+                               std::move(results[ind]));
+    }
+}
+
+const std::vector<TilingOption>& HWConvolutionTilingCache::get(const ConvolutionOptions& convolutionOptions,
+                                                               const Direction& direction,
+                                                               std::size_t maxTilingOptions) {
+    const auto numCMXSlices = CompileEnv::get().resources.numCMXSlices;
+
+    auto key = makeKey(convolutionOptions, direction, maxTilingOptions, numCMXSlices);
+    auto it = _tilingOptions.find(key);
+    if (it == _tilingOptions.end()) {
+        auto tilingOptions = HWConvolutionTilingSearcher::searchTilingOptions(convolutionOptions, direction,
+                                                                              maxTilingOptions, numCMXSlices);
+        it = _tilingOptions.emplace(std::move(key), std::move(tilingOptions)).first;
+    }
+
+    return it->second;
+}
+
+std::vector<TilingOption> HWConvolutionTilingSearcher::searchTilingOptions(const ConvolutionOptions& convolutionOptions,
+                                                                           const Direction& direction,
+                                                                           std::size_t maxTilingOptions,
+                                                                           int numCMXSlices) {
+    const auto dirTiling = ConvGraphDataTilingFactory::makeDirTiling(convolutionOptions, direction);
+    dirTiling->initTileSizes();
+    return selectBetterTiling(*dirTiling, maxTilingOptions, numCMXSlices);
+}
+
 //
 // Looks for the optimal tiling accordingly to the cost function. Modifies dimensions in dirTiling during search.
 //
-std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() const {
-    const auto& env = CompileEnv::get();
-
-    auto& dirTiling = *_dirTiling;
-    FixedMaxHeap<TilingOption> tilingOptions(_maxTilingOptions);
+std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling(GraphDataTiling& dirTiling,
+                                                                          std::size_t maxTilingOptions,
+                                                                          int numCMXSlices) {
+    const auto& convolutionOptions = dirTiling.convolutionOptions();
+    FixedMaxHeap<TilingOption> tilingOptions(maxTilingOptions);
 
     // TODO: estimate this numbers
     const int maxNumWidthTiles = 15;
     const int maxNumHeightTiles = 15;
-    const int maxNumChannelTiles = _convolutionOptions._withPool ? 1 : 15;
+    const int maxNumChannelTiles = convolutionOptions._withPool ? 1 : 15;
 
     const auto outputTileInitial = dirTiling.getOutputTileDims();
     const auto inputTileInitial = dirTiling.getInputTileDims();
 
     auto minInputTileDimW = 64;
-    auto minInputTileDimH = _convolutionOptions._kernelSizeY;
-    if (_convolutionOptions._withPool) {
+    auto minInputTileDimH = convolutionOptions._kernelSizeY;
+    if (convolutionOptions._withPool) {
         minInputTileDimW *= 2;
         minInputTileDimH *= 2;
     }
@@ -641,11 +719,11 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
     const auto& splitOver = dirTiling.splitOverTensorDims();
     const auto direction = dirTiling.getDirection();
 
-    const auto cmxLimit = tilingCMXLimit(env.resources.numCMXSlices);
+    const auto cmxLimit = tilingCMXLimit(numCMXSlices);
 
     // split over Input tensor for the Channel dimension always
     for (int numChannelTiles = 1; numChannelTiles <= maxNumChannelTiles; numChannelTiles++) {
-        const int tileSizeDimC = divUp(_convolutionOptions._inputDims[Dim::C], numChannelTiles);
+        const int tileSizeDimC = divUp(convolutionOptions._inputDims[Dim::C], numChannelTiles);
 
         // here split and iterate either over input tensors or over output tensors depending on the direction.
         for (int numWidthTiles = 1; numWidthTiles <= maxNumWidthTiles; numWidthTiles++) {
@@ -657,7 +735,7 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
 
             if (numWidthTiles > 1 && direction == Direction::INPUT_TO_OUTPUT) {
                 tileSizeDimW = divUp(tileSizeDimW,
-                                     _convolutionOptions._kernelStride) * _convolutionOptions._kernelStride;
+                                     convolutionOptions._kernelStride) * convolutionOptions._kernelStride;
 
                 if (tileSizeDimW < minInputTileDimW) {
                     break;
@@ -672,15 +750,15 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
                 //
                 if (numHeightTiles > 1 && direction == Direction::INPUT_TO_OUTPUT) {
                     tileSizeDimH = divUp(tileSizeDimH,
-                                         _convolutionOptions._kernelStride) * _convolutionOptions._kernelStride;
+                                         convolutionOptions._kernelStride) * convolutionOptions._kernelStride;
 
                     updateInputTileSize(tileSizeDimH,
                                         numHeightTiles,
-                                        _convolutionOptions._outputDims[Dim::H],
-                                        _convolutionOptions._kernelSizeY,
-                                        _convolutionOptions._kernelStride,
-                                        _convolutionOptions._paddingBottom,
-                                        _convolutionOptions._paddingTop,
+                                        convolutionOptions._outputDims[Dim::H],
+                                        convolutionOptions._kernelSizeY,
+                                        convolutionOptions._kernelStride,
+                                        convolutionOptions._paddingBottom,
+                                        convolutionOptions._paddingTop,
                                         false);  // do not use ceil
 
                     if (tileSizeDimH < minInputTileDimH) {
@@ -701,7 +779,7 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
                 // Limitations for Conv+Pool case.
                 //
 
-                if (_convolutionOptions._withPool) {
+                if (convolutionOptions._withPool) {
                     if (dirTiling.getOutputTileDims()[Dim::W] <= 2 || dirTiling.getOutputTileDims()[Dim::H] <= 2) {
                         break;
                     }
@@ -713,10 +791,10 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
 
                 // TODO: check internal in/out hardcodes
                 const auto heightTiles = calcHeightTiles(
-                    _convolutionOptions, dirTiling.getOutputTileDims(),
+                    convolutionOptions, dirTiling.getOutputTileDims(),
                     dirTiling.useCeil());
                 const auto widthTiles = calcWidthTiles(
-                    _convolutionOptions, dirTiling.getOutputTileDims(),
+                    convolutionOptions, dirTiling.getOutputTileDims(),
                     dirTiling.useCeil());
 
                 if (heightTiles.empty()) {
@@ -735,7 +813,7 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
                         // Limitations for Conv+Pool case.
                         //
 
-                        if (_convolutionOptions._withPool) {
+                        if (convolutionOptions._withPool) {
                             if (widthTile.inputWithJunk % 2 != 0 || heightTile.inputWithJunk % 2 != 0 ||
                                 widthTile.outputWithJunk % 2 != 0 || widthTile.outputWithJunk <= 2 ||
                                 heightTile.outputWithJunk <= 2 ||
@@ -759,9 +837,9 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
                         const auto tileInfo = splitHwConvIntoOutChannelsTiles(  // left asis, not new ver in new api
                             widthTile.inputWithJunk, heightTile.inputWithJunk, tileSizeDimC,
                             outputTileInitial[Dim::C],
-                            _convolutionOptions._kernelSizeX,
-                            _convolutionOptions._kernelSizeY,
-                            _convolutionOptions._kernelStride);
+                            convolutionOptions._kernelSizeX,
+                            convolutionOptions._kernelSizeY,
+                            convolutionOptions._kernelStride);
 
                         if (tileInfo.numDescr == 0) {
                             isOK = false;
@@ -8,6 +8,9 @@
 #include <iomanip>
 #include <memory>
 #include <string>
+#include <map>
+#include <vector>
+#include <algorithm>
 
 #include <vpu/compile_env.hpp>
 
@@ -31,7 +34,7 @@ void PerStagePass::run(const Model& model) {
 // PassSet
 //
 
-void PassSet::run(const Model& model) const {
+void PassSet::run(const Model& model) {
     using MilliSecondsFP64 = std::chrono::duration<double, std::milli>;
 
     const auto& env = CompileEnv::get();
@@ -39,6 +42,9 @@ void PassSet::run(const Model& model) const {
     env.log->debug("MiddleEnd : Run passes");
     VPU_LOGGER_SECTION(env.log);
 
+    _timings.clear();
+    _timings.reserve(_passes.size());
+
     int passInd = 0;
     for (const auto& p : _passes) {
         env.log->debug("Start pass %m%d / %d [%s]", std::setw(2), passInd + 1, _passes.size(), p.second);
@@ -52,15 +58,50 @@ void PassSet::run(const Model& model) const {
 
         auto endTime = std::chrono::high_resolution_clock::now();
 
+        const auto durationMs = std::chrono::duration_cast<MilliSecondsFP64>(endTime - startTime).count();
+        _timings.push_back({p.second, durationMs});
+
         env.log->debug(
             "Pass %m%d / %d [%s] duration : %f ms",
-            std::setw(2), passInd + 1, _passes.size(), p.second,
-            std::chrono::duration_cast<MilliSecondsFP64>(endTime - startTime).count());
+            std::setw(2), passInd + 1, _passes.size(), p.second, durationMs);
 
         ++passInd;
     }
 
     model->cleanUp();
+
+    logTimingsSummary();
+}
+
+void PassSet::logTimingsSummary() const {
+    const auto& env = CompileEnv::get();
+
+    if (!env.log->isActive(LogLevel::Info)) {
+        return;
+    }
+
+    // passes like adjustDataLayout are added several times, so the summary accumulates them by name
+    std::map<std::string, std::pair<double, int>> perName;
+    double totalMs = 0.0;
+    for (const auto& timing : _timings) {
+        auto& entry = perName[timing.name];
+        entry.first += timing.durationMs;
+        entry.second++;
+        totalMs += timing.durationMs;
+    }
+
+    using NamedTiming = std::pair<std::string, std::pair<double, int>>;
+    std::vector<NamedTiming> sorted(perName.begin(), perName.end());
+    std::sort(sorted.begin(), sorted.end(), [](const NamedTiming& lhs, const NamedTiming& rhs) {
+        return lhs.second.first > rhs.second.first;
+    });
+
+    env.log->info("MiddleEnd : %d passes took %f ms", _timings.size(), totalMs);
+    VPU_LOGGER_SECTION(env.log);
+
+    for (const auto& entry : sorted) {
+        env.log->info("[%s] x%d : %f ms", entry.first, entry.second.second, entry.second.first);
+    }
 }
 
 //
@@ -8,6 +8,7 @@
 #include <utility>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include <vpu/compile_env.hpp>
 #include <vpu/stages/stub_stage.hpp>
@@ -31,16 +32,69 @@ private:
     StageBuilder::Ptr _stageBuilder;
 };
 
+bool isHwConvCandidate(const Stage& stage) {
+    return stage->type() == StageType::StubConv && stage->attrs().getOrDefault<bool>("tryHW", false);
+}
+
+HWTilingNS::ConvolutionOptions makeConvolutionOptions(
+        const Stage& origStage,
+        const HWConvStageOptions& stageOptions,
+        const HWConvStageIO& stageIO,
+        const DimValues& outputDims,
+        bool withPool) {
+    return HWTilingNS::ConvolutionOptions{
+        origStage->name(),
+        stageIO.origInput->desc().dims(),
+        outputDims,
+        stageIO.origOutputDesc.dims(),
+        stageOptions.kernelSizeX,
+        stageOptions.kernelSizeY,
+        stageOptions.kernelStride,
+        stageOptions.padLeft,
+        stageOptions.padRight,
+        stageOptions.padTop,
+        stageOptions.padBottom,
+        withPool
+    };
+}
+
 void PassImpl::run(const Model& model) {
     VPU_PROFILE(hwConvTiling);
 
-    for (const auto& origStage : model->getStages()) {
-        if (origStage->type() != StageType::StubConv) {
-            continue;
+    const auto& env = CompileEnv::get();
+
+    const size_t tilingsCount = 1;
+    const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
+                                         // HWTilingNS::Direction::OUTPUT_TO_INPUT;
+
+    //
+    // Search tilings for all the distinct convolution configurations in advance:
+    // the searches are independent, so they run in parallel, and identical convolutions share the result
+    //
+
+    HWTilingNS::HWConvolutionTilingCache tilingCache;
+
+    int numCandidates = 0;
+    {
+        std::vector<HWTilingNS::ConvolutionOptions> allOptions;
+        for (const auto& origStage : model->getStages()) {
+            if (!isHwConvCandidate(origStage)) {
+                continue;
+            }
+
+            const HWConvStageOptions stageOptions(origStage);
+            const HWConvStageIO stageIO(origStage, origStage->output(0));
+
+            allOptions.push_back(makeConvolutionOptions(origStage, stageOptions, stageIO,
+                                                        stageIO.origOutput->desc().dims(), stageOptions.withPool));
         }
 
-        const auto tryHW = origStage->attrs().getOrDefault<bool>("tryHW", false);
-        if (!tryHW) {
+        numCandidates = static_cast<int>(allOptions.size());
+        tilingCache.prefetch(allOptions, direction, tilingsCount);
+    }
+
+    for (const auto& origStage : model->getStages()) {
+        if (!isHwConvCandidate(origStage)) {
             continue;
         }
 
@@ -55,46 +109,19 @@ void PassImpl::run(const Model& model) {
         // Try to find "best" tiling
         //
 
-        const size_t tilingsCount = 1;
-        const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
-                                             // HWTilingNS::Direction::OUTPUT_TO_INPUT;
-
-        const auto convolutionOptions = HWTilingNS::ConvolutionOptions{
-            origStage->name(),
-            stageIO.origInput->desc().dims(),
-            stageIO.origOutput->desc().dims(),
-            stageIO.origOutputDesc.dims(),
-            stageOptions.kernelSizeX,
-            stageOptions.kernelSizeY,
-            stageOptions.kernelStride,
-            stageOptions.padLeft,
-            stageOptions.padRight,
-            stageOptions.padTop,
-            stageOptions.padBottom,
-            stageOptions.withPool
-        };
+        const auto convolutionOptions = makeConvolutionOptions(origStage, stageOptions, stageIO,
+                                                               stageIO.origOutput->desc().dims(),
+                                                               stageOptions.withPool);
 
-        const HWTilingNS::HWConvolutionTiler tiler1stAttempt(convolutionOptions, direction, tilingsCount);
+        const HWTilingNS::HWConvolutionTiler tiler1stAttempt(convolutionOptions, direction, tilingsCount, &tilingCache);
 
 
         const HWTilingNS::HWConvolutionTiler& tiler = [&] {
             if (!tiler1stAttempt.isTilingPossible() && tiler1stAttempt.withPool()) {
-                const auto optionsWithoutPool = HWTilingNS::ConvolutionOptions{
-                    origStage->name(),
-                    stageIO.origInput->desc().dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageOptions.kernelSizeX,
-                    stageOptions.kernelSizeY,
-                    stageOptions.kernelStride,
-                    stageOptions.padLeft,
-                    stageOptions.padRight,
-                    stageOptions.padTop,
-                    stageOptions.padBottom,
-                    false
-                };
-
-                return HWTilingNS::HWConvolutionTiler{optionsWithoutPool, direction, tilingsCount};
+                const auto optionsWithoutPool = makeConvolutionOptions(origStage, stageOptions, stageIO,
+                                                                       stageIO.origOutputDesc.dims(), false);
+
+                return HWTilingNS::HWConvolutionTiler{optionsWithoutPool, direction, tilingsCount, &tilingCache};
             } else {
                 return tiler1stAttempt;
             }
@@ -233,6 +260,9 @@ void PassImpl::run(const Model& model) {
 
         model->removeStage(origStage);
     }
+
+    env.log->debug("HW convolution tiling : %d convolutions, %d distinct configurations searched",
+                   numCandidates, tilingCache.size());
 }
 
 }  // namespace
@@ -36,6 +36,9 @@ IE_SUPPRESS_DEPRECATED_START
         VPU_CONFIG_KEY(CUSTOM_LAYERS),
         VPU_CONFIG_KEY(IGNORE_IR_STATISTIC),
 
+        VPU_MYRIAD_CONFIG_KEY(COMPILED_BLOB_CACHE_DIR),
+        VPU_MYRIAD_CONFIG_KEY(COMPILED_BLOB_CACHE_SIZE),
+
         VPU_CONFIG_KEY(INPUT_NORM),
         VPU_CONFIG_KEY(INPUT_BIAS),
 
@@ -193,6 +196,12 @@ void ParsedConfig::parse(const std::map<std::string, std::string>& config) {
 
     setOption(_compileConfig.ioStrides, config, VPU_CONFIG_KEY(TENSOR_STRIDES), parseStrides);
 
+    setOption(_compileConfig.compiledBlobCacheDir, config, VPU_MYRIAD_CONFIG_KEY(COMPILED_BLOB_CACHE_DIR));
+    setOption(_compileConfig.compiledBlobCacheSizeMB, config, VPU_MYRIAD_CONFIG_KEY(COMPILED_BLOB_CACHE_SIZE), parseInt);
+    if (_compileConfig.compiledBlobCacheSizeMB < 0) {
+        THROW_IE_EXCEPTION << "Value of VPU_MYRIAD_COMPILED_BLOB_CACHE_SIZE must be non-negative";
+    }
+
     setOption(_printReceiveTensorTime, switches,    config, VPU_CONFIG_KEY(PRINT_RECEIVE_TENSOR_TIME));
     setOption(_perfCount,              switches,    config, CONFIG_KEY(PERF_COUNT));
     setOption(_perfReport,             perfReports, config, VPU_CONFIG_KEY(PERF_REPORT_MODE));
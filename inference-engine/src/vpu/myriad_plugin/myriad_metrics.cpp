@@ -36,6 +36,8 @@ IE_SUPPRESS_DEPRECATED_START
         KEY_VPU_IGNORE_IR_STATISTIC,
         KEY_VPU_MYRIAD_FORCE_RESET,
         KEY_VPU_MYRIAD_PLATFORM,
+        KEY_VPU_MYRIAD_COMPILED_BLOB_CACHE_DIR,
+        KEY_VPU_MYRIAD_COMPILED_BLOB_CACHE_SIZE,
         KEY_EXCLUSIVE_ASYNC_REQUESTS,
         KEY_PERF_COUNT,
         KEY_CONFIG_FILE,
@@ -0,0 +1,167 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ie_core.hpp>
+#include <ie_binary_ir.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include <ngraph/variant.hpp>
+
+#include "common_test_utils/test_common.hpp"
+#include "../transformations/ngraph_test_utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+class BinaryIRCustomOp : public ngraph::op::Op {
+public:
+    static constexpr ngraph::NodeTypeInfo type_info{"BinaryIRCustomOp", 0};
+    const ngraph::NodeTypeInfo& get_type_info() const override { return type_info; }
+
+    explicit BinaryIRCustomOp(const ngraph::Output<ngraph::Node>& arg): Op({arg}) {
+        constructor_validate_and_infer_types();
+    }
+    void validate_and_infer_types() override {
+        set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+    }
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override {
+        return std::make_shared<BinaryIRCustomOp>(new_args.at(0));
+    }
+};
+
+constexpr ngraph::NodeTypeInfo BinaryIRCustomOp::type_info;
+
+}  // namespace
+
+class BinaryIRTests : public CommonTestUtils::TestsCommon {
+protected:
+    static std::shared_ptr<ngraph::Function> makeFunction() {
+        auto data = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 16, 16});
+        data->set_friendly_name("data");
+
+        std::vector<float> weightsValues(8 * 3 * 3 * 3);
+        for (size_t i = 0; i < weightsValues.size(); i++)
+            weightsValues[i] = static_cast<float>(i) / 10.f;
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{8, 3, 3, 3}, weightsValues);
+        weights->set_friendly_name("weights");
+        auto conv = std::make_shared<ngraph::opset1::Convolution>(data, weights, ngraph::Strides{1, 1},
+                                                                  ngraph::CoordinateDiff{1, 1}, ngraph::CoordinateDiff{1, 1},
+                                                                  ngraph::Strides{1, 1}, ngraph::op::PadType::EXPLICIT);
+        conv->set_friendly_name("conv");
+        conv->get_rt_info()["PrimitivesPriority"] = std::make_shared<ngraph::VariantWrapper<std::string>>("cpu:gemm");
+
+        auto bias = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 8, 1, 1},
+                                                     {1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f});
+        auto add = std::make_shared<ngraph::opset1::Add>(conv, bias);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(add);
+
+        auto k = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{}, {4});
+        auto topk = std::make_shared<ngraph::opset3::TopK>(relu, k, 1, ngraph::opset3::TopK::Mode::MAX,
+                                                           ngraph::opset3::TopK::SortType::SORT_VALUES);
+        topk->set_friendly_name("topk");
+
+        auto result = std::make_shared<ngraph::opset1::Result>(topk->output(0));
+        return std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{data}, "binary_ir");
+    }
+
+    static std::string serialize(const std::shared_ptr<ngraph::Function>& function) {
+        std::stringstream stream;
+        BinaryIR::serialize(*function, stream);
+        return stream.str();
+    }
+
+    static std::shared_ptr<ngraph::Node> findNode(const std::shared_ptr<ngraph::Function>& function, const std::string& name) {
+        for (const auto& node : function->get_ops()) {
+            if (node->get_friendly_name() == name)
+                return node;
+        }
+        return nullptr;
+    }
+};
+
+TEST_F(BinaryIRTests, functionIsRestored) {
+    const auto reference = makeFunction();
+    std::stringstream stream(serialize(reference));
+    ASSERT_TRUE(BinaryIR::isBinaryIR(stream));
+
+    const auto function = BinaryIR::parse(stream, {});
+    ASSERT_EQ("binary_ir", function->get_friendly_name());
+    const auto res = compare_functions(function, reference);
+    ASSERT_TRUE(res.first) << res.second;
+
+    auto conv = ngraph::as_type_ptr<ngraph::opset1::Convolution>(findNode(function, "conv"));
+    ASSERT_NE(nullptr, conv);
+    ASSERT_EQ(ngraph::CoordinateDiff({1, 1}), conv->get_pads_begin());
+    ASSERT_EQ(ngraph::op::PadType::EXPLICIT, conv->get_auto_pad());
+    auto priority = std::dynamic_pointer_cast<ngraph::VariantWrapper<std::string>>(conv->get_rt_info().at("PrimitivesPriority"));
+    ASSERT_NE(nullptr, priority);
+    ASSERT_EQ("cpu:gemm", priority->get());
+
+    auto topk = ngraph::as_type_ptr<ngraph::opset3::TopK>(findNode(function, "topk"));
+    ASSERT_NE(nullptr, topk);
+    ASSERT_EQ(1, topk->get_axis());
+    ASSERT_EQ(ngraph::opset3::TopK::Mode::MAX, topk->get_mode());
+    ASSERT_EQ(ngraph::opset3::TopK::SortType::SORT_VALUES, topk->get_sort_type());
+    ASSERT_EQ(ngraph::element::i32, topk->get_index_element_type());
+}
+
+TEST_F(BinaryIRTests, constantsAreRestored) {
+    const auto reference = makeFunction();
+    std::stringstream stream(serialize(reference));
+    const auto function = BinaryIR::parse(stream, {});
+
+    auto expected = ngraph::as_type_ptr<ngraph::opset1::Constant>(findNode(reference, "weights"));
+    auto weights = ngraph::as_type_ptr<ngraph::opset1::Constant>(findNode(function, "weights"));
+    ASSERT_NE(nullptr, weights);
+    ASSERT_EQ(expected->get_shape(), weights->get_shape());
+    ASSERT_EQ(expected->cast_vector<float>(), weights->cast_vector<float>());
+}
+
+TEST_F(BinaryIRTests, coreReadsBinaryIR) {
+    Core ie;
+    auto network = ie.ReadNetwork(serialize(makeFunction()), Blob::CPtr());
+    ASSERT_NE(nullptr, network.getFunction());
+    ASSERT_EQ(1, network.getInputsInfo().count("data"));
+    ASSERT_EQ((SizeVector{1, 3, 16, 16}), network.getInputsInfo().at("data")->getTensorDesc().getDims());
+}
+
+TEST_F(BinaryIRTests, truncatedModelIsRejected) {
+    auto model = serialize(makeFunction());
+    model.resize(model.size() - 16);
+    std::stringstream stream(model);
+    ASSERT_THROW(BinaryIR::parse(stream, {}), details::InferenceEngineException);
+}
+
+TEST_F(BinaryIRTests, corruptedCountsAreRejected) {
+    const auto reference = serialize(makeFunction());
+    // the graph section starts right after the header with the function name
+    const size_t headerSize = 8 + 2 * sizeof(uint32_t) + 4 * sizeof(uint64_t);
+    const size_t nodesCountOffset = headerSize + sizeof(uint32_t) + std::string("binary_ir").size();
+    const size_t graphSizeOffset = 8 + 2 * sizeof(uint32_t) + sizeof(uint64_t);
+
+    for (const auto offset : {nodesCountOffset, graphSizeOffset}) {
+        auto model = reference;
+        // a huge count is rejected before anything is allocated for it
+        std::memset(&model[offset], 0xff, sizeof(uint32_t));
+        std::stringstream stream(model);
+        ASSERT_THROW(BinaryIR::parse(stream, {}), details::InferenceEngineException) << "offset " << offset;
+    }
+}
+
+TEST_F(BinaryIRTests, operationsOutOfOpsetsAreNotSerialized) {
+    auto data = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3});
+    auto custom = std::make_shared<BinaryIRCustomOp>(data);
+    auto function = std::make_shared<ngraph::Function>(ngraph::NodeVector{custom}, ngraph::ParameterVector{data});
+    std::stringstream stream;
+    ASSERT_THROW(BinaryIR::serialize(*function, stream), details::InferenceEngineException);
+}
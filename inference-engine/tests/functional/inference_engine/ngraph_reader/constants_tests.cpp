@@ -0,0 +1,195 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+
+#include "ngraph_reader_tests.hpp"
+
+class NGraphReaderConstantsTests : public NGraphReaderTests {
+protected:
+    // Constants are stored in the weights in the order different from the order of layers
+    const std::string model = R"V0G0N(
+<net name="Network" version="10">
+    <layers>
+        <layer id="0" name="data" type="Parameter" version="opset1">
+            <data element_type="f32" shape="1,512"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>512</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="scale" type="Const" version="opset1">
+            <data offset="2064" size="2048"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>512</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="2" name="multiply" type="Multiply" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>512</dim>
+                </port>
+                <port id="1" precision="FP32">
+                    <dim>1</dim>
+                    <dim>512</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>1</dim>
+                    <dim>512</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="3" name="bias" type="Const" version="opset1">
+            <data offset="16" size="2048"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>512</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="4" name="add" type="Add" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>512</dim>
+                </port>
+                <port id="1" precision="FP32">
+                    <dim>1</dim>
+                    <dim>512</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>1</dim>
+                    <dim>512</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="5" name="shape" type="Const" version="opset1">
+            <data offset="0" size="16"/>
+            <output>
+                <port id="0" precision="I64">
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="6" name="reshape" type="Reshape" version="opset1">
+            <data special_zero="False"/>
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>512</dim>
+                </port>
+                <port id="1" precision="I64">
+                    <dim>2</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>512</dim>
+                    <dim>1</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="7" name="output" type="Result" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>512</dim>
+                    <dim>1</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="4" to-port="0"/>
+        <edge from-layer="3" from-port="0" to-layer="4" to-port="1"/>
+        <edge from-layer="4" from-port="2" to-layer="6" to-port="0"/>
+        <edge from-layer="5" from-port="0" to-layer="6" to-port="1"/>
+        <edge from-layer="6" from-port="2" to-layer="7" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    static constexpr size_t weightsSize = 16 + 2 * 512 * sizeof(float);
+
+    static Blob::Ptr makeWeights() {
+        auto weights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {weightsSize}, Layout::C));
+        weights->allocate();
+        auto shape = weights->buffer().as<int64_t*>();
+        shape[0] = 512;
+        shape[1] = 1;
+        auto values = reinterpret_cast<float*>(weights->buffer().as<uint8_t*>() + 16);
+        for (size_t i = 0; i < 2 * 512; i++) {
+            values[i] = static_cast<float>(i);
+        }
+        return weights;
+    }
+
+    static void checkConstants(const CNNNetwork& network) {
+        auto function = network.getFunction();
+        ASSERT_NE(nullptr, function);
+        for (const auto& node : function->get_ops()) {
+            auto constant = ngraph::as_type_ptr<ngraph::opset1::Constant>(node);
+            if (!constant) continue;
+            if (constant->get_friendly_name() == "shape") {
+                ASSERT_EQ((std::vector<int64_t>{512, 1}), constant->cast_vector<int64_t>());
+                continue;
+            }
+            const size_t first = constant->get_friendly_name() == "bias" ? 0 : 512;
+            const auto values = constant->cast_vector<float>();
+            ASSERT_EQ(512, values.size());
+            for (size_t i = 0; i < values.size(); i++) {
+                ASSERT_EQ(static_cast<float>(first + i), values[i]) << constant->get_friendly_name() << " at " << i;
+            }
+        }
+        ASSERT_EQ((ngraph::Shape{512, 1}), function->get_output_shape(0));
+    }
+};
+
+constexpr size_t NGraphReaderConstantsTests::weightsSize;
+
+TEST_F(NGraphReaderConstantsTests, ReadConstantsFromBlob) {
+    Core ie;
+    checkConstants(ie.ReadNetwork(model, makeWeights()));
+}
+
+TEST_F(NGraphReaderConstantsTests, ReadConstantsFromFile) {
+    const std::string modelPath = "NGraphReaderConstantsTests.xml";
+    const std::string weightsPath = "NGraphReaderConstantsTests.bin";
+    {
+        std::ofstream(modelPath) << model;
+        auto weights = makeWeights();
+        std::ofstream(weightsPath, std::ios::binary).write(weights->cbuffer().as<const char*>(), weightsSize);
+    }
+
+    Core ie;
+    CNNNetwork network;
+    ASSERT_NO_THROW(network = ie.ReadNetwork(modelPath, weightsPath));
+    std::remove(modelPath.c_str());
+    std::remove(weightsPath.c_str());
+    checkConstants(network);
+}
+
+TEST_F(NGraphReaderConstantsTests, ReadTruncatedWeightsThrows) {
+    auto weights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {weightsSize - 4}, Layout::C));
+    weights->allocate();
+    Core ie;
+    ASSERT_THROW(ie.ReadNetwork(model, weights), details::InferenceEngineException);
+}
@@ -19,7 +19,9 @@
 #include <ngraph/op/parameter.hpp>
 #include <ngraph/op/op.hpp>
 #include <ngraph/op/relu.hpp>
+#include <ngraph/op/reshape.hpp>
 #include <ngraph/op/result.hpp>
+#include <ngraph/op/shape_of.hpp>
 #include <ngraph/opsets/opset.hpp>
 
 #include <ie_util_internal.hpp>
@@ -152,6 +154,87 @@ TEST_F(NGraphReshapeTests, CNNReshapeSpatialReLU) {
     ASSERT_EQ(ngraph->get_results()[0]->get_shape(), ngraph::Shape({1, 3, 22, 22}));
 }
 
+TEST_F(NGraphReshapeTests, CNNReshapeOneOfInputs) {
+    std::shared_ptr<ngraph::Function> ngraph;
+    {
+        ngraph::element::Type type(ngraph::element::Type_t::f32);
+        auto param1 = std::make_shared<ngraph::op::Parameter>(type, ngraph::PartialShape({1, 3, 22, 22}));
+        param1->set_friendly_name("data1");
+        auto param2 = std::make_shared<ngraph::op::Parameter>(type, ngraph::PartialShape({1, 3, 10, 10}));
+        param2->set_friendly_name("data2");
+        auto relu1 = std::make_shared<ngraph::op::Relu>(param1);
+        relu1->set_friendly_name("relu1");
+        auto relu2 = std::make_shared<ngraph::op::Relu>(param2);
+        relu2->set_friendly_name("relu2");
+
+        ngraph::ParameterVector params = {param1, param2};
+        ngraph::ResultVector results = {std::make_shared<ngraph::op::Result>(relu1),
+                                        std::make_shared<ngraph::op::Result>(relu2)};
+
+        ngraph = std::make_shared<ngraph::Function>(results, params);
+    }
+
+    CNNNetwork cnnNetwork(ngraph);
+    std::map<std::string, std::vector<size_t>> shapes;
+    shapes["data1"] = {2, 3, 25, 25};
+
+    ASSERT_NO_THROW(cnnNetwork.reshape(shapes));
+
+    auto changedFunction = cnnNetwork.getFunction();
+    ASSERT_NE(nullptr, changedFunction);
+    ASSERT_EQ(changedFunction->get_results()[0]->get_shape(), ngraph::Shape({2, 3, 25, 25}));
+    ASSERT_EQ(changedFunction->get_results()[1]->get_shape(), ngraph::Shape({1, 3, 10, 10}));
+    ASSERT_EQ(cnnNetwork.getOutputsInfo()["relu1"]->getTensorDesc().getDims(), SizeVector({2, 3, 25, 25}));
+
+    // The same shapes don't change the network
+    auto param = changedFunction->get_parameters()[0];
+    shapes["data2"] = {1, 3, 10, 10};
+    ASSERT_NO_THROW(cnnNetwork.reshape(shapes));
+    ASSERT_EQ(param, cnnNetwork.getFunction()->get_parameters()[0]);
+    ASSERT_EQ(cnnNetwork.getInputsInfo()["data1"]->getTensorDesc().getDims(), SizeVector({2, 3, 25, 25}));
+
+    shapes["data1"] = {1, 3, 22, 22};
+    shapes["data2"] = {1, 3, 12, 12};
+    ASSERT_NO_THROW(cnnNetwork.reshape(shapes));
+    ASSERT_EQ(changedFunction->get_results()[0]->get_shape(), ngraph::Shape({1, 3, 22, 22}));
+    ASSERT_EQ(changedFunction->get_results()[1]->get_shape(), ngraph::Shape({1, 3, 12, 12}));
+    ASSERT_EQ(cnnNetwork.getOutputsInfo()["relu2"]->getTensorDesc().getDims(), SizeVector({1, 3, 12, 12}));
+}
+
+TEST_F(NGraphReshapeTests, CNNReshapeShapeOfToReshape) {
+    std::shared_ptr<ngraph::Function> ngraph;
+    {
+        ngraph::element::Type type(ngraph::element::Type_t::f32);
+        auto shapeSource = std::make_shared<ngraph::op::Parameter>(type, ngraph::PartialShape({1, 3, 4, 4}));
+        shapeSource->set_friendly_name("shape_source");
+        auto data = std::make_shared<ngraph::op::Parameter>(type, ngraph::PartialShape({1, 48}));
+        data->set_friendly_name("data");
+        auto shapeOf = std::make_shared<ngraph::op::ShapeOf>(shapeSource);
+        shapeOf->set_friendly_name("shape_of");
+        auto reshape = std::make_shared<ngraph::op::v1::Reshape>(data, shapeOf, false);
+        reshape->set_friendly_name("reshape");
+
+        ngraph::ParameterVector params = {shapeSource, data};
+        ngraph::ResultVector results = {std::make_shared<ngraph::op::Result>(reshape)};
+
+        ngraph = std::make_shared<ngraph::Function>(results, params);
+    }
+
+    CNNNetwork cnnNetwork(ngraph);
+    ASSERT_EQ(cnnNetwork.getOutputsInfo()["reshape"]->getTensorDesc().getDims(), SizeVector({1, 3, 4, 4}));
+
+    // The shape of ShapeOf output stays the same, but its value changes the Reshape output
+    std::map<std::string, std::vector<size_t>> shapes;
+    shapes["shape_source"] = {1, 3, 8, 2};
+    ASSERT_NO_THROW(cnnNetwork.reshape(shapes));
+    ASSERT_EQ(cnnNetwork.getOutputsInfo()["reshape"]->getTensorDesc().getDims(), SizeVector({1, 3, 8, 2}));
+
+    shapes["shape_source"] = {2, 3, 4, 4};
+    shapes["data"] = {2, 48};
+    ASSERT_NO_THROW(cnnNetwork.reshape(shapes));
+    ASSERT_EQ(cnnNetwork.getOutputsInfo()["reshape"]->getTensorDesc().getDims(), SizeVector({2, 3, 4, 4}));
+}
+
 class CustomTestLayerImpl : public InferenceEngine::IShapeInferImpl {
 public:
     InferenceEngine::StatusCode inferShapes(const std::vector<InferenceEngine::Blob::CPtr>& inBlobs,
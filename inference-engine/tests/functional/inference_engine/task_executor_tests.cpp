@@ -3,6 +3,7 @@
 //
 
 #include <future>
+#include <limits>
 
 #include <gtest/gtest.h>
 
@@ -185,6 +186,44 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
     ASSERT_EQ(1, useCount);
 }
 
+static bool denormalIsFlushed() {
+    volatile float normal = std::numeric_limits<float>::min();
+    return normal / 2 == 0;
+}
+
+TEST(CPUStreamsExecutorTests, denormalsAreZeroOnAllStreamThreads) {
+    const bool wasSet = set_denormals_as_zero(true);
+    if (!set_denormals_as_zero(wasSet)) {
+        return;  // the modes are not supported by the CPU
+    }
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor", 2, parallel_get_max_threads()};
+    config._denormalsAsZero = true;
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(config);
+    std::atomic_int notFlushed = {0};
+    std::vector<Task> tasks(4, [&] {
+        parallel_for(1024, [&] (int) {
+            if (!denormalIsFlushed()) notFlushed++;
+        });
+    });
+    taskExecutor->runAndWait(tasks);
+    ASSERT_EQ(0, notFlushed);
+}
+
+TEST(CPUStreamsExecutorTests, denormalsModesOfCallerThreadAreRestored) {
+    const bool wasSet = set_denormals_as_zero(true);
+    if (!set_denormals_as_zero(false)) {
+        return;  // the modes are not supported by the CPU
+    }
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor", 0};
+    config._denormalsAsZero = true;
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(config);
+    bool flushed = false;
+    taskExecutor->run([&] { flushed = denormalIsFlushed(); });
+    ASSERT_TRUE(flushed);
+    ASSERT_FALSE(denormalIsFlushed());
+    set_denormals_as_zero(wasSet);
+}
+
 static auto Executors = ::testing::Values(
     [] {
         auto streams = getNumberOfCPUCores();
@@ -0,0 +1,149 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <auto_batch/auto_batch_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+
+using namespace InferenceEngine;
+
+namespace AutoBatchTestsDefinitions {
+
+constexpr size_t channels = 4;
+
+class AutoBatchCPUTest : public CommonTestUtils::TestsCommon {
+protected:
+    // output = relu(input - 1)
+    static CNNNetwork makeNetwork() {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, channels});
+        input->set_friendly_name("input");
+        auto shift = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, channels},
+                                                      std::vector<float>{-1.f});
+        auto add = std::make_shared<ngraph::opset1::Add>(input, shift);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(add);
+        relu->set_friendly_name("output");
+        return CNNNetwork(std::make_shared<ngraph::Function>(
+            ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(relu)}, ngraph::ParameterVector{input}));
+    }
+
+    void load(int batch, int timeoutMs) {
+        std::map<std::string, std::string> config = {
+            {AUTO_BATCH_CONFIG_KEY(DEVICE), std::string(CommonTestUtils::DEVICE_CPU) + "(" + std::to_string(batch) + ")"},
+            {AUTO_BATCH_CONFIG_KEY(TIMEOUT), std::to_string(timeoutMs)}
+        };
+        executableNetwork = PluginCache::get().ie()->LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_BATCH, config);
+    }
+
+    static std::vector<float> makeInput(size_t requestId) {
+        std::vector<float> input(channels);
+        for (size_t c = 0; c < channels; c++) {
+            input[c] = static_cast<float>(requestId) - static_cast<float>(c) * 0.5f;
+        }
+        return input;
+    }
+
+    // Runs the requests at once and checks every request got the result for its own input
+    void runAndCheck(std::vector<InferRequest>& requests) {
+        for (size_t i = 0; i < requests.size(); i++) {
+            auto input = makeInput(i);
+            auto blob = requests[i].GetBlob("input");
+            std::copy(input.begin(), input.end(), blob->buffer().as<float*>());
+        }
+        for (auto&& request : requests) {
+            request.StartAsync();
+        }
+        for (size_t i = 0; i < requests.size(); i++) {
+            ASSERT_EQ(StatusCode::OK, requests[i].Wait(IInferRequest::WaitMode::RESULT_READY));
+            auto input = makeInput(i);
+            auto output = requests[i].GetBlob("output")->cbuffer().as<const float*>();
+            for (size_t c = 0; c < channels; c++) {
+                ASSERT_FLOAT_EQ(std::max(input[c] - 1.f, 0.f), output[c]) << "request " << i << " channel " << c;
+            }
+        }
+    }
+
+    float getMetric(const std::string& name) {
+        return executableNetwork.GetMetric(name).as<float>();
+    }
+
+    ExecutableNetwork executableNetwork;
+};
+
+TEST_F(AutoBatchCPUTest, BatchedOutputsMatchEveryRequest) {
+    // the timeout is never reached, the requests are executed only if they form the batch
+    load(4, 60000);
+    std::vector<InferRequest> requests;
+    for (size_t i = 0; i < 4; i++) {
+        requests.push_back(executableNetwork.CreateInferRequest());
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    runAndCheck(requests);
+    runAndCheck(requests);
+    const auto elapsed = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    ASSERT_EQ(4.f, getMetric(AUTO_BATCH_METRIC(AVERAGE_BATCH_SIZE)));
+    const auto queueDelay = getMetric(AUTO_BATCH_METRIC(AVERAGE_QUEUE_DELAY));
+    ASSERT_GE(queueDelay, 0.f);
+    ASSERT_LE(queueDelay, elapsed);
+}
+
+TEST_F(AutoBatchCPUTest, RequestsOfDifferentBatchesAreCombined) {
+    load(4, 60000);
+    std::vector<InferRequest> requests;
+    for (size_t i = 0; i < 6; i++) {
+        requests.push_back(executableNetwork.CreateInferRequest());
+    }
+
+    // requests created for different batched requests form one batch
+    std::vector<InferRequest> lastRequests(requests.begin() + 2, requests.end());
+    runAndCheck(lastRequests);
+    ASSERT_EQ(4.f, getMetric(AUTO_BATCH_METRIC(AVERAGE_BATCH_SIZE)));
+}
+
+TEST_F(AutoBatchCPUTest, BlobsSetByUserAreCopied) {
+    load(4, 60000);
+    std::vector<InferRequest> requests;
+    for (size_t i = 0; i < 4; i++) {
+        requests.push_back(executableNetwork.CreateInferRequest());
+    }
+
+    // the ports with blobs set by the user are copied, the default blobs of other ports are used in place
+    auto input = make_shared_blob<float>({Precision::FP32, {1, channels}, Layout::NC});
+    input->allocate();
+    auto output = make_shared_blob<float>({Precision::FP32, {1, channels}, Layout::NC});
+    output->allocate();
+    requests[1].SetBlob("input", input);
+    requests[2].SetBlob("output", output);
+
+    runAndCheck(requests);
+    runAndCheck(requests);
+    ASSERT_EQ(output, requests[2].GetBlob("output"));
+    ASSERT_EQ(4.f, getMetric(AUTO_BATCH_METRIC(AVERAGE_BATCH_SIZE)));
+}
+
+TEST_F(AutoBatchCPUTest, TimeoutExecutesRequestsWithoutBatch) {
+    const int timeoutMs = 20;
+    load(4, timeoutMs);
+    std::vector<InferRequest> requests = {executableNetwork.CreateInferRequest()};
+
+    runAndCheck(requests);
+
+    ASSERT_EQ(1.f, getMetric(AUTO_BATCH_METRIC(AVERAGE_BATCH_SIZE)));
+    ASSERT_GE(getMetric(AUTO_BATCH_METRIC(AVERAGE_QUEUE_DELAY)), static_cast<float>(timeoutMs));
+}
+
+}  // namespace AutoBatchTestsDefinitions
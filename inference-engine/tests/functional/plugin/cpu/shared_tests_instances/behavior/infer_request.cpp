@@ -6,6 +6,7 @@
 
 #include "behavior/infer_request.hpp"
 #include "ie_plugin_config.hpp"
+#include "auto_batch/auto_batch_config.hpp"
 namespace {
 
     const std::vector<InferenceEngine::Precision> netPrecisions = {
@@ -23,6 +24,11 @@ namespace {
             {{ MULTI_CONFIG_KEY(DEVICE_PRIORITIES) , CommonTestUtils::DEVICE_CPU}}
     };
 
+    const std::vector<std::map<std::string, std::string>> AutoBatchConfigs = {
+            {{ AUTO_BATCH_CONFIG_KEY(DEVICE) , std::string(CommonTestUtils::DEVICE_CPU) + "(2)"},
+             { AUTO_BATCH_CONFIG_KEY(TIMEOUT) , "10"}}
+    };
+
     INSTANTIATE_TEST_CASE_P(smoke_BehaviorTests, InferRequestTests,
                             ::testing::Combine(
                                     ::testing::ValuesIn(netPrecisions),
@@ -36,4 +42,11 @@ namespace {
                                     ::testing::Values(CommonTestUtils::DEVICE_MULTI),
                                     ::testing::ValuesIn(Multiconfigs)),
                             InferRequestTests::getTestCaseName);
+
+    INSTANTIATE_TEST_CASE_P(smoke_AutoBatch_BehaviorTests, InferRequestTests,
+                            ::testing::Combine(
+                                    ::testing::ValuesIn(netPrecisions),
+                                    ::testing::Values(CommonTestUtils::DEVICE_BATCH),
+                                    ::testing::ValuesIn(AutoBatchConfigs)),
+                            InferRequestTests::getTestCaseName);
 }  // namespace
@@ -0,0 +1,59 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+
+#include "single_layer_tests/topk.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+using namespace LayerTestsDefinitions;
+
+namespace {
+
+const std::vector<InferenceEngine::Precision> netPrecisions = {
+        InferenceEngine::Precision::FP32
+};
+
+const std::vector<std::string> modes = {"max", "min"};
+const std::vector<std::string> sorts = {"value", "index", "none"};
+
+const auto topKParams = ::testing::Combine(
+        ::testing::Values(std::vector<size_t>{5, 7, 9}),
+        ::testing::ValuesIn(netPrecisions),
+        ::testing::Values(0, 1, 2),
+        ::testing::Values(1, 3),
+        ::testing::ValuesIn(modes),
+        ::testing::ValuesIn(sorts),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_CASE_P(smoke_TopK, TopKLayerTest, topKParams, TopKLayerTest::getTestCaseName);
+
+// Long rows with small k use the threshold based selection, large k relative to the row keeps the sorting path
+const auto topKLargeAxisParams = ::testing::Combine(
+        ::testing::Values(std::vector<size_t>{4, 300}, std::vector<size_t>{4, 3000}, std::vector<size_t>{2, 30000}),
+        ::testing::ValuesIn(netPrecisions),
+        ::testing::Values(-1),
+        ::testing::Values(2, 5, 64),
+        ::testing::ValuesIn(modes),
+        ::testing::ValuesIn(sorts),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_CASE_P(smoke_TopK_LargeAxis, TopKLayerTest, topKLargeAxisParams, TopKLayerTest::getTestCaseName);
+
+// A single long row is split between threads and the partial results are merged
+const auto topKSplitRowParams = ::testing::Combine(
+        ::testing::Values(std::vector<size_t>{1, 250000}),
+        ::testing::ValuesIn(netPrecisions),
+        ::testing::Values(-1),
+        ::testing::Values(10),
+        ::testing::ValuesIn(modes),
+        ::testing::ValuesIn(sorts),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_CASE_P(smoke_TopK_SplitRow, TopKLayerTest, topKSplitRowParams, TopKLayerTest::getTestCaseName);
+
+}  // namespace
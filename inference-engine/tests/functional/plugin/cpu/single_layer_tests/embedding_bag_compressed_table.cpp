@@ -0,0 +1,163 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+#include <string>
+#include <memory>
+
+#include <cpu/cpu_config.hpp>
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        std::vector<size_t>,  // emb_table_shape
+        std::vector<size_t>,  // indices
+        std::vector<size_t>,  // offsets
+        bool,                 // with_weights
+        std::string,          // table storage precision
+        float                 // threshold, the quantization error of U8 tables is added to it
+> embeddingBagCompressedTableParams;
+
+class EmbeddingBagCompressedTableCPUTest : public testing::WithParamInterface<embeddingBagCompressedTableParams>,
+                                           public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<embeddingBagCompressedTableParams> obj) {
+        std::vector<size_t> embTableShape, indices, offsets;
+        bool withWeights;
+        std::string tablePrecision;
+        float thr;
+        std::tie(embTableShape, indices, offsets, withWeights, tablePrecision, thr) = obj.param;
+
+        std::ostringstream result;
+        result << "ETS=" << CommonTestUtils::vec2str(embTableShape) << "_";
+        result << "I" << CommonTestUtils::vec2str(indices) << "_";
+        result << "O" << CommonTestUtils::vec2str(offsets) << "_";
+        result << "WW" << withWeights << "_";
+        result << "tablePRC=" << tablePrecision;
+        return result.str();
+    }
+
+protected:
+    // Rounding to the nearest of 256 levels errs by a half of the row quantization step at most,
+    // the errors of the rows of a bag are accumulated with their weights
+    static float quantizationError(const std::vector<float>& table, size_t rows, const std::vector<size_t>& indices,
+                                   const std::vector<size_t>& offsets, const std::vector<float>& weights) {
+        const size_t depth = table.size() / rows;
+        std::vector<float> rowError(rows);
+        for (size_t r = 0; r < rows; r++) {
+            const auto minMax = std::minmax_element(table.begin() + r * depth, table.begin() + (r + 1) * depth);
+            rowError[r] = (*minMax.second - *minMax.first) / 255.f / 2.f;
+        }
+
+        float maxError = 0.f;
+        for (size_t b = 0; b < offsets.size(); b++) {
+            const size_t end = b + 1 < offsets.size() ? offsets[b + 1] : indices.size();
+            float error = 0.f;
+            for (size_t i = offsets[b]; i < end; i++)
+                error += (weights.empty() ? 1.f : weights[i]) * rowError[indices[i]];
+            // an empty bag of a weighted layer takes the row of the default index
+            if (offsets[b] == end && !weights.empty())
+                error = rowError[defaultIndex];
+            maxError = std::max(maxError, error);
+        }
+        return maxError;
+    }
+
+    void SetUp() override {
+        std::vector<size_t> embTableShape, indices, offsets;
+        bool withWeights;
+        std::string tablePrecision;
+        std::tie(embTableShape, indices, offsets, withWeights, tablePrecision, threshold) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({CPUConfigParams::KEY_CPU_EMBEDDING_TABLE_PRECISION, tablePrecision});
+
+        // The table has to be a constant to be packed by the plugin
+        size_t tableSize = 1;
+        for (auto dim : embTableShape)
+            tableSize *= dim;
+        std::vector<float> tableData(tableSize);
+        for (size_t i = 0; i < tableSize; i++)
+            tableData[i] = static_cast<float>(static_cast<int>(i * 37 % 33) - 16) / 8.f;
+        auto embTable = ngraph::builder::makeConstant(ngraph::element::f32, embTableShape, tableData);
+
+        auto indicesNode = ngraph::opset1::Constant::create(ngraph::element::i32, {indices.size()}, indices);
+        auto offsetsNode = ngraph::opset1::Constant::create(ngraph::element::i32, {offsets.size()}, offsets);
+        std::vector<float> weights;
+        std::shared_ptr<ngraph::Node> embBag;
+        if (withWeights) {
+            for (size_t i = 0; i < indices.size(); i++)
+                weights.push_back(static_cast<float>(i % 4 + 1) / 2.f);
+            auto defaultIndexNode = ngraph::opset1::Constant::create(ngraph::element::i32, {}, {defaultIndex});
+            auto weightsNode = ngraph::opset1::Constant::create(ngraph::element::f32, {weights.size()}, weights);
+            embBag = std::make_shared<ngraph::opset3::EmbeddingBagOffsetsSum>(
+                    embTable, indicesNode, offsetsNode, defaultIndexNode, weightsNode);
+        } else {
+            embBag = std::make_shared<ngraph::opset3::EmbeddingBagOffsetsSum>(embTable, indicesNode, offsetsNode);
+        }
+        if (tablePrecision == "U8")
+            threshold += quantizationError(tableData, embTableShape[0], indices, offsets, weights);
+
+        auto outShape = embTableShape;
+        outShape[0] = offsets.size();
+        auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape(outShape));
+        auto add = std::make_shared<ngraph::opset1::Add>(embBag, param);
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(add)};
+        function = std::make_shared<ngraph::Function>(results, ngraph::ParameterVector{param}, "embeddingBagCompressedTable");
+    }
+
+    static constexpr size_t defaultIndex = 1;
+};
+
+constexpr size_t EmbeddingBagCompressedTableCPUTest::defaultIndex;
+
+TEST_P(EmbeddingBagCompressedTableCPUTest, CompareWithRefs) {
+    Run();
+}
+
+namespace {
+
+const std::vector<std::vector<size_t>> embTableShapes = {{10, 35}, {5, 4, 16}, {64, 128}};
+const std::vector<std::vector<size_t>> indices = {{0, 1, 2, 2, 3, 4, 4, 3, 1, 0}};
+const std::vector<std::vector<size_t>> offsets = {{0, 2, 2, 7}, {0, 9}};
+
+INSTANTIATE_TEST_CASE_P(smoke_FP32, EmbeddingBagCompressedTableCPUTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(embTableShapes),
+                                ::testing::ValuesIn(indices),
+                                ::testing::ValuesIn(offsets),
+                                ::testing::Values(false, true),
+                                ::testing::Values("FP32"),
+                                ::testing::Values(1e-5f)),
+                        EmbeddingBagCompressedTableCPUTest::getTestCaseName);
+
+// Table values are multiples of 1/8 in [-2, 2], so 16-bit formats keep them exactly
+INSTANTIATE_TEST_CASE_P(smoke_16bit, EmbeddingBagCompressedTableCPUTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(embTableShapes),
+                                ::testing::ValuesIn(indices),
+                                ::testing::ValuesIn(offsets),
+                                ::testing::Values(false, true),
+                                ::testing::Values("FP16", "BF16"),
+                                ::testing::Values(1e-3f)),
+                        EmbeddingBagCompressedTableCPUTest::getTestCaseName);
+
+// The quantization error of every bag is computed from the steps of its rows, the threshold covers rounding of sums
+INSTANTIATE_TEST_CASE_P(smoke_U8, EmbeddingBagCompressedTableCPUTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(embTableShapes),
+                                ::testing::ValuesIn(indices),
+                                ::testing::ValuesIn(offsets),
+                                ::testing::Values(false, true),
+                                ::testing::Values("U8"),
+                                ::testing::Values(1e-4f)),
+                        EmbeddingBagCompressedTableCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace CPULayerTestsDefinitions
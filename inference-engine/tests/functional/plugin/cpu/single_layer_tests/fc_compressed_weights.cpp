@@ -0,0 +1,219 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+#include <vector>
+#include <string>
+#include <memory>
+
+#include <cpu/cpu_config.hpp>
+#include <exec_graph_info.hpp>
+#include "network_serializer.h"
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        std::vector<size_t>,  // input shape
+        size_t,               // output channels
+        std::string,          // weights storage precision
+        bool,                 // weights are on the quantization grid
+        std::string           // dynamic quantization of activations
+> fcCompressedWeightsParams;
+
+class FullyConnectedCompressedWeightsCPUTest : public testing::WithParamInterface<fcCompressedWeightsParams>,
+                                               public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<fcCompressedWeightsParams> obj) {
+        std::vector<size_t> inShape;
+        size_t outChannels;
+        std::string weightsPrecision;
+        bool onGrid;
+        std::string dynamicQuantization;
+        std::tie(inShape, outChannels, weightsPrecision, onGrid, dynamicQuantization) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inShape) << "_";
+        result << "OC=" << outChannels << "_";
+        result << "weightsPRC=" << weightsPrecision << "_";
+        result << "onGrid=" << onGrid << "_";
+        result << "dynQ=" << dynamicQuantization;
+        return result.str();
+    }
+
+    void Compare(const std::vector<std::uint8_t> &expected, const InferenceEngine::Blob::Ptr &actual) override {
+        const bool dynamic = dynamicQuantization != PluginConfigParams::NO;
+        if (!dynamic && (weightsPrecision == "FP32" || onGrid)) {
+            LayerTestsCommon::Compare(expected, actual);
+            return;
+        }
+
+        // Symmetric quantization changes every weight by at most half of the channel scale,
+        // so |y - y_ref| <= w_scale / 2 * sum(|x|) for every output. Quantized activations add
+        // up to x_scale / 2 * sum(|w|) where x_scale covers the range of the row or of the tensor
+        // with 127 levels (CPUs with VNNI use 255 levels, so the bound holds for them as well).
+        ASSERT_EQ(expected.size(), actual->byteSize());
+        const auto* ref = reinterpret_cast<const float*>(expected.data());
+        const auto* res = actual->cbuffer().as<const float*>();
+        const auto* src = inputs[0]->cbuffer().as<const float*>();
+        const size_t batch = inputs[0]->size() / inChannels;
+        auto getRange = [&](size_t begin, size_t end) {
+            float minValue = 0.f, maxValue = 0.f;
+            for (size_t i = begin; i < end; i++) {
+                minValue = std::min(minValue, src[i]);
+                maxValue = std::max(maxValue, src[i]);
+            }
+            return maxValue - minValue;
+        };
+        const float tensorRange = getRange(0, batch * inChannels);
+        for (size_t b = 0; b < batch; b++) {
+            float srcL1 = 0.f;
+            for (size_t i = 0; i < inChannels; i++)
+                srcL1 += std::abs(src[b * inChannels + i]);
+            float srcScale = 0.f;
+            if (dynamicQuantization == CPUConfigParams::CPU_PER_ROW)
+                srcScale = getRange(b * inChannels, (b + 1) * inChannels) / 127.f;
+            else if (dynamicQuantization == CPUConfigParams::CPU_PER_TENSOR)
+                srcScale = tensorRange / 127.f;
+            for (size_t o = 0; o < outChannels; o++) {
+                float absMax = 0.f, weightsL1 = 0.f;
+                for (size_t i = 0; i < inChannels; i++) {
+                    absMax = std::max(absMax, std::abs(weightsData[o * inChannels + i]));
+                    weightsL1 += std::abs(weightsData[o * inChannels + i]);
+                }
+                const float weightsScale = absMax / levels;
+                // quantized weights differ from weightsData by up to weightsScale / 2,
+                // plus a margin for the different order of FP32 accumulation
+                const float bound = (0.5f * weightsScale + 1e-5f * absMax) * srcL1 +
+                                    0.5f * srcScale * (weightsL1 + 0.5f * weightsScale * inChannels);
+                ASSERT_LE(std::abs(res[b * outChannels + o] - ref[b * outChannels + o]), bound)
+                    << "at batch " << b << " channel " << o;
+            }
+        }
+    }
+
+    IE_SUPPRESS_DEPRECATED_START
+    // Checks the FullyConnected primitive runs on the weights of the requested precision
+    // and computes on quantized activations if dynamic quantization is enabled
+    void CheckExecGraph() {
+        const bool dynamic = dynamicQuantization != PluginConfigParams::NO;
+        // dynamic quantization packs weights to I8 unless they are already compressed
+        const std::string expectedWeightsPrecision = weightsPrecision != "FP32" ? weightsPrecision : dynamic ? "I8" : "";
+        size_t numFullyConnected = 0;
+        for (const auto& node : Serialization::TopologicalSort(executableNetwork.GetExecGraphInfo())) {
+            if (node->type != "FullyConnected")
+                continue;
+            numFullyConnected++;
+            auto precision = node->params.find(ExecGraphInfoSerialization::WEIGHTS_PRECISION);
+            if (expectedWeightsPrecision.empty()) {
+                ASSERT_EQ(node->params.end(), precision);
+            } else {
+                ASSERT_NE(node->params.end(), precision);
+                ASSERT_EQ(expectedWeightsPrecision, precision->second);
+            }
+            auto runtimePrecision = node->params.find(ExecGraphInfoSerialization::RUNTIME_PRECISION);
+            ASSERT_NE(node->params.end(), runtimePrecision);
+            ASSERT_EQ(dynamic ? "I8" : "FP32", runtimePrecision->second);
+        }
+        ASSERT_EQ(1u, numFullyConnected);
+    }
+    IE_SUPPRESS_DEPRECATED_END
+
+protected:
+    void SetUp() override {
+        std::vector<size_t> inShape;
+        std::tie(inShape, outChannels, weightsPrecision, onGrid, dynamicQuantization) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        threshold = 1e-4f;
+        configuration.insert({CPUConfigParams::KEY_CPU_FC_WEIGHTS_PRECISION, weightsPrecision});
+        configuration.insert({CPUConfigParams::KEY_CPU_DYNAMIC_QUANTIZATION, dynamicQuantization});
+        // the reference is computed in FP32, so the rest of the network must not be enforced to BF16
+        configuration.insert({PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO});
+
+        // On the grid every row is k / 8 with |k| <= levels and k = levels in the first column,
+        // so the per channel scale is exactly 1 / 8 and quantization is lossless.
+        // Otherwise weights are arbitrary values in [-1, 1].
+        // Dynamic quantization packs FP32 weights to I8.
+        levels = weightsPrecision == "I4" ? 7 : 127;
+        inChannels = inShape.back();
+        weightsData.resize(outChannels * inChannels);
+        for (size_t o = 0; o < outChannels; o++) {
+            for (size_t i = 0; i < inChannels; i++) {
+                float value;
+                if (onGrid) {
+                    const int k = i == 0 ? levels : static_cast<int>((o * 31 + i * 17) % (2 * levels + 1)) - levels;
+                    value = static_cast<float>(k) / 8.f;
+                } else {
+                    value = static_cast<float>(static_cast<int>((o * 131 + i * 71) % 2001) - 1000) / 1000.f;
+                }
+                weightsData[o * inChannels + i] = value;
+            }
+        }
+
+        auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape(inShape));
+        auto weights = ngraph::builder::makeConstant(ngraph::element::f32, {outChannels, inChannels}, weightsData);
+        auto matMul = std::make_shared<ngraph::opset1::MatMul>(param, weights, false, true);
+        std::vector<float> biasData(outChannels);
+        for (size_t o = 0; o < outChannels; o++)
+            biasData[o] = static_cast<float>(o % 5) - 2.f;
+        auto bias = ngraph::builder::makeConstant(ngraph::element::f32, {1, outChannels}, biasData);
+        auto add = std::make_shared<ngraph::opset1::Add>(matMul, bias);
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(add)};
+        function = std::make_shared<ngraph::Function>(results, ngraph::ParameterVector{param}, "fullyConnectedCompressedWeights");
+    }
+
+    size_t inChannels = 0;
+    size_t outChannels = 0;
+    std::string weightsPrecision;
+    bool onGrid = false;
+    std::string dynamicQuantization;
+    int levels = 0;
+    std::vector<float> weightsData;
+};
+
+TEST_P(FullyConnectedCompressedWeightsCPUTest, CompareWithRefs) {
+    Run();
+    CheckExecGraph();
+}
+
+namespace {
+
+// odd number of input channels checks the padding nibble of I4 rows, batch 5 checks the batch tail
+const std::vector<std::vector<size_t>> inShapes = {{1, 64}, {5, 67}, {8, 300}};
+const std::vector<size_t> outChannels = {1, 33};
+
+INSTANTIATE_TEST_CASE_P(smoke_FP32, FullyConnectedCompressedWeightsCPUTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inShapes),
+                                ::testing::ValuesIn(outChannels),
+                                ::testing::Values("FP32"),
+                                ::testing::Values(true, false),
+                                ::testing::Values(PluginConfigParams::NO)),
+                        FullyConnectedCompressedWeightsCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_Compressed, FullyConnectedCompressedWeightsCPUTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inShapes),
+                                ::testing::ValuesIn(outChannels),
+                                ::testing::Values("I8", "I4"),
+                                ::testing::Values(true, false),
+                                ::testing::Values(PluginConfigParams::NO)),
+                        FullyConnectedCompressedWeightsCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_DynamicQuantization, FullyConnectedCompressedWeightsCPUTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inShapes),
+                                ::testing::ValuesIn(outChannels),
+                                ::testing::Values("FP32", "I8"),
+                                ::testing::Values(true, false),
+                                ::testing::Values(CPUConfigParams::CPU_PER_TENSOR, CPUConfigParams::CPU_PER_ROW)),
+                        FullyConnectedCompressedWeightsCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace CPULayerTestsDefinitions
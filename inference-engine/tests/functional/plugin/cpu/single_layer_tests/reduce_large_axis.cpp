@@ -0,0 +1,95 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <tuple>
+#include <vector>
+#include <string>
+#include <memory>
+
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        std::vector<size_t>,  // input shape
+        std::vector<int64_t>, // axes
+        std::string,          // reduce type
+        bool                  // keep dims
+> reduceLargeAxisParams;
+
+class ReduceLargeAxisCPUTest : public testing::WithParamInterface<reduceLargeAxisParams>,
+                               public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<reduceLargeAxisParams> obj) {
+        std::vector<size_t> inputShape;
+        std::vector<int64_t> axes;
+        std::string type;
+        bool keepDims;
+        std::tie(inputShape, axes, type, keepDims) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "axes=" << CommonTestUtils::vec2str(axes) << "_";
+        result << "type=" << type << "_";
+        result << "keepDims=" << keepDims;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::vector<size_t> inputShape;
+        std::vector<int64_t> axes;
+        std::string type;
+        bool keepDims;
+        std::tie(inputShape, axes, type, keepDims) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+        auto axesConst = std::make_shared<ngraph::opset1::Constant>(ngraph::element::i64, ngraph::Shape{axes.size()}, axes);
+        std::shared_ptr<ngraph::Node> reduce;
+        if (type == "Sum")
+            reduce = std::make_shared<ngraph::opset1::ReduceSum>(params[0], axesConst, keepDims);
+        else if (type == "Mean")
+            reduce = std::make_shared<ngraph::opset1::ReduceMean>(params[0], axesConst, keepDims);
+        else if (type == "Max")
+            reduce = std::make_shared<ngraph::opset1::ReduceMax>(params[0], axesConst, keepDims);
+        else
+            reduce = std::make_shared<ngraph::opset1::ReduceMin>(params[0], axesConst, keepDims);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(reduce)};
+        function = std::make_shared<ngraph::Function>(results, params, "ReduceLargeAxis");
+    }
+};
+
+TEST_P(ReduceLargeAxisCPUTest, CompareWithRefs) {
+    Run();
+}
+
+namespace {
+
+const std::vector<std::string> reduceTypes = {"Sum", "Mean", "Max", "Min"};
+
+// Spatial reduction of NHWC data: the reduced axes are outer to the not reduced ones
+INSTANTIATE_TEST_CASE_P(smoke_ReduceLargeAxisNHWC, ReduceLargeAxisCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(std::vector<size_t>{1, 56, 56, 72}, std::vector<size_t>{2, 7, 7, 2048}),
+                                ::testing::Values(std::vector<int64_t>{1, 2}),
+                                ::testing::ValuesIn(reduceTypes),
+                                ::testing::Values(true, false)),
+                        ReduceLargeAxisCPUTest::getTestCaseName);
+
+// Few outputs and a long reduced axis: the axis is split into chunks combined by a tree
+INSTANTIATE_TEST_CASE_P(smoke_ReduceLargeAxisTree, ReduceLargeAxisCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(std::vector<size_t>{2, 100003}, std::vector<size_t>{1, 3, 512, 512}),
+                                ::testing::Values(std::vector<int64_t>{-1}, std::vector<int64_t>{0, 1}),
+                                ::testing::ValuesIn(reduceTypes),
+                                ::testing::Values(true)),
+                        ReduceLargeAxisCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace CPULayerTestsDefinitions
@@ -0,0 +1,199 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ngraph/opsets/opset3.hpp>
+
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+class MemoryStateCPUTest : public CommonTestUtils::TestsCommon {
+protected:
+    // Accumulates inputs in the state: sum = state + input, the sum is written back to the state
+    static std::shared_ptr<ngraph::Function> makeAccumulator(const ngraph::Shape& shape) {
+        auto input = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, shape);
+        input->set_friendly_name("input");
+        auto init = ngraph::opset3::Constant::create(ngraph::element::f32, shape, std::vector<float>{0.f});
+        auto readValue = std::make_shared<ngraph::opset3::ReadValue>(init, "accumulator");
+        auto sum = std::make_shared<ngraph::opset3::Add>(readValue, input);
+        sum->set_friendly_name("sum");
+        auto assign = std::make_shared<ngraph::opset3::Assign>(sum, "accumulator");
+        assign->add_control_dependency(readValue);
+        auto result = std::make_shared<ngraph::opset3::Result>(sum);
+        result->add_control_dependency(assign);
+        return std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{input});
+    }
+
+    // Outputs the previous state, the producer of the new state feeds nothing but Assign,
+    // so the plugin can swap the buffers of the state and of the new state
+    static std::shared_ptr<ngraph::Function> makeDelayedAccumulator(const ngraph::Shape& shape) {
+        auto input = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, shape);
+        input->set_friendly_name("input");
+        auto init = ngraph::opset3::Constant::create(ngraph::element::f32, shape, std::vector<float>{0.f});
+        auto readValue = std::make_shared<ngraph::opset3::ReadValue>(init, "accumulator");
+        auto sum = std::make_shared<ngraph::opset3::Add>(readValue, input);
+        auto assign = std::make_shared<ngraph::opset3::Assign>(sum, "accumulator");
+        assign->add_control_dependency(readValue);
+        auto previous = std::make_shared<ngraph::opset3::Relu>(readValue);
+        previous->set_friendly_name("previous");
+        auto result = std::make_shared<ngraph::opset3::Result>(previous);
+        result->add_control_dependency(assign);
+        return std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{input});
+    }
+
+    void loadAccumulator(const ngraph::Shape& shape) {
+        load(makeAccumulator(shape));
+    }
+
+    void load(const std::shared_ptr<ngraph::Function>& function) {
+        CNNNetwork network(function);
+        executableNetwork = PluginCache::get().ie()->LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+        inferRequest = executableNetwork.CreateInferRequest();
+        for (auto&& state : executableNetwork.QueryState()) {
+            state.Reset();
+        }
+    }
+
+    static Blob::Ptr makeBlob(const SizeVector& dims, float first = 0.f) {
+        auto blob = make_shared_blob<float>({Precision::FP32, dims, TensorDesc::getLayoutByDims(dims)});
+        blob->allocate();
+        auto data = blob->buffer().as<float*>();
+        for (size_t i = 0; i < blob->size(); i++) {
+            data[i] = first + 0.25f * static_cast<float>(i % 7);
+        }
+        return blob;
+    }
+
+    static std::vector<float> toVector(const Blob::CPtr& blob) {
+        auto data = blob->cbuffer().as<const float*>();
+        return std::vector<float>(data, data + blob->size());
+    }
+
+    std::vector<float> infer(const std::string& output, const Blob::Ptr& input) {
+        inferRequest.SetBlob("input", input);
+        inferRequest.Infer();
+        return toVector(inferRequest.GetBlob(output));
+    }
+
+    MemoryState getState() {
+        auto states = executableNetwork.QueryState();
+        EXPECT_EQ(1u, states.size());
+        return states.front();
+    }
+
+    // Runs a few inferences, so the state buffers are passed between the state and its producer
+    // in both directions, and checks the outputs and the state after each of them
+    void checkAccumulation(const std::string& output, bool outputsNewState) {
+        const SizeVector dims = {2, 3};
+        std::vector<float> state(2 * 3, 0.f);
+        for (size_t i = 0; i < 5; i++) {
+            auto input = makeBlob(dims, static_cast<float>(i));
+            auto src = input->cbuffer().as<const float*>();
+            auto previous = state;
+            for (size_t j = 0; j < state.size(); j++) {
+                state[j] += src[j];
+            }
+
+            auto actual = infer(output, input);
+            const auto& expected = outputsNewState ? state : previous;
+            ASSERT_EQ(expected.size(), actual.size());
+            for (size_t j = 0; j < expected.size(); j++) {
+                ASSERT_FLOAT_EQ(expected[j], actual[j]) << "infer " << i << " element " << j;
+            }
+            auto lastState = toVector(getState().GetLastState());
+            for (size_t j = 0; j < state.size(); j++) {
+                ASSERT_FLOAT_EQ(state[j], lastState[j]) << "infer " << i << " element " << j;
+            }
+        }
+    }
+
+    ExecutableNetwork executableNetwork;
+    InferRequest inferRequest;
+};
+
+TEST_F(MemoryStateCPUTest, SwapsStateWithItsProducer) {
+    load(makeDelayedAccumulator({2, 3}));
+    checkAccumulation("previous", false);
+}
+
+TEST_F(MemoryStateCPUTest, CopiesStateIfItsProducerIsShared) {
+    // the new state is also a network output, so it is copied to the state
+    loadAccumulator({2, 3});
+    checkAccumulation("sum", true);
+}
+
+TEST_F(MemoryStateCPUTest, SetStateRestoresSavedState) {
+    load(makeDelayedAccumulator({2, 3}));
+    auto state = getState();
+
+    infer("previous", makeBlob({2, 3}, 1.f));
+    infer("previous", makeBlob({2, 3}, 2.f));
+    auto saved = makeBlob({2, 3});
+    state.SaveState(saved);
+    auto expected = toVector(state.GetLastState());
+    ASSERT_EQ(expected, toVector(saved));
+
+    // the state keeps changing, then it is rolled back to the saved one
+    infer("previous", makeBlob({2, 3}, 3.f));
+    infer("previous", makeBlob({2, 3}, 4.f));
+    ASSERT_NE(expected, toVector(state.GetLastState()));
+    state.SetState(saved);
+    ASSERT_EQ(expected, toVector(state.GetLastState()));
+    ASSERT_EQ(expected, infer("previous", makeBlob({2, 3}, 5.f)));
+
+    // saving to a blob of another size fails
+    ASSERT_THROW(state.SaveState(makeBlob({3, 3})), details::InferenceEngineException);
+}
+
+TEST_F(MemoryStateCPUTest, LastStateIsNotOverwrittenByNextInfer) {
+    load(makeDelayedAccumulator({2, 3}));
+    auto state = getState();
+
+    infer("previous", makeBlob({2, 3}, 1.f));
+    auto lastState = state.GetLastState();
+    auto expected = toVector(lastState);
+    for (size_t i = 0; i < 3; i++) {
+        infer("previous", makeBlob({2, 3}, 2.f));
+        ASSERT_EQ(expected, toVector(lastState)) << "infer " << i;
+    }
+}
+
+TEST_F(MemoryStateCPUTest, InferChunkedKeepsStateBetweenChunks) {
+    const size_t chunkSize = 2, channels = 3, numChunks = 4;
+    loadAccumulator({chunkSize, channels});
+
+    auto input = makeBlob({numChunks * chunkSize, channels}, 1.f);
+    auto output = makeBlob({numChunks * chunkSize, channels});
+    inferRequest.InferChunked({{"input", input}}, {{"sum", output}}, chunkSize);
+
+    // every element of a chunk accumulates the elements at the same position of all previous chunks
+    const auto src = input->cbuffer().as<const float*>();
+    const auto dst = output->cbuffer().as<const float*>();
+    const size_t chunkElements = chunkSize * channels;
+    std::vector<float> expected(chunkElements, 0.f);
+    for (size_t chunk = 0; chunk < numChunks; chunk++) {
+        for (size_t i = 0; i < chunkElements; i++) {
+            expected[i] += src[chunk * chunkElements + i];
+            ASSERT_FLOAT_EQ(expected[i], dst[chunk * chunkElements + i]) << "chunk " << chunk << " element " << i;
+        }
+    }
+
+    // the state is kept after the call, so the next sequence continues the accumulation
+    inferRequest.InferChunked({{"input", input}}, {{"sum", output}}, chunkSize);
+    for (size_t i = 0; i < chunkElements; i++) {
+        ASSERT_FLOAT_EQ(expected[i] + src[i], dst[i]);
+    }
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,127 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+typedef std::tuple<
+        size_t,  // sequence length, the number of iterations
+        size_t,  // channels
+        bool,    // the state is also a concatenated output
+        bool,    // the sequence is iterated in the reverse order
+        bool     // body inputs are also body outputs
+> tensorIteratorBackEdgeParams;
+
+// The state passes through a back edge: h = h * 0.5 + x[i], the outputs are the last state
+// and the concatenated relu(h), optionally the concatenated state itself.
+// With passthrough ports h = h * 0.5 + x[i] + c, where the body returns c unchanged through
+// a back edge and x[i] is concatenated back, so body inputs are connected to body outputs directly.
+class TensorIteratorBackEdgeCPUTest : public testing::WithParamInterface<tensorIteratorBackEdgeParams>,
+                                      public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<tensorIteratorBackEdgeParams> obj) {
+        size_t seqLength, channels;
+        bool concatState, reverse, passthrough;
+        std::tie(seqLength, channels, concatState, reverse, passthrough) = obj.param;
+
+        std::ostringstream result;
+        result << "seq=" << seqLength << "_";
+        result << "C=" << channels << "_";
+        result << "concatState=" << concatState << "_";
+        result << "reverse=" << reverse << "_";
+        result << "passthrough=" << passthrough;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        size_t seqLength, channels;
+        bool concatState, reverse, passthrough;
+        std::tie(seqLength, channels, concatState, reverse, passthrough) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        std::vector<std::vector<size_t>> inShapes = {{1, seqLength, channels}, {1, 1, channels}};
+        if (passthrough)
+            inShapes.push_back({1, 1, channels});
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, inShapes);
+
+        auto x = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1, channels});
+        auto h = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1, channels});
+        auto c = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1, channels});
+        auto decay = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {0.5f});
+        std::shared_ptr<ngraph::Node> hNext =
+                std::make_shared<ngraph::opset1::Add>(std::make_shared<ngraph::opset1::Multiply>(h, decay), x);
+        if (passthrough)
+            hNext = std::make_shared<ngraph::opset1::Add>(hNext, c);
+        auto y = std::make_shared<ngraph::opset1::Relu>(hNext);
+        ngraph::OutputVector bodyOutputs = {hNext, y};
+        ngraph::ParameterVector bodyParams = {x, h};
+        if (passthrough) {
+            bodyOutputs.push_back(c);
+            bodyOutputs.push_back(x);
+            bodyParams.push_back(c);
+        }
+        auto body = std::make_shared<ngraph::op::TensorIterator::BodyLambda>(bodyOutputs, bodyParams);
+
+        auto tensorIterator = std::make_shared<ngraph::op::TensorIterator>();
+        tensorIterator->set_body(body);
+        if (reverse)
+            tensorIterator->set_sliced_input(x, params[0], -1, -1, 1, 0, 1);
+        else
+            tensorIterator->set_sliced_input(x, params[0], 0, 1, 1, -1, 1);
+        tensorIterator->set_merged_input(h, params[1], hNext);
+        if (passthrough)
+            tensorIterator->set_merged_input(c, params[2], c);
+        tensorIterator->set_friendly_name("ti");
+
+        ngraph::OutputVector outputs = {tensorIterator->get_iter_value(hNext, -1)};
+        if (reverse)
+            outputs.push_back(tensorIterator->get_concatenated_slices(y, -1, -1, 1, 0, 1));
+        else
+            outputs.push_back(tensorIterator->get_concatenated_slices(y, 0, 1, 1, -1, 1));
+        if (concatState)
+            outputs.push_back(tensorIterator->get_concatenated_slices(hNext, 0, 1, 1, -1, 1));
+        if (passthrough) {
+            outputs.push_back(tensorIterator->get_iter_value(c, -1));
+            if (reverse)
+                outputs.push_back(tensorIterator->get_concatenated_slices(x, -1, -1, 1, 0, 1));
+            else
+                outputs.push_back(tensorIterator->get_concatenated_slices(x, 0, 1, 1, -1, 1));
+        }
+
+        ngraph::ResultVector results;
+        for (const auto& output : outputs)
+            results.push_back(std::make_shared<ngraph::opset1::Result>(output));
+        function = std::make_shared<ngraph::Function>(results, params, "tensorIteratorBackEdge");
+    }
+};
+
+TEST_P(TensorIteratorBackEdgeCPUTest, CompareWithRefs) {
+    Run();
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_TensorIteratorBackEdge, TensorIteratorBackEdgeCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(3, 8),
+                                ::testing::Values(16, 35),
+                                ::testing::Values(false, true),
+                                ::testing::Values(false, true),
+                                ::testing::Values(false, true)),
+                        TensorIteratorBackEdgeCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,43 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <tuple>
+#include <string>
+#include <vector>
+
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+namespace LayerTestsDefinitions {
+
+typedef std::tuple<
+        InferenceEngine::SizeVector, // Input shape
+        InferenceEngine::Precision,  // Network precision
+        int64_t,                     // Axis
+        int64_t,                     // K
+        std::string,                 // Mode
+        std::string,                 // Sort
+        std::string> topKParams;     // Device name
+
+class TopKLayerTest : public testing::WithParamInterface<topKParams>, public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<topKParams> obj);
+
+    InferenceEngine::Blob::Ptr GenerateInput(const InferenceEngine::InputInfo &info) const override;
+
+    void Compare(const std::vector<std::vector<std::uint8_t>> &expectedOutputs,
+                 const std::vector<InferenceEngine::Blob::Ptr> &actualOutputs) override;
+
+protected:
+    void SetUp() override;
+
+private:
+    InferenceEngine::SizeVector outShape;
+    size_t axis = 0;
+    std::string sort;
+};
+
+}  // namespace LayerTestsDefinitions
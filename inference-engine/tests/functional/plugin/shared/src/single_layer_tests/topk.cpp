@@ -0,0 +1,123 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <tuple>
+#include <string>
+#include <vector>
+
+#include "ie_core.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "functional_test_utils/layer_test_utils.hpp"
+
+#include "single_layer_tests/topk.hpp"
+
+namespace LayerTestsDefinitions {
+
+std::string TopKLayerTest::getTestCaseName(testing::TestParamInfo<topKParams> obj) {
+    InferenceEngine::SizeVector inputShape;
+    InferenceEngine::Precision netPrecision;
+    int64_t axis, k;
+    std::string mode, sort, targetDevice;
+    std::tie(inputShape, netPrecision, axis, k, mode, sort, targetDevice) = obj.param;
+
+    std::ostringstream result;
+    result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+    result << "netPRC=" << netPrecision.name() << "_";
+    result << "axis=" << axis << "_";
+    result << "k=" << k << "_";
+    result << "mode=" << mode << "_";
+    result << "sort=" << sort << "_";
+    result << "targetDevice=" << targetDevice;
+    return result.str();
+}
+
+// Values are unique along any axis, so the selected indices do not depend on ties resolution
+InferenceEngine::Blob::Ptr TopKLayerTest::GenerateInput(const InferenceEngine::InputInfo &info) const {
+    auto blob = make_blob_with_precision(info.getTensorDesc());
+    blob->allocate();
+    auto data = blob->buffer().as<float *>();
+    for (size_t i = 0; i < blob->size(); i++)
+        data[i] = static_cast<float>(i * 7919 % 1000003);
+    return blob;
+}
+
+void TopKLayerTest::Compare(const std::vector<std::vector<std::uint8_t>> &expectedOutputs,
+                            const std::vector<InferenceEngine::Blob::Ptr> &actualOutputs) {
+    if (sort != "none") {
+        LayerTestsCommon::Compare(expectedOutputs, actualOutputs);
+        return;
+    }
+
+    // The order of the selected elements is not defined, so values and indices are compared
+    // after sorting them along the axis
+    auto sortAlongAxis = [&](const float *data) {
+        const size_t k = outShape[axis];
+        size_t outer = 1, inner = 1;
+        for (size_t i = 0; i < axis; i++)
+            outer *= outShape[i];
+        for (size_t i = axis + 1; i < outShape.size(); i++)
+            inner *= outShape[i];
+
+        std::vector<float> sorted(outer * k * inner);
+        std::vector<float> line(k);
+        for (size_t o = 0; o < outer; o++) {
+            for (size_t i = 0; i < inner; i++) {
+                for (size_t j = 0; j < k; j++)
+                    line[j] = data[(o * k + j) * inner + i];
+                std::sort(line.begin(), line.end());
+                for (size_t j = 0; j < k; j++)
+                    sorted[(o * k + j) * inner + i] = line[j];
+            }
+        }
+        return sorted;
+    };
+
+    ASSERT_EQ(expectedOutputs.size(), actualOutputs.size());
+    for (size_t i = 0; i < expectedOutputs.size(); i++) {
+        auto memory = InferenceEngine::as<InferenceEngine::MemoryBlob>(actualOutputs[i]);
+        IE_ASSERT(memory);
+        const auto lockedMemory = memory->rmap();
+        ASSERT_EQ(expectedOutputs[i].size(), actualOutputs[i]->byteSize());
+
+        const auto expected = sortAlongAxis(reinterpret_cast<const float *>(expectedOutputs[i].data()));
+        const auto actual = sortAlongAxis(lockedMemory.as<const float *>());
+        LayerTestsCommon::Compare(expected.data(), actual.data(), expected.size(), threshold);
+    }
+}
+
+void TopKLayerTest::SetUp() {
+    InferenceEngine::SizeVector inputShape;
+    InferenceEngine::Precision netPrecision;
+    int64_t axisParam, k;
+    std::string mode;
+    std::tie(inputShape, netPrecision, axisParam, k, mode, sort, targetDevice) = this->GetParam();
+    // indices are compared as float values together with the selected values, both are copied
+    // from the unique input values, so they have to match exactly
+    outPrc = InferenceEngine::Precision::FP32;
+    threshold = 0.f;
+
+    auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(netPrecision);
+    auto params = ngraph::builder::makeParams(ngPrc, {inputShape});
+    auto kConst = std::make_shared<ngraph::opset1::Constant>(ngraph::element::i64, ngraph::Shape{}, &k);
+    auto topK = std::make_shared<ngraph::opset1::TopK>(params[0], kConst, axisParam, mode, sort);
+
+    axis = topK->get_axis();
+    outShape = topK->get_output_shape(0);
+
+    ngraph::ResultVector results;
+    for (size_t i = 0; i < topK->get_output_size(); i++)
+        results.push_back(std::make_shared<ngraph::opset1::Result>(topK->output(i)));
+    function = std::make_shared<ngraph::Function>(results, params, "TopK");
+}
+
+TEST_P(TopKLayerTest, CompareWithRefs) {
+    Run();
+};
+
+}  // namespace LayerTestsDefinitions
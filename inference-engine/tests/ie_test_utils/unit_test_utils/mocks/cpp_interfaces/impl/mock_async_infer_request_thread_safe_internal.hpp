@@ -61,4 +61,5 @@ public:
 
     MOCK_METHOD1(SetBatch, void(int));
     MOCK_METHOD1(SetBatch_ThreadUnsafe, void(int));
+    MOCK_METHOD3(InferChunked_ThreadUnsafe, void(const BlobMap&, const BlobMap&, size_t));
 };
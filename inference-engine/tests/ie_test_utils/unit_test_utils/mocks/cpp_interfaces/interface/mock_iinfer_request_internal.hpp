@@ -20,4 +20,5 @@ public:
     MOCK_METHOD2(GetBlob, void(const char *name, InferenceEngine::Blob::Ptr &));
     MOCK_METHOD3(SetBlob, void(const char*, const InferenceEngine::Blob::Ptr&, const InferenceEngine::PreProcessInfo&));
     MOCK_METHOD2(GetPreProcess, void(const char*, const InferenceEngine::PreProcessInfo**));
+    MOCK_METHOD3(InferChunked, void(const InferenceEngine::BlobMap&, const InferenceEngine::BlobMap&, size_t));
 };
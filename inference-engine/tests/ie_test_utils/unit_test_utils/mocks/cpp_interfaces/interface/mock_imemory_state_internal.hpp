@@ -17,4 +17,5 @@ class MockIMemoryStateInternal : public InferenceEngine::IMemoryStateInternal {
     MOCK_METHOD0(Reset, void());
     MOCK_METHOD1(SetState, void(InferenceEngine::Blob::Ptr));
     MOCK_CONST_METHOD0(GetLastState, InferenceEngine::Blob::CPtr());
+    MOCK_CONST_METHOD1(SaveState, void(InferenceEngine::Blob::Ptr));
 };
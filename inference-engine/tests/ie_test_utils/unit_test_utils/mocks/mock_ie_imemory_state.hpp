@@ -18,4 +18,5 @@ public:
     MOCK_QUALIFIED_METHOD1(Reset, noexcept, StatusCode(ResponseDesc *));
     MOCK_QUALIFIED_METHOD2(SetState, noexcept, StatusCode(Blob::Ptr, ResponseDesc *));
     MOCK_QUALIFIED_METHOD2(GetLastState, const noexcept, StatusCode(Blob::CPtr &, ResponseDesc *));
+    MOCK_QUALIFIED_METHOD2(SaveState, const noexcept, StatusCode(Blob::Ptr, ResponseDesc *));
 };
@@ -128,6 +128,19 @@ TEST_F(InferRequestBaseTests, canCatchUnknownErrorInInfer) {
     ASSERT_EQ(UNEXPECTED, request->Infer(nullptr));
 }
 
+// InferChunked
+TEST_F(InferRequestBaseTests, canForwardInferChunked) {
+    BlobMap inputs, outputs;
+    EXPECT_CALL(*mock_impl.get(), InferChunked(Ref(inputs), Ref(outputs), 4)).Times(1);
+    ASSERT_EQ(OK, request->InferChunked(inputs, outputs, 4, &dsc));
+}
+
+TEST_F(InferRequestBaseTests, canReportErrorInInferChunked) {
+    EXPECT_CALL(*mock_impl.get(), InferChunked(_, _, _)).WillOnce(Throw(std::runtime_error("compare")));
+    ASSERT_NE(request->InferChunked({}, {}, 4, &dsc), OK);
+    ASSERT_STREQ(dsc.msg, "compare");
+}
+
 // GetPerformanceCounts
 TEST_F(InferRequestBaseTests, canForwardGetPerformanceCounts) {
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> info;
@@ -2,7 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
+#include <chrono>
 #include <deque>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock-spec-builders.h>
@@ -159,6 +163,126 @@ TEST_F(InferRequestThreadSafeDefaultTests, canResetBusyStatusIfInferFails) {
     ASSERT_NO_THROW(testRequest->Infer());
 }
 
+// InferChunked
+TEST_F(InferRequestThreadSafeDefaultTests, returnRequestBusyOnInferChunked) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(1).WillOnce(Return());
+    ASSERT_NO_THROW(testRequest->StartAsync());
+    ASSERT_TRUE(_doesThrowExceptionWithMessage([this]() { testRequest->InferChunked({}, {}, 1); }, REQUEST_BUSY_str));
+    taskExecutor->executeAll();
+}
+
+class InferRequestChunkedTests : public InferRequestThreadSafeDefaultTests {
+protected:
+    static constexpr size_t chunkSize = 2;
+
+    Blob::Ptr input, output;
+    Blob::Ptr inputSequence, outputSequence;
+
+    void SetUp() override {
+        InferRequestThreadSafeDefaultTests::SetUp();
+        const TensorDesc chunkDesc(Precision::FP32, {chunkSize, 3}, Layout::NC);
+
+        InputsDataMap inputsInfo;
+        auto inputInfo = std::make_shared<InputInfo>();
+        inputInfo->setInputData(std::make_shared<Data>("input", chunkDesc));
+        inputsInfo["input"] = inputInfo;
+        OutputsDataMap outputsInfo;
+        outputsInfo["output"] = std::make_shared<Data>("output", chunkDesc);
+        mockInferRequestInternal = make_shared<MockInferRequestInternal>(inputsInfo, outputsInfo);
+
+        input = make_shared_blob<float>(chunkDesc);
+        input->allocate();
+        output = make_shared_blob<float>(chunkDesc);
+        output->allocate();
+        mockInferRequestInternal->SetBlob("input", input);
+        mockInferRequestInternal->SetBlob("output", output);
+
+        const TensorDesc sequenceDesc(Precision::FP32, {3 * chunkSize, 3}, Layout::NC);
+        inputSequence = make_shared_blob<float>(sequenceDesc);
+        inputSequence->allocate();
+        outputSequence = make_shared_blob<float>(sequenceDesc);
+        outputSequence->allocate();
+
+        auto taskExecutor = std::make_shared<CPUStreamsExecutor>();
+        testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    }
+
+    Blob::Ptr getBlob(const char* name) {
+        Blob::Ptr blob;
+        mockInferRequestInternal->GetBlob(name, blob);
+        return blob;
+    }
+};
+
+constexpr size_t InferRequestChunkedTests::chunkSize;
+
+TEST_F(InferRequestChunkedTests, canInferChunksInPlaceAndRestoreBlobs) {
+    const auto chunkBytes = chunkSize * 3 * sizeof(float);
+    size_t chunk = 0;
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(3).WillRepeatedly(Invoke([&] {
+        EXPECT_EQ(inputSequence->buffer().as<uint8_t*>() + chunk * chunkBytes, getBlob("input")->buffer().as<uint8_t*>());
+        EXPECT_EQ(outputSequence->buffer().as<uint8_t*>() + chunk * chunkBytes, getBlob("output")->buffer().as<uint8_t*>());
+        ++chunk;
+    }));
+
+    ASSERT_NO_THROW(testRequest->InferChunked({{"input", inputSequence}}, {{"output", outputSequence}}, chunkSize));
+    ASSERT_EQ(3u, chunk);
+    ASSERT_EQ(input, getBlob("input"));
+    ASSERT_EQ(output, getBlob("output"));
+}
+
+TEST_F(InferRequestChunkedTests, canRestoreBlobsIfChunkFails) {
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(2)
+            .WillOnce(Return())
+            .WillOnce(Throw(InferenceEngineException(__FILE__, __LINE__) << "compare"));
+
+    ASSERT_TRUE(_doesThrowExceptionWithMessage([this]() {
+        testRequest->InferChunked({{"input", inputSequence}}, {{"output", outputSequence}}, chunkSize);
+    }, "compare"));
+    ASSERT_EQ(input, getBlob("input"));
+    ASSERT_EQ(output, getBlob("output"));
+}
+
+TEST_F(InferRequestChunkedTests, canInferAllChunksInSingleTaskReusingChunkBlobs) {
+    struct CountingExecutor : public ITaskExecutor {
+        void run(Task task) override {
+            ++numTasks;
+            task();
+        }
+        size_t numTasks = 0;
+    };
+    auto taskExecutor = std::make_shared<CountingExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor,
+                                                                      std::make_shared<ImmediateExecutor>());
+    Blob::Ptr chunkInput, chunkOutput;
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(3).WillRepeatedly(Invoke([&] {
+        if (chunkInput == nullptr) {
+            chunkInput = getBlob("input");
+            chunkOutput = getBlob("output");
+        }
+        EXPECT_EQ(chunkInput, getBlob("input"));
+        EXPECT_EQ(chunkOutput, getBlob("output"));
+    }));
+
+    ASSERT_NO_THROW(testRequest->InferChunked({{"input", inputSequence}}, {{"output", outputSequence}}, chunkSize));
+    ASSERT_EQ(1u, taskExecutor->numTasks);
+}
+
+TEST_F(InferRequestChunkedTests, throwsOnChunkSizeMismatch) {
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(0);
+    ASSERT_TRUE(_doesThrowExceptionWithMessage([this]() {
+        testRequest->InferChunked({{"input", inputSequence}}, {{"output", outputSequence}}, 3);
+    }, PARAMETER_MISMATCH_str));
+
+    auto shortSequence = make_shared_blob<float>(TensorDesc(Precision::FP32, {2 * chunkSize, 3}, Layout::NC));
+    shortSequence->allocate();
+    ASSERT_TRUE(_doesThrowExceptionWithMessage([&]() {
+        testRequest->InferChunked({{"input", inputSequence}}, {{"output", shortSequence}}, chunkSize);
+    }, PARAMETER_MISMATCH_str));
+}
+
 // GetPerformanceCounts
 TEST_F(InferRequestThreadSafeDefaultTests, returnRequestBusyOnGetPerformanceCounts) {
     auto taskExecutor = std::make_shared<DeferedExecutor>();
@@ -261,6 +385,108 @@ TEST_F(InferRequestThreadSafeDefaultTests, canCatchExceptionIfAsyncRequestFailed
     EXPECT_THROW(testRequest->Wait(IInferRequest::WaitMode::RESULT_READY), std::exception);
 }
 
+TEST_F(InferRequestThreadSafeDefaultTests, returnResultNotReadyUntilLastStageIsFinished) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(2);
+
+    for (int i = 0; i < 2; i++) {
+        ASSERT_NO_THROW(testRequest->StartAsync());
+        ASSERT_EQ(StatusCode::RESULT_NOT_READY, testRequest->Wait(IInferRequest::WaitMode::STATUS_ONLY));
+        ASSERT_EQ(StatusCode::RESULT_NOT_READY, testRequest->Wait(1));
+        taskExecutor->executeOne();
+        ASSERT_EQ(StatusCode::RESULT_NOT_READY, testRequest->Wait(IInferRequest::WaitMode::STATUS_ONLY));
+        taskExecutor->executeOne();
+        ASSERT_EQ(StatusCode::OK, testRequest->Wait(IInferRequest::WaitMode::STATUS_ONLY));
+        ASSERT_EQ(StatusCode::OK, testRequest->Wait(IInferRequest::WaitMode::RESULT_READY));
+    }
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, exceptionIsNotRethrownAfterNextSuccessfulStart) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl())
+            .WillOnce(Throw(std::exception()))
+            .WillOnce(Return());
+
+    testRequest->StartAsync();
+    EXPECT_THROW(testRequest->Wait(IInferRequest::WaitMode::RESULT_READY), std::exception);
+    EXPECT_THROW(testRequest->Wait(IInferRequest::WaitMode::STATUS_ONLY), std::exception);
+    testRequest->StartAsync();
+    ASSERT_EQ(StatusCode::OK, testRequest->Wait(IInferRequest::WaitMode::RESULT_READY));
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, canStartNextRequestFromCallback) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    IInferRequest::Ptr asyncRequest;
+    asyncRequest.reset(new InferRequestBase<TestAsyncInferRequestThreadSafeDefault>(
+            testRequest), [](IInferRequest *p) { p->Release(); });
+    testRequest->SetPointerToPublicInterface(asyncRequest);
+
+    const int numIterations = 100;
+    std::atomic<int> numCallbacks{0};
+    InferRequest cppRequest(asyncRequest);
+    std::function<void(InferRequest, StatusCode)> callback =
+            [&](InferRequest request, StatusCode status) {
+                ASSERT_EQ(StatusCode::OK, status);
+                if (++numCallbacks < numIterations) {
+                    request.StartAsync();
+                }
+            };
+    cppRequest.SetCompletionCallback(callback);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(numIterations);
+
+    testRequest->StartAsync();
+    while (numCallbacks < numIterations) {
+        testRequest->Wait(IInferRequest::WaitMode::RESULT_READY);
+    }
+    ASSERT_EQ(StatusCode::OK, testRequest->Wait(IInferRequest::WaitMode::RESULT_READY));
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, waitRethrowsExceptionIfNextRequestIsStartedFromCallback) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    IInferRequest::Ptr asyncRequest;
+    asyncRequest.reset(new InferRequestBase<TestAsyncInferRequestThreadSafeDefault>(
+            testRequest), [](IInferRequest *p) { p->Release(); });
+    testRequest->SetPointerToPublicInterface(asyncRequest);
+
+    std::vector<StatusCode> statuses;
+    InferRequest cppRequest(asyncRequest);
+    std::function<void(InferRequest, StatusCode)> callback =
+            [&](InferRequest request, StatusCode status) {
+                statuses.push_back(status);
+                if (statuses.size() == 1) {
+                    request.StartAsync();
+                }
+            };
+    cppRequest.SetCompletionCallback(callback);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl())
+            .WillOnce(Throw(std::exception()))
+            .WillOnce(Return());
+
+    testRequest->StartAsync();
+    std::atomic<bool> waitThrew{false};
+    std::thread waiter([&] {
+        try {
+            testRequest->Wait(IInferRequest::WaitMode::RESULT_READY);
+        } catch (const std::exception&) {
+            waitThrew = true;
+        }
+    });
+    // let the waiter block on the first inference
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    taskExecutor->executeOne();  // the first inference fails
+    taskExecutor->executeOne();  // the callback starts the second inference
+    waiter.join();
+    ASSERT_TRUE(waitThrew);
+
+    taskExecutor->executeAll();
+    ASSERT_EQ((std::vector<StatusCode>{StatusCode::GENERAL_ERROR, StatusCode::OK}), statuses);
+    ASSERT_EQ(StatusCode::OK, testRequest->Wait(IInferRequest::WaitMode::RESULT_READY));
+}
+
 
 class AsyncInferRequestThreadSafeInternalTests : public ::testing::Test {
 protected:
@@ -342,6 +568,21 @@ TEST_F(AsyncInferRequestThreadSafeInternalTests, canResetBusyStatusIfInferFails)
     ASSERT_NO_THROW(testRequest->Infer());
 }
 
+// InferChunked
+TEST_F(AsyncInferRequestThreadSafeInternalTests, returnRequestBusyOnInferChunked) {
+    testRequest->setRequestBusy();
+    ASSERT_TRUE(_doesThrowExceptionWithMessage([this]() { testRequest->InferChunked({}, {}, 1); }, REQUEST_BUSY_str));
+}
+
+TEST_F(AsyncInferRequestThreadSafeInternalTests, canResetBusyStatusIfInferChunkedFails) {
+    EXPECT_CALL(*testRequest.get(), InferChunked_ThreadUnsafe(_, _, 1)).Times(2)
+            .WillOnce(Throw(InferenceEngineException(__FILE__, __LINE__) << "compare"))
+            .WillOnce(Return());
+
+    ASSERT_TRUE(_doesThrowExceptionWithMessage([&]() { testRequest->InferChunked({}, {}, 1); }, "compare"));
+    ASSERT_NO_THROW(testRequest->InferChunked({}, {}, 1));
+}
+
 // GetPerformanceCounts
 TEST_F(AsyncInferRequestThreadSafeInternalTests, returnRequestBusyOnGetPerformanceCounts) {
     testRequest->setRequestBusy();
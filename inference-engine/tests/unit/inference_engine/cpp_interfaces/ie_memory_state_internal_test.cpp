@@ -183,6 +183,22 @@ TEST_F(MemoryStateTests, MemoryStateCanPropagateGetLastState) {
     ASSERT_FLOAT_EQ(saver->cbuffer().as<const float*>()[2], 125);
 }
 
+TEST_F(MemoryStateTests, MemoryStateCanPropagateSaveState) {
+    auto net = ExecutableNetwork(make_executable_network(mockExeNetworkInternal));
+    std::vector<IMemoryStateInternal::Ptr> toReturn;
+    Blob::Ptr saver;
+    toReturn.push_back(mockMemoryStateInternal);
+
+    EXPECT_CALL(*mockExeNetworkInternal.get(), QueryState()).WillRepeatedly(Return(toReturn));
+    EXPECT_CALL(*mockMemoryStateInternal.get(), SaveState(_)).WillOnce(SaveArg<0>(&saver));
+
+    float data[3] = {};
+    auto stateBlob = make_shared_blob<float>({ Precision::FP32, {3}, C }, data, sizeof(data) / sizeof(*data));
+
+    EXPECT_NO_THROW(net.QueryState().front().SaveState(stateBlob));
+    ASSERT_EQ(stateBlob, saver);
+}
+
 class MemoryStateInternalMockImpl : public MemoryStateInternal {
  public:
     using MemoryStateInternal::MemoryStateInternal;
@@ -225,3 +241,19 @@ TEST_F(MemoryStateTests, MemoryStateInternalCanSaveStateByReference) {
     ASSERT_FLOAT_EQ(saver->cbuffer().as<const float *>()[1], 122);
     ASSERT_FLOAT_EQ(saver->cbuffer().as<const float *>()[2], 123);
 }
+
+TEST_F(MemoryStateTests, MemoryStateInternalCanSaveStateToBlob) {
+    IMemoryStateInternal::Ptr pState(new MemoryStateInternalMockImpl("name"));
+    float data[] = {123, 124, 125};
+    pState->SetState(make_shared_blob<float>({ Precision::FP32, {3}, C }, data, sizeof(data) / sizeof(*data)));
+
+    float snapshot[3] = {};
+    pState->SaveState(make_shared_blob<float>({ Precision::FP32, {3}, C }, snapshot, sizeof(snapshot) / sizeof(*snapshot)));
+    ASSERT_FLOAT_EQ(snapshot[0], 123);
+    ASSERT_FLOAT_EQ(snapshot[1], 124);
+    ASSERT_FLOAT_EQ(snapshot[2], 125);
+
+    float small[2] = {};
+    ASSERT_THROW(pState->SaveState(make_shared_blob<float>({ Precision::FP32, {2}, C }, small, 2)),
+                 details::InferenceEngineException);
+}
@@ -0,0 +1,108 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <details/ie_exception.hpp>
+#include <threading/ie_cpu_cores_arbiter.hpp>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+TEST(CPUCoresArbiterTests, singleShareGetsAllCores) {
+    CPUCoresArbiter arbiter(16);
+    auto id = arbiter.acquire(1);
+
+    auto partition = arbiter.getPartition(id);
+    ASSERT_EQ(0, partition.offset);
+    ASSERT_EQ(16, partition.size);
+}
+
+TEST(CPUCoresArbiterTests, sharesGetDisjointPartitionsProportionalToWeights) {
+    CPUCoresArbiter arbiter(16);
+    auto id1 = arbiter.acquire(1);
+    auto id2 = arbiter.acquire(3);
+
+    auto partition1 = arbiter.getPartition(id1);
+    auto partition2 = arbiter.getPartition(id2);
+    ASSERT_EQ(0, partition1.offset);
+    ASSERT_EQ(4, partition1.size);
+    ASSERT_EQ(4, partition2.offset);
+    ASSERT_EQ(12, partition2.size);
+}
+
+TEST(CPUCoresArbiterTests, remainingCoresAreDistributed) {
+    CPUCoresArbiter arbiter(10);
+    auto id1 = arbiter.acquire(1);
+    auto id2 = arbiter.acquire(1);
+    auto id3 = arbiter.acquire(1);
+
+    auto partition1 = arbiter.getPartition(id1);
+    auto partition2 = arbiter.getPartition(id2);
+    auto partition3 = arbiter.getPartition(id3);
+    ASSERT_EQ(4, partition1.size);
+    ASSERT_EQ(3, partition2.size);
+    ASSERT_EQ(3, partition3.size);
+    ASSERT_EQ(partition1.offset + partition1.size, partition2.offset);
+    ASSERT_EQ(partition2.offset + partition2.size, partition3.offset);
+}
+
+TEST(CPUCoresArbiterTests, partitionsAreRebalancedOnRelease) {
+    CPUCoresArbiter arbiter(8);
+    auto id1 = arbiter.acquire(1);
+    auto id2 = arbiter.acquire(1);
+    ASSERT_EQ(4, arbiter.getPartition(id2).offset);
+
+    arbiter.release(id1);
+    auto partition2 = arbiter.getPartition(id2);
+    ASSERT_EQ(0, partition2.offset);
+    ASSERT_EQ(8, partition2.size);
+}
+
+TEST(CPUCoresArbiterTests, moreSharesThanCoresOverlap) {
+    CPUCoresArbiter arbiter(2);
+    auto id1 = arbiter.acquire(1);
+    arbiter.acquire(1);
+    auto id3 = arbiter.acquire(1);
+
+    ASSERT_EQ(1, arbiter.getPartition(id3).size);
+    ASSERT_EQ(arbiter.getPartition(id1).offset, arbiter.getPartition(id3).offset);
+}
+
+TEST(CPUCoresArbiterTests, quoteDoesNotAcquire) {
+    CPUCoresArbiter arbiter(12);
+    auto id = arbiter.acquire(1);
+
+    ASSERT_EQ(8, arbiter.quote(2));
+    ASSERT_EQ(12, arbiter.getPartition(id).size);
+}
+
+TEST(CPUCoresArbiterTests, throwsOnNonPositiveWeight) {
+    CPUCoresArbiter arbiter(4);
+    ASSERT_THROW(arbiter.acquire(0), details::InferenceEngineException);
+}
+
+TEST(CPUCoresArbiterTests, generationChangesOnRebalancing) {
+    CPUCoresArbiter arbiter(8);
+    auto generation = arbiter.getGeneration();
+    auto id = arbiter.acquire(1);
+    ASSERT_NE(generation, arbiter.getGeneration());
+
+    generation = arbiter.getGeneration();
+    arbiter.getPartition(id);
+    arbiter.quote(1);
+    ASSERT_EQ(generation, arbiter.getGeneration());
+
+    arbiter.release(id);
+    ASSERT_NE(generation, arbiter.getGeneration());
+}
+
+TEST(CPUCoresArbiterTests, offsetsOfExecutorsWithoutShareAreSpread) {
+    CPUCoresArbiter arbiter(8);
+    ASSERT_EQ(0, arbiter.nextOffset(3));
+    ASSERT_EQ(3, arbiter.nextOffset(4));
+    ASSERT_EQ(7, arbiter.nextOffset(2));
+    ASSERT_EQ(1, arbiter.nextOffset(0));
+    ASSERT_EQ(2, arbiter.nextOffset(1));
+}
@@ -0,0 +1,159 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "common_test_utils/test_common.hpp"
+
+#include "ie_system_conf.h"
+
+#ifdef __linux__
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <fstream>
+
+#include "os/lin/lin_system_conf.hpp"
+#endif
+
+using namespace InferenceEngine;
+
+class CPUTopologyTests : public CommonTestUtils::TestsCommon {
+protected:
+    static CPUTopology::Processor makeProcessor(int id, int core, int l3, int numaNode = 0) {
+        CPUTopology::Processor processor;
+        processor.id = id;
+        processor.core = core;
+        processor.l2 = core;
+        processor.l3 = l3;
+        processor.numaNode = numaNode;
+        return processor;
+    }
+};
+
+TEST_F(CPUTopologyTests, placesThreadsOnPhysicalCoresBeforeSiblings) {
+    // 4 cores with 2 hyperthreads each, siblings are enumerated next to each other
+    std::vector<CPUTopology::Processor> processors;
+    for (int id = 0; id < 8; id++) {
+        processors.push_back(makeProcessor(id, id / 2 * 2, 0));
+    }
+    CPUTopology topology{processors};
+    ASSERT_EQ(4, topology.getCoresNumber());
+    ASSERT_EQ((std::vector<int>{0, 2, 4, 6, 1, 3, 5, 7}), topology.getPlacementOrder());
+    ASSERT_EQ((std::vector<int>{4}), topology.getCoresPerL3Domain());
+}
+
+TEST_F(CPUTopologyTests, groupsCoresByNumaNodeAndL3Domain) {
+    // 2 NUMA nodes with 2 L3 domains each, cores of the domains are interleaved, siblings are enumerated after cores
+    std::vector<CPUTopology::Processor> processors;
+    for (int id = 0; id < 16; id++) {
+        const int core = id % 8;
+        const int numaNode = core < 4 ? 0 : 1;
+        const int l3 = numaNode * 4 + core % 2;
+        processors.push_back(makeProcessor(id, core, l3, numaNode));
+    }
+    CPUTopology topology{processors};
+    ASSERT_EQ(8, topology.getCoresNumber());
+    ASSERT_EQ((std::vector<int>{0, 2, 1, 3, 4, 6, 5, 7, 8, 10, 9, 11, 12, 14, 13, 15}), topology.getPlacementOrder());
+    ASSERT_EQ((std::vector<int>{2, 2, 2, 2}), topology.getCoresPerL3Domain());
+    ASSERT_EQ((std::vector<int>{0, 1}), topology.getNUMANodes());
+}
+
+TEST_F(CPUTopologyTests, detectsTopologyOfCurrentProcess) {
+    const auto& topology = getCPUTopology();
+    ASSERT_FALSE(topology.getProcessors().empty());
+    ASSERT_EQ(topology.getProcessors().size(), topology.getPlacementOrder().size());
+    ASSERT_GE(topology.getCoresNumber(), 1);
+    ASSERT_LE(static_cast<size_t>(topology.getCoresNumber()), topology.getProcessors().size());
+    ASSERT_EQ(topology.getCoresNumber(), getNumberOfCPUCores());
+}
+
+#ifdef __linux__
+class SysfsCPUTopologyTests : public CPUTopologyTests {
+protected:
+    std::string root;
+
+    void SetUp() override {
+        char path[] = "/tmp/ie_sysfs_XXXXXX";
+        ASSERT_NE(nullptr, mkdtemp(path));
+        root = path;
+    }
+
+    void TearDown() override {
+        ASSERT_EQ(0, system(("rm -rf " + root).c_str()));
+    }
+
+    void write(const std::string& path, const std::string& content) {
+        size_t pos = 0;
+        while ((pos = path.find('/', pos + 1)) != std::string::npos) {
+            mkdir((root + path.substr(0, pos)).c_str(), 0755);
+        }
+        std::ofstream file(root + path);
+        file << content << std::endl;
+    }
+
+    void writeProcessor(int id, const std::string& siblings, const std::string& l2, const std::string& l3) {
+        const std::string cpu = "/cpu/cpu" + std::to_string(id);
+        write(cpu + "/topology/thread_siblings_list", siblings);
+        write(cpu + "/topology/core_siblings_list", "0-7");
+        write(cpu + "/topology/physical_package_id", "0");
+        write(cpu + "/cache/index0/level", "1");
+        write(cpu + "/cache/index0/type", "Data");
+        write(cpu + "/cache/index0/shared_cpu_list", siblings);
+        write(cpu + "/cache/index1/level", "1");
+        write(cpu + "/cache/index1/type", "Instruction");
+        write(cpu + "/cache/index1/shared_cpu_list", siblings);
+        write(cpu + "/cache/index2/level", "2");
+        write(cpu + "/cache/index2/type", "Unified");
+        write(cpu + "/cache/index2/shared_cpu_list", l2);
+        write(cpu + "/cache/index3/level", "3");
+        write(cpu + "/cache/index3/type", "Unified");
+        write(cpu + "/cache/index3/shared_cpu_list", l3);
+    }
+};
+
+TEST_F(SysfsCPUTopologyTests, parsesProcessorsList) {
+    ASSERT_EQ((std::vector<int>{0, 1, 2, 3, 8, 10, 11}), parseProcessorsList("0-3,8,10-11\n"));
+    ASSERT_EQ((std::vector<int>{5}), parseProcessorsList("5"));
+    ASSERT_TRUE(parseProcessorsList("").empty());
+}
+
+TEST_F(SysfsCPUTopologyTests, readsCoresCachesAndNumaNodes) {
+    // 4 cores with 2 hyperthreads each (siblings are N and N + 4), 2 L3 domains in 2 NUMA nodes
+    for (int id = 0; id < 8; id++) {
+        const int core = id % 4;
+        const std::string siblings = std::to_string(core) + "," + std::to_string(core + 4);
+        writeProcessor(id, siblings, siblings, core < 2 ? "0-1,4-5" : "2-3,6-7");
+    }
+    write("/node/online", "0-1");
+    write("/node/node0/cpulist", "0-1,4-5");
+    write("/node/node1/cpulist", "2-3,6-7");
+
+    auto processors = readCPUTopology(root, {0, 1, 2, 3, 4, 5, 6, 7});
+    ASSERT_EQ(8, processors.size());
+    for (auto&& processor : processors) {
+        const int core = processor.id % 4;
+        ASSERT_EQ(core, processor.core);
+        ASSERT_EQ(core, processor.l2);
+        ASSERT_EQ(core < 2 ? 0 : 2, processor.l3);
+        ASSERT_EQ(core < 2 ? 0 : 1, processor.numaNode);
+    }
+
+    CPUTopology topology{processors};
+    ASSERT_EQ(4, topology.getCoresNumber());
+    ASSERT_EQ((std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7}), topology.getPlacementOrder());
+    ASSERT_EQ((std::vector<int>{2, 2}), topology.getCoresPerL3Domain());
+}
+
+TEST_F(SysfsCPUTopologyTests, reportsMissingTopology) {
+    auto processors = readCPUTopology(root, {0, 1});
+    ASSERT_EQ(2, processors.size());
+    ASSERT_EQ(-1, processors[0].core);
+    ASSERT_EQ(-1, processors[1].core);
+}
+#endif  // __linux__
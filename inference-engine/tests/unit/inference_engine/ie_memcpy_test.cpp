@@ -0,0 +1,160 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "common_test_utils/test_common.hpp"
+
+#include "ie_blob.h"
+#include "ie_memcpy.h"
+#include "blob_transform.hpp"
+
+using namespace InferenceEngine;
+
+class IEMemcpyTests : public CommonTestUtils::TestsCommon {
+protected:
+    static std::vector<uint8_t> makeData(size_t size) {
+        std::vector<uint8_t> data(size);
+        for (size_t i = 0; i < size; i++) {
+            data[i] = static_cast<uint8_t>(i * 7 + i / 251);
+        }
+        return data;
+    }
+};
+
+TEST_F(IEMemcpyTests, copiesSmallBuffers) {
+    auto src = makeData(100);
+    std::vector<uint8_t> dst(100);
+    ASSERT_EQ(0, ie_memcpy(dst.data(), dst.size(), src.data(), src.size()));
+    ASSERT_EQ(src, dst);
+}
+
+TEST_F(IEMemcpyTests, copiesLargeBuffersInParallel) {
+    // larger than both parallel and non-temporal thresholds, not a multiple of the cache line
+    const size_t size = (16 << 20) + 37;
+    auto src = makeData(size);
+    std::vector<uint8_t> dst(size);
+    ASSERT_EQ(0, ie_memcpy(dst.data(), dst.size(), src.data(), src.size()));
+    ASSERT_EQ(src, dst);
+}
+
+TEST_F(IEMemcpyTests, copiesToUnalignedDestination) {
+    const size_t size = (9 << 20) + 5;
+    auto src = makeData(size);
+    std::vector<uint8_t> dst(size + 3, 0);
+    ASSERT_EQ(0, ie_memcpy(dst.data() + 3, size, src.data() + 1, size - 1));
+    ASSERT_EQ(0, dst[2]);
+    for (size_t i = 0; i < size - 1; i++) {
+        ASSERT_EQ(src[i + 1], dst[i + 3]) << "at " << i;
+    }
+}
+
+TEST_F(IEMemcpyTests, failsAndZeroesDestinationOnOverflow) {
+    auto src = makeData(64);
+    std::vector<uint8_t> dst(32, 1);
+    ASSERT_NE(0, ie_memcpy(dst.data(), dst.size(), src.data(), src.size()));
+    ASSERT_EQ(std::vector<uint8_t>(32, 0), dst);
+}
+
+TEST_F(IEMemcpyTests, failsOnOverlappedBuffers) {
+    auto data = makeData(128);
+    ASSERT_NE(0, ie_memcpy(data.data() + 16, 64, data.data(), 64));
+}
+
+class BlobCopyTests : public CommonTestUtils::TestsCommon {
+protected:
+    static Blob::Ptr makeBlob(const SizeVector& dims, Layout layout) {
+        auto blob = make_shared_blob<float>(TensorDesc(Precision::FP32, dims, layout));
+        blob->allocate();
+        return blob;
+    }
+
+    static void fill(const Blob::Ptr& blob) {
+        auto data = blob->buffer().as<float*>();
+        for (size_t i = 0; i < blob->size(); i++) {
+            data[i] = static_cast<float>(i);
+        }
+    }
+
+    static float at(const Blob::Ptr& blob, const SizeVector& idx) {
+        const auto& blk = blob->getTensorDesc().getBlockingDesc();
+        const auto& order = blk.getOrder();
+        const auto& strides = blk.getStrides();
+        size_t offset = blk.getOffsetPadding();
+        for (size_t i = 0; i < order.size(); i++) {
+            offset += idx[order[i]] * strides[i];
+        }
+        return blob->cbuffer().as<const float*>()[offset];
+    }
+
+    static void compare4d(const Blob::Ptr& src, const Blob::Ptr& dst) {
+        const auto& dims = src->getTensorDesc().getDims();
+        for (size_t n = 0; n < dims[0]; n++)
+            for (size_t c = 0; c < dims[1]; c++)
+                for (size_t h = 0; h < dims[2]; h++)
+                    for (size_t w = 0; w < dims[3]; w++)
+                        ASSERT_EQ(at(src, {n, c, h, w}), at(dst, {n, c, h, w}));
+    }
+
+    static void compare5d(const Blob::Ptr& src, const Blob::Ptr& dst) {
+        const auto& dims = src->getTensorDesc().getDims();
+        for (size_t n = 0; n < dims[0]; n++)
+            for (size_t c = 0; c < dims[1]; c++)
+                for (size_t d = 0; d < dims[2]; d++)
+                    for (size_t h = 0; h < dims[3]; h++)
+                        for (size_t w = 0; w < dims[4]; w++)
+                            ASSERT_EQ(at(src, {n, c, d, h, w}), at(dst, {n, c, d, h, w}));
+    }
+};
+
+TEST_F(BlobCopyTests, copiesNHWCToNCHW) {
+    auto src = makeBlob({2, 5, 7, 33}, NHWC);
+    auto dst = makeBlob({2, 5, 7, 33}, NCHW);
+    fill(src);
+    blob_copy(src, dst);
+    compare4d(src, dst);
+}
+
+TEST_F(BlobCopyTests, copiesNCHWToNHWC) {
+    auto src = makeBlob({2, 5, 7, 33}, NCHW);
+    auto dst = makeBlob({2, 5, 7, 33}, NHWC);
+    fill(src);
+    blob_copy(src, dst);
+    compare4d(src, dst);
+}
+
+TEST_F(BlobCopyTests, copiesLargeNCHWToNHWCInParallel) {
+    auto src = makeBlob({1, 16, 64, 130}, NCHW);
+    auto dst = makeBlob({1, 16, 64, 130}, NHWC);
+    fill(src);
+    blob_copy(src, dst);
+    compare4d(src, dst);
+}
+
+TEST_F(BlobCopyTests, copiesSameLayout) {
+    auto src = makeBlob({2, 3, 4, 5}, NCHW);
+    auto dst = makeBlob({2, 3, 4, 5}, NCHW);
+    fill(src);
+    blob_copy(src, dst);
+    compare4d(src, dst);
+}
+
+TEST_F(BlobCopyTests, copiesNDHWCToNCDHW) {
+    auto src = makeBlob({2, 4, 3, 5, 19}, NDHWC);
+    auto dst = makeBlob({2, 4, 3, 5, 19}, NCDHW);
+    fill(src);
+    blob_copy(src, dst);
+    compare5d(src, dst);
+}
+
+TEST_F(BlobCopyTests, copiesNCDHWToNDHWC) {
+    auto src = makeBlob({2, 4, 3, 5, 19}, NCDHW);
+    auto dst = makeBlob({2, 4, 3, 5, 19}, NDHWC);
+    fill(src);
+    blob_copy(src, dst);
+    compare5d(src, dst);
+}
@@ -0,0 +1,142 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "common_test_utils/test_common.hpp"
+
+#include "precision_utils.h"
+
+using namespace InferenceEngine;
+
+class PrecisionUtilsTests : public CommonTestUtils::TestsCommon {
+protected:
+    static uint32_t bits(float value) {
+        uint32_t result;
+        std::memcpy(&result, &value, sizeof(result));
+        return result;
+    }
+
+    static float fromBits(uint32_t value) {
+        float result;
+        std::memcpy(&result, &value, sizeof(result));
+        return result;
+    }
+
+    // values around every f16 boundary: zeros, denormals, halfway points, overflow, INF and NAN
+    static std::vector<float> makeFloats() {
+        std::vector<float> values = {0.f, -0.f, 1.f, -1.f, 65504.f, 65519.f, 65520.f, -65520.f, 1e10f, -1e10f,
+                                     std::numeric_limits<float>::infinity(),
+                                     -std::numeric_limits<float>::infinity(),
+                                     std::numeric_limits<float>::quiet_NaN(),
+                                     fromBits(0x7F800001), fromBits(0xFFC00001),
+                                     std::numeric_limits<float>::denorm_min(),
+                                     std::numeric_limits<float>::min()};
+        for (uint32_t exp = 100; exp < 150; exp++) {
+            for (uint32_t mantissa : {0x0u, 0x1u, 0xFFFu, 0x1000u, 0x1001u, 0x2000u, 0x3000u, 0x7FFFFFu, 0x12345u}) {
+                values.push_back(fromBits((exp << 23) | mantissa));
+                values.push_back(fromBits(0x80000000u | (exp << 23) | mantissa));
+            }
+        }
+        // pseudo random values from the whole range
+        uint32_t seed = 12345;
+        for (int i = 0; i < 100000; i++) {
+            seed = seed * 1664525u + 1013904223u;
+            values.push_back(fromBits(seed));
+        }
+        return values;
+    }
+};
+
+TEST_F(PrecisionUtilsTests, f16tof32ArraysMatchesScalarConversionForAllValues) {
+    std::vector<ie_fp16> src(1 << 16);
+    for (size_t i = 0; i < src.size(); i++) {
+        src[i] = static_cast<ie_fp16>(i);
+    }
+    std::vector<float> dst(src.size());
+    PrecisionUtils::f16tof32Arrays(dst.data(), src.data(), src.size());
+    for (size_t i = 0; i < src.size(); i++) {
+        // default scale and bias are applied as well, so -0 becomes +0
+        ASSERT_EQ(bits(PrecisionUtils::f16tof32(src[i]) * 1.f + 0.f), bits(dst[i])) << "at " << i;
+    }
+}
+
+TEST_F(PrecisionUtilsTests, f32tof16ArraysMatchesScalarConversion) {
+    const auto src = makeFloats();
+    std::vector<ie_fp16> dst(src.size());
+    PrecisionUtils::f32tof16Arrays(dst.data(), src.data(), src.size());
+    for (size_t i = 0; i < src.size(); i++) {
+        ASSERT_EQ(PrecisionUtils::f32tof16(src[i] * 1.f + 0.f), dst[i]) << "at " << i << " for " << src[i];
+    }
+}
+
+TEST_F(PrecisionUtilsTests, f32tof16ArraysAppliesScaleAndBias) {
+    std::vector<float> src(1037);
+    for (size_t i = 0; i < src.size(); i++) {
+        src[i] = static_cast<float>(i) - 500.f;
+    }
+    std::vector<ie_fp16> dst(src.size());
+    PrecisionUtils::f32tof16Arrays(dst.data(), src.data(), src.size(), 2.f, 0.5f);
+    for (size_t i = 0; i < src.size(); i++) {
+        ASSERT_EQ(PrecisionUtils::f32tof16(src[i] * 2.f + 0.5f), dst[i]) << "at " << i;
+    }
+}
+
+TEST_F(PrecisionUtilsTests, f16tof32ArraysAppliesScaleAndBias) {
+    std::vector<ie_fp16> src(1037);
+    for (size_t i = 0; i < src.size(); i++) {
+        src[i] = PrecisionUtils::f32tof16(static_cast<float>(i) - 500.f);
+    }
+    std::vector<float> dst(src.size());
+    PrecisionUtils::f16tof32Arrays(dst.data(), src.data(), src.size(), 2.f, 0.5f);
+    for (size_t i = 0; i < src.size(); i++) {
+        ASSERT_EQ((static_cast<float>(i) - 500.f) * 2.f + 0.5f, dst[i]) << "at " << i;
+    }
+}
+
+TEST_F(PrecisionUtilsTests, bf16RoundTripMatchesScalarConversion) {
+    const auto src = makeFloats();
+    std::vector<ie_bf16> packed(src.size());
+    std::vector<float> unpacked(src.size());
+    PrecisionUtils::f32tobf16Arrays(packed.data(), src.data(), src.size());
+    PrecisionUtils::bf16tof32Arrays(unpacked.data(), packed.data(), packed.size());
+    for (size_t i = 0; i < src.size(); i++) {
+        const auto expected = PrecisionUtils::f32tobf16(src[i]);
+        ASSERT_EQ(expected, packed[i]) << "at " << i;
+        ASSERT_EQ(bits(PrecisionUtils::bf16tof32(expected)), bits(unpacked[i])) << "at " << i;
+    }
+}
+
+TEST_F(PrecisionUtilsTests, bf16ConversionKeepsUpperHalfOfFloat) {
+    ASSERT_EQ(static_cast<ie_bf16>(0x3F80), PrecisionUtils::f32tobf16(1.f));
+    ASSERT_EQ(static_cast<ie_bf16>(0xC000), PrecisionUtils::f32tobf16(-2.f));
+    ASSERT_EQ(1.f, PrecisionUtils::bf16tof32(static_cast<ie_bf16>(0x3F80)));
+    ASSERT_EQ(-2.f, PrecisionUtils::bf16tof32(static_cast<ie_bf16>(0xC000)));
+}
+
+TEST_F(PrecisionUtilsTests, largeArraysAreConvertedCompletely) {
+    // large enough to be split between threads, not a multiple of a vector
+    const size_t size = (1 << 20) + 13;
+    std::vector<float> src(size);
+    for (size_t i = 0; i < size; i++) {
+        src[i] = static_cast<float>(i % 256);
+    }
+    std::vector<ie_fp16> half(size);
+    std::vector<float> dst(size, -1.f);
+    PrecisionUtils::f32tof16Arrays(half.data(), src.data(), size);
+    PrecisionUtils::f16tof32Arrays(dst.data(), half.data(), size);
+    ASSERT_EQ(src, dst);
+
+    std::vector<ie_bf16> bf16(size);
+    std::fill(dst.begin(), dst.end(), -1.f);
+    PrecisionUtils::f32tobf16Arrays(bf16.data(), src.data(), size);
+    PrecisionUtils::bf16tof32Arrays(dst.data(), bf16.data(), size);
+    ASSERT_EQ(src, dst);
+}
@@ -0,0 +1,100 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "graph_transformer_tests.hpp"
+
+#include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
+
+namespace vpu {
+
+using namespace HWTilingNS;
+
+class HWConvolutionTilingCacheTests : public GraphTransformerTest {
+protected:
+    void SetUp() override {
+        ASSERT_NO_FATAL_FAILURE(GraphTransformerTest::SetUp());
+
+        ASSERT_NO_FATAL_FAILURE(InitCompileEnv());
+    }
+
+    static ConvolutionOptions makeOptions(const std::string& name, int size, int channels, bool withPool = false) {
+        const DimValues inputDims{{Dim::W, size}, {Dim::H, size}, {Dim::C, channels}, {Dim::N, 1}};
+        const int outputSize = withPool ? size / 2 : size;
+        const DimValues outputDims{{Dim::W, outputSize}, {Dim::H, outputSize}, {Dim::C, channels}, {Dim::N, 1}};
+        const DimValues origOutputDims{{Dim::W, size}, {Dim::H, size}, {Dim::C, channels}, {Dim::N, 1}};
+
+        return ConvolutionOptions{name, inputDims, outputDims, origOutputDims, 3, 3, 1, 1, 1, 1, 1, withPool};
+    }
+
+    static void compareTilingOptions(const std::vector<TilingOption>& expected,
+                                     const std::vector<TilingOption>& actual) {
+        ASSERT_EQ(expected.size(), actual.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            EXPECT_EQ(expected[i].numWidthTiles, actual[i].numWidthTiles);
+            EXPECT_EQ(expected[i].numHeightTiles, actual[i].numHeightTiles);
+            EXPECT_EQ(expected[i].numChannelTiles, actual[i].numChannelTiles);
+            EXPECT_EQ(expected[i].totalNumTiles, actual[i].totalNumTiles);
+            EXPECT_DOUBLE_EQ(expected[i].cost, actual[i].cost);
+        }
+    }
+
+    const Direction direction = Direction::INPUT_TO_OUTPUT;
+    const std::size_t maxTilingOptions = 3;
+};
+
+TEST_F(HWConvolutionTilingCacheTests, CachedSearchMatchesDirectSearch) {
+    const auto options = makeOptions("conv", 112, 128);
+
+    const auto expected = HWConvolutionTilingSearcher::searchTilingOptions(
+        options, direction, maxTilingOptions, CompileEnv::get().resources.numCMXSlices);
+    ASSERT_FALSE(expected.empty());
+
+    HWConvolutionTilingCache cache;
+    ASSERT_NO_FATAL_FAILURE(compareTilingOptions(expected, cache.get(options, direction, maxTilingOptions)));
+
+    const HWConvolutionTilingSearcher searcher(options, direction, maxTilingOptions, &cache);
+    ASSERT_NO_FATAL_FAILURE(compareTilingOptions(expected, searcher.tilingOptions()));
+    EXPECT_EQ(cache.size(), 1u);
+}
+
+TEST_F(HWConvolutionTilingCacheTests, PrefetchSearchesEachConfigurationOnce) {
+    const std::vector<ConvolutionOptions> allOptions = {
+        makeOptions("conv1", 112, 128),
+        makeOptions("conv2", 112, 128),
+        makeOptions("conv3", 56, 256),
+        makeOptions("conv4", 56, 256, true),
+        makeOptions("conv5", 56, 256),
+    };
+
+    HWConvolutionTilingCache cache;
+    cache.prefetch(allOptions, direction, maxTilingOptions);
+    EXPECT_EQ(cache.size(), 3u);
+
+    for (const auto& options : allOptions) {
+        const auto expected = HWConvolutionTilingSearcher::searchTilingOptions(
+            options, direction, maxTilingOptions, CompileEnv::get().resources.numCMXSlices);
+        ASSERT_NO_FATAL_FAILURE(compareTilingOptions(expected, cache.get(options, direction, maxTilingOptions)));
+    }
+    EXPECT_EQ(cache.size(), 3u);
+}
+
+TEST_F(HWConvolutionTilingCacheTests, TilerProducesSameTilingsWithCache) {
+    const auto options = makeOptions("conv", 112, 128);
+
+    HWConvolutionTilingCache cache;
+    const HWConvolutionTiler tiler(options, direction, maxTilingOptions);
+    const HWConvolutionTiler cachedTiler(options, direction, maxTilingOptions, &cache);
+
+    ASSERT_EQ(tiler.isTilingPossible(), cachedTiler.isTilingPossible());
+    ASSERT_EQ(tiler.getHwTilings().size(), cachedTiler.getHwTilings().size());
+    for (size_t i = 0; i < tiler.getHwTilings().size(); ++i) {
+        const auto& expected = tiler.getHwTilings()[i];
+        const auto& actual = cachedTiler.getHwTilings()[i];
+        EXPECT_EQ(expected->sohTiles, actual->sohTiles);
+        EXPECT_EQ(expected->sowTiles, actual->sowTiles);
+        EXPECT_EQ(expected->socTiles, actual->socTiles);
+    }
+}
+
+}  // namespace vpu
@@ -0,0 +1,227 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#ifdef _WIN32
+# include <direct.h>
+#else
+# include <sys/stat.h>
+#endif
+
+#include <cpp/ie_cnn_network.h>
+#include <ngraph/opsets/opset3.hpp>
+
+#include <vpu/compiled_graph_cache.hpp>
+
+namespace vpu {
+
+namespace ie = InferenceEngine;
+
+class CompiledGraphCacheTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const auto* testInfo = ::testing::UnitTest::GetInstance()->current_test_info();
+        _directory = std::string("vpu_compiled_graph_cache_") + testInfo->name();
+#ifdef _WIN32
+        _mkdir(_directory.c_str());
+#else
+        mkdir(_directory.c_str(), 0755);
+#endif
+    }
+
+    void TearDown() override {
+        for (const auto& key : _keys) {
+            std::remove(entryPath(key).c_str());
+        }
+        std::remove((_directory + "/index.txt").c_str());
+        std::remove(_directory.c_str());
+    }
+
+    static std::shared_ptr<ngraph::Function> makeFunction(const std::vector<float>& weights, std::int64_t axis = 1) {
+        const auto input = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, ngraph::Shape{1, 4, 8, 8});
+        const auto constant = std::make_shared<ngraph::opset3::Constant>(
+            ngraph::element::f32, ngraph::Shape{1, 4, 1, 1}, weights);
+        const auto multiply = std::make_shared<ngraph::opset3::Multiply>(input, constant);
+        const auto softmax = std::make_shared<ngraph::opset3::Softmax>(multiply, axis);
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{softmax}, ngraph::ParameterVector{input}, "net");
+    }
+
+    static std::string computeKey(const std::shared_ptr<ngraph::Function>& function,
+                                  const CompilationConfig& config = CompilationConfig()) {
+        const ie::CNNNetwork network(function);
+        return CompiledGraphCache::computeKey(network, Platform::MYRIAD_X, config);
+    }
+
+    static CompiledGraph makeCompiledGraph(std::size_t blobSize) {
+        CompiledGraph compiledGraph;
+        compiledGraph.blob.resize(blobSize);
+        for (std::size_t i = 0; i < blobSize; ++i) {
+            compiledGraph.blob[i] = static_cast<char>(i * 7);
+        }
+        compiledGraph.blobHeader = {compiledGraph.blob.data(), 16};
+        compiledGraph.networkName = "net";
+        compiledGraph.networkBatch = 1;
+        compiledGraph.numActiveStages = 3;
+        compiledGraph.inputBufSize = 512;
+        compiledGraph.outputBufSize = 256;
+        compiledGraph.numShaves = 4;
+        compiledGraph.numSlices = 4;
+        compiledGraph.numExecutors = 2;
+
+        compiledGraph.inputInfo.offset["input"] = 0;
+        compiledGraph.inputInfo.descFromPlugin.emplace("input",
+            ie::TensorDesc(ie::Precision::FP16, {1, 4, 8, 8}, ie::Layout::NHWC));
+        compiledGraph.inputInfo.totalSize = 512;
+        compiledGraph.outputInfo.offset["output"] = 0;
+        compiledGraph.outputInfo.descFromPlugin.emplace("output",
+            ie::TensorDesc(ie::Precision::FP16, {1, 4, 8, 8},
+                           ie::BlockingDesc({1, 4, 8, 8}, {0, 2, 3, 1}, 0, {0, 0, 0, 0}, {512, 1, 64, 8})));
+        compiledGraph.outputInfo.totalSize = 256;
+
+        compiledGraph.graphMeta.graphName = "net";
+        StageMetaInfo stage;
+        stage.status = ie::InferenceEngineProfileInfo::LayerStatus::EXECUTED;
+        stage.outPrecisions = {ie::Precision::FP16};
+        stage.outLayouts = {ie::Layout::NHWC};
+        stage.inputsNum = 2;
+        stage.layerName = "softmax";
+        stage.layerType = "SoftMax";
+        stage.displayStageName = "softmax";
+        stage.stageName = "softmax";
+        stage.stageType = "SoftMax";
+        stage.execOrder = 1;
+        compiledGraph.graphMeta.stagesMeta.push_back(stage);
+        compiledGraph.graphMeta.datasMeta.push_back(
+            DataMetaInfo{"output", ie::TensorDesc(ie::Precision::FP16, {1, 4, 8, 8}, ie::Layout::NHWC), 0, {1, 2}});
+
+        return compiledGraph;
+    }
+
+    std::string entryPath(const std::string& key) const {
+        return _directory + "/" + key + ".vpublob";
+    }
+
+    bool entryExists(const std::string& key) const {
+        if (auto file = std::fopen(entryPath(key).c_str(), "rb")) {
+            std::fclose(file);
+            return true;
+        }
+        return false;
+    }
+
+    CompiledGraphCache makeCache(std::uint64_t maxSize) {
+        return CompiledGraphCache(_directory, maxSize, std::make_shared<Logger>("Test", LogLevel::None, consoleOutput()));
+    }
+
+    std::string _directory;
+    std::vector<std::string> _keys = {"key1", "key2", "key3"};
+};
+
+TEST_F(CompiledGraphCacheTests, KeyIsStableAndSensitiveToNetworkAndConfig) {
+    const auto key = computeKey(makeFunction({1.f, 2.f, 3.f, 4.f}));
+    ASSERT_FALSE(key.empty());
+
+    EXPECT_EQ(key, computeKey(makeFunction({1.f, 2.f, 3.f, 4.f})));
+    EXPECT_NE(key, computeKey(makeFunction({1.f, 2.f, 3.f, 5.f})));
+    EXPECT_NE(key, computeKey(makeFunction({1.f, 2.f, 3.f, 4.f}, 2)));
+
+    CompilationConfig config;
+    config.hwOptimization = false;
+    EXPECT_NE(key, computeKey(makeFunction({1.f, 2.f, 3.f, 4.f}), config));
+
+    config = CompilationConfig();
+    config.compiledBlobCacheDir = _directory;
+    config.compiledBlobCacheSizeMB = 1;
+    EXPECT_EQ(key, computeKey(makeFunction({1.f, 2.f, 3.f, 4.f}), config));
+}
+
+TEST_F(CompiledGraphCacheTests, KeyIsEmptyForCompilationWithSideEffects) {
+    CompilationConfig config;
+    config.customLayers = "custom_layers.xml";
+    EXPECT_TRUE(computeKey(makeFunction({1.f, 2.f, 3.f, 4.f}), config).empty());
+
+    config = CompilationConfig();
+    config.dumpInternalGraphDirectory = _directory;
+    EXPECT_TRUE(computeKey(makeFunction({1.f, 2.f, 3.f, 4.f}), config).empty());
+}
+
+TEST_F(CompiledGraphCacheTests, LoadReturnsStoredGraph) {
+    const auto cache = makeCache(1024 * 1024);
+    const auto expected = makeCompiledGraph(1000);
+
+    EXPECT_EQ(cache.load("key1"), nullptr);
+    cache.store("key1", expected);
+
+    const auto actual = cache.load("key1");
+    ASSERT_NE(actual, nullptr);
+    EXPECT_EQ(expected.blob, actual->blob);
+    EXPECT_EQ(actual->blob.data(), actual->blobHeader.first);
+    EXPECT_EQ(expected.blobHeader.second, actual->blobHeader.second);
+    EXPECT_EQ(expected.networkName, actual->networkName);
+    EXPECT_EQ(expected.networkBatch, actual->networkBatch);
+    EXPECT_EQ(expected.numActiveStages, actual->numActiveStages);
+    EXPECT_EQ(expected.inputBufSize, actual->inputBufSize);
+    EXPECT_EQ(expected.outputBufSize, actual->outputBufSize);
+    EXPECT_EQ(expected.numShaves, actual->numShaves);
+    EXPECT_EQ(expected.numSlices, actual->numSlices);
+    EXPECT_EQ(expected.numExecutors, actual->numExecutors);
+
+    EXPECT_EQ(expected.inputInfo.offset, actual->inputInfo.offset);
+    EXPECT_EQ(expected.inputInfo.descFromPlugin, actual->inputInfo.descFromPlugin);
+    EXPECT_EQ(expected.inputInfo.totalSize, actual->inputInfo.totalSize);
+    EXPECT_EQ(expected.outputInfo.offset, actual->outputInfo.offset);
+    EXPECT_EQ(expected.outputInfo.descFromPlugin, actual->outputInfo.descFromPlugin);
+    EXPECT_EQ(expected.outputInfo.totalSize, actual->outputInfo.totalSize);
+
+    EXPECT_EQ(expected.graphMeta.graphName, actual->graphMeta.graphName);
+    ASSERT_EQ(1u, actual->graphMeta.stagesMeta.size());
+    const auto& expectedStage = expected.graphMeta.stagesMeta.front();
+    const auto& actualStage = actual->graphMeta.stagesMeta.front();
+    EXPECT_EQ(expectedStage.status, actualStage.status);
+    EXPECT_EQ(expectedStage.outPrecisions, actualStage.outPrecisions);
+    EXPECT_EQ(expectedStage.outLayouts, actualStage.outLayouts);
+    EXPECT_EQ(expectedStage.inputsNum, actualStage.inputsNum);
+    EXPECT_EQ(expectedStage.layerName, actualStage.layerName);
+    EXPECT_EQ(expectedStage.stageType, actualStage.stageType);
+    EXPECT_EQ(expectedStage.execOrder, actualStage.execOrder);
+    ASSERT_EQ(1u, actual->graphMeta.datasMeta.size());
+    EXPECT_EQ(expected.graphMeta.datasMeta.front().desc, actual->graphMeta.datasMeta.front().desc);
+    EXPECT_EQ(expected.graphMeta.datasMeta.front().childrenIndices, actual->graphMeta.datasMeta.front().childrenIndices);
+}
+
+TEST_F(CompiledGraphCacheTests, LeastRecentlyUsedEntryIsEvicted) {
+    // the metadata takes much less than the blob, so only two entries fit into the cache
+    const auto cache = makeCache(25000);
+    const auto compiledGraph = makeCompiledGraph(10000);
+
+    cache.store("key1", compiledGraph);
+    cache.store("key2", compiledGraph);
+    ASSERT_NE(cache.load("key1"), nullptr);
+
+    cache.store("key3", compiledGraph);
+
+    EXPECT_TRUE(entryExists("key1"));
+    EXPECT_FALSE(entryExists("key2"));
+    EXPECT_TRUE(entryExists("key3"));
+    EXPECT_NE(cache.load("key1"), nullptr);
+    EXPECT_EQ(cache.load("key2"), nullptr);
+    EXPECT_NE(cache.load("key3"), nullptr);
+}
+
+TEST_F(CompiledGraphCacheTests, GraphLargerThanCacheIsNotStored) {
+    const auto cache = makeCache(500);
+
+    cache.store("key1", makeCompiledGraph(1000));
+
+    EXPECT_FALSE(entryExists("key1"));
+    EXPECT_EQ(cache.load("key1"), nullptr);
+}
+
+}  // namespace vpu
@@ -5,6 +5,10 @@
 #include <gtest/gtest.h>
 #include <ie_core.hpp>
 
+#include <algorithm>
+#include <random>
+#include <vector>
+
 #include "tests_common.hpp"
 #include "single_layer_common.hpp"
 
@@ -187,3 +191,158 @@ INSTANTIATE_TEST_CASE_P(
         ::testing::Values(
                 detectionout_test_params{ "CPU",
                     10, {147264}, {147264}, {2, 1, 147264}, {1, 200, 7} }));
+
+struct detectionout_batch_test_params {
+    size_t mb;
+    size_t num_priors;
+    size_t keep_top_k;
+};
+
+class smoke_CPUDetectionOutBatchTest: public TestsCommon,
+                                      public WithParamInterface<detectionout_batch_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="DetectionOutput_Batch" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="loc" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="1">
+                    <dim>_MB_</dim>
+                    <dim>_IC_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conf" type="Input" precision="FP32" id="2">
+            <output>
+                <port id="2">
+                    <dim>_MB_</dim>
+                    <dim>_IC_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="priors" type="Input" precision="FP32" id="3">
+            <output>
+                <port id="3">
+                    <dim>_MB_</dim>
+                    <dim>2</dim>
+                    <dim>_IC_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="detection_out" type="DetectionOutput" precision="FP32" id="11">
+            <data num_classes="4" share_location="1" background_label_id="0" nms_threshold="0.450000" top_k="100"
+                  code_type="caffe.PriorBoxParameter.CENTER_SIZE" variance_encoded_in_target="0"
+                  keep_top_k="_KEEP_TOP_K_" confidence_threshold="0.010000" clip_after_nms="1"/>
+            <input>
+                <port id="11">
+                    <dim>_MB_</dim>
+                    <dim>_IC_</dim>
+                </port>
+                <port id="12">
+                    <dim>_MB_</dim>
+                    <dim>_IC_</dim>
+                </port>
+                <port id="13">
+                    <dim>_MB_</dim>
+                    <dim>2</dim>
+                    <dim>_IC_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="14">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>_OH_</dim>
+                    <dim>7</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="1" to-layer="11" to-port="11"/>
+        <edge from-layer="2" from-port="2" to-layer="11" to-port="12"/>
+        <edge from-layer="3" from-port="3" to-layer="11" to-port="13"/>
+    </edges>
+</Net>
+)V0G0N";
+
+    std::string getModel(const detectionout_batch_test_params& p, size_t mb) {
+        std::string model = model_t;
+
+        REPLACE_WITH_NUM(model, "_MB_", mb);
+        REPLACE_WITH_NUM(model, "_IC_", p.num_priors * 4);
+        REPLACE_WITH_NUM(model, "_KEEP_TOP_K_", p.keep_top_k);
+        REPLACE_WITH_NUM(model, "_OH_", mb * p.keep_top_k);
+
+        return model;
+    }
+
+    // returns detections of every image of the batch
+    std::vector<std::vector<std::vector<float>>> infer(const detectionout_batch_test_params& p, size_t mb,
+                                                       const float* loc, const float* conf, const float* priors) {
+        Core ie;
+        CNNNetwork network = ie.ReadNetwork(getModel(p, mb), Blob::CPtr());
+        ExecutableNetwork exeNetwork = ie.LoadNetwork(network, "CPU");
+        InferRequest inferRequest = exeNetwork.CreateInferRequest();
+
+        const size_t size = p.num_priors * 4;
+        std::copy_n(loc, mb * size, inferRequest.GetBlob("loc")->buffer().as<float*>());
+        std::copy_n(conf, mb * size, inferRequest.GetBlob("conf")->buffer().as<float*>());
+        std::copy_n(priors, mb * 2 * size, inferRequest.GetBlob("priors")->buffer().as<float*>());
+        inferRequest.Infer();
+
+        const float* dst = inferRequest.GetBlob("detection_out")->cbuffer().as<const float*>();
+        std::vector<std::vector<std::vector<float>>> detections(mb);
+        for (size_t i = 0; i < mb * p.keep_top_k && dst[i * 7] != -1; i++) {
+            detections.at(static_cast<size_t>(dst[i * 7])).emplace_back(dst + i * 7 + 1, dst + i * 7 + 7);
+        }
+        return detections;
+    }
+
+protected:
+    virtual void SetUp() {
+        try {
+            detectionout_batch_test_params p = ::testing::WithParamInterface<detectionout_batch_test_params>::GetParam();
+
+            const size_t size = p.num_priors * 4;
+            std::vector<float> loc(p.mb * size), conf(p.mb * size), priors(p.mb * 2 * size);
+            std::mt19937 gen(42);
+            std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+            for (auto& value : loc) value = 2.0f * dist(gen) - 1.0f;
+            for (auto& value : conf) value = dist(gen);
+            for (size_t n = 0; n < p.mb; n++) {
+                float* ppriors = priors.data() + n * 2 * size;
+                for (size_t i = 0; i < p.num_priors; i++) {
+                    ppriors[i * 4 + 0] = 0.8f * dist(gen);
+                    ppriors[i * 4 + 1] = 0.8f * dist(gen);
+                    ppriors[i * 4 + 2] = ppriors[i * 4 + 0] + 0.05f + 0.2f * dist(gen);
+                    ppriors[i * 4 + 3] = ppriors[i * 4 + 1] + 0.05f + 0.2f * dist(gen);
+                    for (size_t j = 0; j < 4; j++)
+                        ppriors[size + i * 4 + j] = j < 2 ? 0.1f : 0.2f;
+                }
+            }
+
+            const auto batched = infer(p, p.mb, loc.data(), conf.data(), priors.data());
+            for (size_t n = 0; n < p.mb; n++) {
+                const auto single = infer(p, 1, loc.data() + n * size, conf.data() + n * size,
+                                          priors.data() + n * 2 * size);
+                ASSERT_EQ(single[0].size(), batched[n].size()) << "image " << n;
+                ASSERT_FALSE(single[0].empty());
+                for (size_t i = 0; i < single[0].size(); i++) {
+                    for (size_t j = 0; j < 6; j++) {
+                        ASSERT_NEAR(single[0][i][j], batched[n][i][j], 1e-6f) << "image " << n << " detection " << i;
+                    }
+                }
+            }
+        } catch (const details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(smoke_CPUDetectionOutBatchTest, BatchedDetectionsMatchSingleImage) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsDetectionOut, smoke_CPUDetectionOutBatchTest,
+        ::testing::Values(
+                detectionout_batch_test_params{ 5, 1000, 50 },
+                detectionout_batch_test_params{ 3, 97, 200 }));
@@ -0,0 +1,13 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+/**
+ * @brief Returns the number of heap allocations made by the process so far.
+ *        Global operator new is replaced in allocation_counter.cpp to count them.
+ */
+std::size_t getAllocationsCount();
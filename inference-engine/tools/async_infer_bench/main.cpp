@@ -0,0 +1,234 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "allocation_counter.hpp"
+
+#include <cpp_interfaces/base/ie_infer_async_request_base.hpp>
+#include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+#include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
+#include <threading/ie_cpu_streams_executor.hpp>
+#include <threading/ie_immediate_executor.hpp>
+
+using namespace InferenceEngine;
+
+static constexpr char help_message[] = "Optional. Print the usage message.";
+static constexpr char niter_message[] = "Optional. Number of measured requests per configuration. Default: 100000.";
+static constexpr char nwarmup_message[] = "Optional. Number of warm-up requests per configuration. Default: 1000.";
+static constexpr char executors_message[] = "Optional. Comma separated list of executors running the pipeline. "
+                                            "Supported: immediate, streams. Default: \"immediate,streams\".";
+
+DEFINE_bool(h, false, help_message);
+DEFINE_uint32(niter, 100000, niter_message);
+DEFINE_uint32(nwarmup, 1000, nwarmup_message);
+DEFINE_string(executors, "immediate,streams", executors_message);
+
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "async_infer_bench [OPTIONS]" << std::endl;
+    std::cout << "[OPTIONS]:" << std::endl;
+    std::cout << "    -h                           "   << help_message        << std::endl;
+    std::cout << "    -niter           <value>     "   << niter_message       << std::endl;
+    std::cout << "    -nwarmup         <value>     "   << nwarmup_message     << std::endl;
+    std::cout << "    -executors       <value>     "   << executors_message   << std::endl;
+}
+
+namespace {
+
+std::vector<std::string> split(const std::string &str, char delim) {
+    std::vector<std::string> result;
+    std::string::size_type start = 0;
+    while (start <= str.size()) {
+        auto end = str.find(delim, start);
+        if (end == std::string::npos) end = str.size();
+        if (end != start) result.push_back(str.substr(start, end - start));
+        start = end + 1;
+    }
+    return result;
+}
+
+// The synchronous request does nothing, so only the asynchronous machinery is measured
+class EmptyInferRequest : public InferRequestInternal {
+public:
+    EmptyInferRequest() : InferRequestInternal({}, {}) {}
+    void InferImpl() override {}
+    void GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo>&) const override {}
+};
+
+class AsyncInferRequest : public AsyncInferRequestThreadSafeDefault {
+public:
+    AsyncInferRequest(const InferRequestInternal::Ptr& request, const ITaskExecutor::Ptr& taskExecutor)
+        : AsyncInferRequestThreadSafeDefault(request, taskExecutor, nullptr) {}
+    ~AsyncInferRequest() {
+        StopAndWait();
+    }
+};
+
+// Reproduces the promise based pipeline: a new promise and a shared future per request,
+// futures pruned under the mutex and the stage task built with std::bind
+class PromiseInferRequest {
+public:
+    PromiseInferRequest(const InferRequestInternal::Ptr& request, const ITaskExecutor::Ptr& taskExecutor)
+        : _request{request}, _taskExecutor{taskExecutor} {}
+
+    void StartAsync() {
+        _promise = {};
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _futures.erase(std::remove_if(_futures.begin(), _futures.end(), [](const std::shared_future<void>& future) {
+                return std::future_status::ready == future.wait_for(std::chrono::milliseconds{0});
+            }), _futures.end());
+            _futures.emplace_back(_promise.get_future().share());
+        }
+        _taskExecutor->run(std::bind([this](ITaskExecutor::Ptr&) {
+            _request->Infer();
+            auto promise = std::move(_promise);
+            promise.set_value();
+        }, ITaskExecutor::Ptr{}));
+    }
+
+    void Wait() {
+        auto future = [&] {
+            std::lock_guard<std::mutex> lock{_mutex};
+            return _futures.back();
+        }();
+        future.wait();
+        future.get();
+    }
+
+private:
+    InferRequestInternal::Ptr _request;
+    ITaskExecutor::Ptr _taskExecutor;
+    std::promise<void> _promise;
+    std::mutex _mutex;
+    std::vector<std::shared_future<void>> _futures;
+};
+
+struct Result {
+    double nsPerRequest;
+    double allocationsPerRequest;
+};
+
+template <typename Run>
+Result measure(Run&& run) {
+    run(FLAGS_nwarmup);
+    auto allocationsBefore = getAllocationsCount();
+    auto start = std::chrono::steady_clock::now();
+    run(FLAGS_niter);
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    return {static_cast<double>(duration.count()) / FLAGS_niter,
+            static_cast<double>(getAllocationsCount() - allocationsBefore) / FLAGS_niter};
+}
+
+struct CallbackState {
+    std::uint32_t remaining = 0;
+    std::promise<void> finished;
+};
+
+void restartFromCallback(IInferRequest::Ptr request, StatusCode status) {
+    CallbackState* state = nullptr;
+    request->GetUserData(reinterpret_cast<void**>(&state), nullptr);
+    if (StatusCode::OK != status || 0 == --state->remaining) {
+        state->finished.set_value();
+    } else {
+        request->StartAsync(nullptr);
+    }
+}
+
+ITaskExecutor::Ptr makeExecutor(const std::string& name) {
+    if (name == "immediate") {
+        return std::make_shared<ImmediateExecutor>();
+    } else if (name == "streams") {
+        return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"AsyncInferBench", 1, 1});
+    }
+    THROW_IE_EXCEPTION << "Unsupported executor: " << name;
+}
+
+void printResult(const std::string& executor, const std::string& mode, const Result& result) {
+    std::cout << std::left << std::setw(12) << executor << std::setw(24) << mode
+              << std::right << std::fixed << std::setprecision(1)
+              << std::setw(14) << result.nsPerRequest
+              << std::setw(16) << std::setprecision(2) << result.allocationsPerRequest << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    try {
+        gflags::ParseCommandLineNonHelpFlags(&argc, &argv, true);
+        if (FLAGS_h) {
+            showUsage();
+            return 0;
+        }
+        if (FLAGS_niter == 0) {
+            THROW_IE_EXCEPTION << "Number of iterations should be positive";
+        }
+
+        std::cout << std::left << std::setw(12) << "executor" << std::setw(24) << "mode"
+                  << std::right << std::setw(14) << "ns/request" << std::setw(16) << "allocs/request" << std::endl;
+
+        for (auto&& executorName : split(FLAGS_executors, ',')) {
+            auto executor = makeExecutor(executorName);
+
+            PromiseInferRequest promiseRequest{std::make_shared<EmptyInferRequest>(), executor};
+            printResult(executorName, "promise StartAsync+Wait", measure([&] (std::uint32_t niter) {
+                for (std::uint32_t i = 0; i < niter; i++) {
+                    promiseRequest.StartAsync();
+                    promiseRequest.Wait();
+                }
+            }));
+
+            auto asyncRequest = std::make_shared<AsyncInferRequest>(std::make_shared<EmptyInferRequest>(), executor);
+            IInferRequest::Ptr publicRequest(new InferRequestBase<AsyncInferRequest>(asyncRequest),
+                                             [](IInferRequest* p) { p->Release(); });
+            asyncRequest->SetPointerToPublicInterface(publicRequest);
+
+            printResult(executorName, "StartAsync+Wait", measure([&] (std::uint32_t niter) {
+                for (std::uint32_t i = 0; i < niter; i++) {
+                    asyncRequest->StartAsync();
+                    asyncRequest->Wait(IInferRequest::WaitMode::RESULT_READY);
+                }
+            }));
+
+            printResult(executorName, "Infer", measure([&] (std::uint32_t niter) {
+                for (std::uint32_t i = 0; i < niter; i++) {
+                    asyncRequest->Infer();
+                }
+            }));
+
+            // The immediate executor would recursively start requests from the callback
+            if (executorName != "immediate") {
+                printResult(executorName, "StartAsync from callback", measure([&] (std::uint32_t niter) {
+                    CallbackState state;
+                    state.remaining = niter;
+                    auto finished = state.finished.get_future();
+                    asyncRequest->SetUserData(&state);
+                    asyncRequest->SetCompletionCallback(restartFromCallback);
+                    asyncRequest->StartAsync();
+                    finished.wait();
+                    asyncRequest->Wait(IInferRequest::WaitMode::RESULT_READY);
+                    asyncRequest->SetCompletionCallback(nullptr);
+                }));
+            }
+        }
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
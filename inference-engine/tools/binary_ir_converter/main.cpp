@@ -0,0 +1,121 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include <gflags/gflags.h>
+
+#include <inference_engine.hpp>
+#include <ie_binary_ir.hpp>
+
+using namespace InferenceEngine;
+
+static constexpr char help_message[] = "Optional. Print the usage message.";
+static constexpr char model_message[] = "Required. Path to the XML model.";
+static constexpr char weights_message[] = "Optional. Path to the weights. Default value: \"<model_xml_file>.bin\".";
+static constexpr char output_message[] = "Optional. Path to the output file. Default value: \"<model_xml_file>.irb\".";
+static constexpr char niter_message[] = "Optional. Number of reads of both models to compare loading time. Default: 0.";
+
+DEFINE_bool(h, false, help_message);
+DEFINE_string(m, "", model_message);
+DEFINE_string(w, "", weights_message);
+DEFINE_string(o, "", output_message);
+DEFINE_uint32(niter, 0, niter_message);
+
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "binary_ir_converter [OPTIONS]" << std::endl;
+    std::cout << "[OPTIONS]:" << std::endl;
+    std::cout << "    -h                           "   << help_message        << std::endl;
+    std::cout << "    -m               <value>     "   << model_message       << std::endl;
+    std::cout << "    -w               <value>     "   << weights_message     << std::endl;
+    std::cout << "    -o               <value>     "   << output_message      << std::endl;
+    std::cout << "    -niter           <value>     "   << niter_message       << std::endl;
+}
+
+static bool parseCommandLine(int* argc, char*** argv) {
+    gflags::ParseCommandLineNonHelpFlags(argc, argv, true);
+
+    if (FLAGS_h) {
+        showUsage();
+        return false;
+    }
+
+    if (FLAGS_m.empty()) {
+        throw std::invalid_argument("Path to model xml file is required");
+    }
+
+    if (1 < *argc) {
+        std::stringstream message;
+        message << "Unknown arguments: ";
+        for (auto arg = 1; arg < *argc; arg++) {
+            message << (*argv)[arg] << " ";
+        }
+        throw std::invalid_argument(message.str());
+    }
+
+    return true;
+}
+
+static double readTime(Core& ie, const std::string& model, const std::string& weights) {
+    using ms = std::chrono::duration<double, std::milli>;
+    auto best = ms::max();
+    for (uint32_t i = 0; i < FLAGS_niter; i++) {
+        const auto start = std::chrono::steady_clock::now();
+        ie.ReadNetwork(model, weights);
+        best = std::min<ms>(best, std::chrono::steady_clock::now() - start);
+    }
+    return best.count();
+}
+
+int main(int argc, char* argv[]) {
+    try {
+        std::cout << "Inference Engine: " << GetInferenceEngineVersion() << std::endl;
+
+        if (!parseCommandLine(&argc, &argv)) {
+            return EXIT_SUCCESS;
+        }
+
+        Core ie;
+        auto network = ie.ReadNetwork(FLAGS_m, FLAGS_w);
+        auto function = network.getFunction();
+        if (!function) {
+            throw std::invalid_argument("Only IR v10 models can be converted to Binary IR");
+        }
+
+        std::string outputName = FLAGS_o;
+        if (outputName.empty()) {
+            outputName = FLAGS_m.substr(0, FLAGS_m.rfind('.')) + "." + BinaryIR::fileExtension;
+        }
+        {
+            std::ofstream outputFile(outputName, std::ios::binary);
+            if (!outputFile.is_open()) {
+                throw std::runtime_error("Cannot open " + outputName);
+            }
+            BinaryIR::serialize(*function, outputFile);
+        }
+        std::cout << "Binary IR is written to " << outputName << std::endl;
+
+        if (FLAGS_niter > 0) {
+            std::cout << "ReadNetwork time, best of " << FLAGS_niter << ":" << std::endl;
+            std::cout << "    XML IR:    " << readTime(ie, FLAGS_m, FLAGS_w) << " ms" << std::endl;
+            std::cout << "    Binary IR: " << readTime(ie, outputName, "") << " ms" << std::endl;
+        }
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        return EXIT_FAILURE;
+    } catch (...) {
+        std::cerr << "Unknown/internal exception happened." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
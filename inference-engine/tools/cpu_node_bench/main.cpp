@@ -0,0 +1,526 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include <inference_engine.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset2.hpp>
+#include <ngraph/variant.hpp>
+
+using namespace InferenceEngine;
+
+static constexpr char help_message[] = "Optional. Print the usage message.";
+static constexpr char ops_message[] = "Optional. Comma separated list of operations to benchmark. "
+                                      "Default: all. Use -list to print the supported operations.";
+static constexpr char list_message[] = "Optional. Print the supported operations and exit.";
+static constexpr char shapes_message[] = "Optional. Comma separated list of NCHW input shapes. "
+                                         "Default: \"1x64x56x56,1x256x14x14\".";
+static constexpr char layouts_message[] = "Optional. Comma separated list of memory layouts forced on the node. "
+                                          "Supported: planar, nChw8c, nChw16c, nhwc. Default: \"planar,nChw8c,nChw16c,nhwc\".";
+static constexpr char precisions_message[] = "Optional. Comma separated list of node precisions. "
+                                             "Supported: FP32, BF16. Default: \"FP32\".";
+static constexpr char isa_message[] = "Optional. Comma separated list of preferred implementations. "
+                                      "Supported: any, avx512, avx2, sse42, ref. Default: \"any\".";
+static constexpr char niter_message[] = "Optional. Number of measured inferences per configuration. Default: 100.";
+static constexpr char nwarmup_message[] = "Optional. Number of warm-up inferences per configuration. Default: 10.";
+static constexpr char nthreads_message[] = "Optional. Number of threads used for inference. Default: plugin default.";
+static constexpr char report_message[] = "Optional. Path to the CSV report with the results.";
+static constexpr char baseline_message[] = "Optional. Path to the CSV report of a previous run to compare the results with.";
+static constexpr char threshold_message[] = "Optional. Allowed slowdown against the baseline, in percents. Default: 10.";
+
+DEFINE_bool(h, false, help_message);
+DEFINE_string(ops, "", ops_message);
+DEFINE_bool(list, false, list_message);
+DEFINE_string(shapes, "1x64x56x56,1x256x14x14", shapes_message);
+DEFINE_string(layouts, "planar,nChw8c,nChw16c,nhwc", layouts_message);
+DEFINE_string(precisions, "FP32", precisions_message);
+DEFINE_string(isa, "any", isa_message);
+DEFINE_uint32(niter, 100, niter_message);
+DEFINE_uint32(nwarmup, 10, nwarmup_message);
+DEFINE_uint32(nthreads, 0, nthreads_message);
+DEFINE_string(report, "", report_message);
+DEFINE_string(baseline, "", baseline_message);
+DEFINE_double(threshold, 10.0, threshold_message);
+
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "cpu_node_bench [OPTIONS]" << std::endl;
+    std::cout << "[OPTIONS]:" << std::endl;
+    std::cout << "    -h                           "   << help_message        << std::endl;
+    std::cout << "    -list                        "   << list_message        << std::endl;
+    std::cout << "    -ops             <value>     "   << ops_message         << std::endl;
+    std::cout << "    -shapes          <value>     "   << shapes_message      << std::endl;
+    std::cout << "    -layouts         <value>     "   << layouts_message     << std::endl;
+    std::cout << "    -precisions      <value>     "   << precisions_message  << std::endl;
+    std::cout << "    -isa             <value>     "   << isa_message         << std::endl;
+    std::cout << "    -niter           <value>     "   << niter_message       << std::endl;
+    std::cout << "    -nwarmup         <value>     "   << nwarmup_message     << std::endl;
+    std::cout << "    -nthreads        <value>     "   << nthreads_message    << std::endl;
+    std::cout << "    -report          <value>     "   << report_message      << std::endl;
+    std::cout << "    -baseline        <value>     "   << baseline_message    << std::endl;
+    std::cout << "    -threshold       <value>     "   << threshold_message   << std::endl;
+}
+
+namespace {
+
+std::vector<std::string> split(const std::string &str, char delim) {
+    std::vector<std::string> result;
+    std::stringstream stream(str);
+    std::string item;
+    while (std::getline(stream, item, delim)) {
+        if (!item.empty())
+            result.push_back(item);
+    }
+    return result;
+}
+
+ngraph::Shape parseShape(const std::string &str) {
+    ngraph::Shape shape;
+    for (const auto &dim : split(str, 'x'))
+        shape.push_back(std::stoul(dim));
+    if (shape.size() != 4)
+        THROW_IE_EXCEPTION << "Only NCHW shapes are supported, got: " << str;
+    return shape;
+}
+
+std::string shapeToString(const ngraph::Shape &shape) {
+    std::string result;
+    for (auto dim : shape)
+        result += (result.empty() ? "" : "x") + std::to_string(dim);
+    return result;
+}
+
+std::shared_ptr<ngraph::Node> makeConst(const ngraph::Shape &shape, float value) {
+    return ngraph::opset1::Constant::create(ngraph::element::f32, shape,
+                                            std::vector<float>(ngraph::shape_size(shape), value));
+}
+
+/**
+ * One benchmarked operation. The builder gets parameters of the shape being benchmarked and
+ * returns the operation, whose runtime info is then used to force memory layouts and implementations.
+ */
+struct OpCase {
+    std::string name;
+    size_t numInputs;
+    std::function<std::shared_ptr<ngraph::Node>(const ngraph::ParameterVector &)> builder;
+    // Floating point operations per output element, 0 for memory bound operations
+    std::function<double(const ngraph::Shape &)> flopsPerOutput;
+    // Layer types whose execution time is measured, empty means all except inputs, outputs and reorders
+    std::vector<std::string> measuredTypes;
+};
+
+std::vector<OpCase> getOpCases() {
+    auto memoryBound = [](const ngraph::Shape &) { return 0.0; };
+
+    std::vector<OpCase> cases = {
+        {"Relu", 1, [](const ngraph::ParameterVector &params) {
+            return std::make_shared<ngraph::opset1::Relu>(params[0]);
+        }, memoryBound, {}},
+        {"Sigmoid", 1, [](const ngraph::ParameterVector &params) {
+            return std::make_shared<ngraph::opset1::Sigmoid>(params[0]);
+        }, memoryBound, {}},
+        {"Add", 2, [](const ngraph::ParameterVector &params) {
+            return std::make_shared<ngraph::opset1::Add>(params[0], params[1]);
+        }, memoryBound, {}},
+        {"Multiply", 2, [](const ngraph::ParameterVector &params) {
+            return std::make_shared<ngraph::opset1::Multiply>(params[0], params[1]);
+        }, memoryBound, {}},
+        {"Concat", 2, [](const ngraph::ParameterVector &params) {
+            return std::make_shared<ngraph::opset1::Concat>(ngraph::OutputVector{params[0], params[1]}, 1);
+        }, memoryBound, {}},
+        {"Transpose", 1, [](const ngraph::ParameterVector &params) {
+            auto order = ngraph::opset1::Constant::create(ngraph::element::i64, {4}, {0, 2, 3, 1});
+            return std::make_shared<ngraph::opset1::Transpose>(params[0], order);
+        }, memoryBound, {}},
+        {"Interpolate", 1, [](const ngraph::ParameterVector &params) {
+            auto shape = params[0]->get_shape();
+            auto outShape = ngraph::opset1::Constant::create(ngraph::element::i64, {2}, {2 * shape[2], 2 * shape[3]});
+            ngraph::op::InterpolateAttrs attrs;
+            attrs.axes = {2, 3};
+            attrs.mode = "nearest";
+            attrs.align_corners = false;
+            attrs.pads_begin = {0, 0, 0, 0};
+            attrs.pads_end = {0, 0, 0, 0};
+            return std::make_shared<ngraph::opset1::Interpolate>(params[0], outShape, attrs);
+        }, memoryBound, {}},
+        {"MaxPool", 1, [](const ngraph::ParameterVector &params) {
+            return std::make_shared<ngraph::opset1::MaxPool>(params[0], ngraph::Strides{1, 1}, ngraph::Shape{1, 1},
+                                                              ngraph::Shape{1, 1}, ngraph::Shape{3, 3},
+                                                              ngraph::op::RoundingType::FLOOR);
+        }, memoryBound, {}},
+        {"AvgPool", 1, [](const ngraph::ParameterVector &params) {
+            return std::make_shared<ngraph::opset1::AvgPool>(params[0], ngraph::Strides{1, 1}, ngraph::Shape{1, 1},
+                                                              ngraph::Shape{1, 1}, ngraph::Shape{3, 3}, false,
+                                                              ngraph::op::RoundingType::FLOOR);
+        }, [](const ngraph::Shape &) { return 9.0; }, {}},
+        {"Convolution", 1, [](const ngraph::ParameterVector &params) {
+            auto channels = params[0]->get_shape()[1];
+            auto weights = makeConst({channels, channels, 3, 3}, 0.01f);
+            return std::make_shared<ngraph::opset1::Convolution>(params[0], weights, ngraph::Strides{1, 1},
+                                                                  ngraph::CoordinateDiff{1, 1}, ngraph::CoordinateDiff{1, 1},
+                                                                  ngraph::Strides{1, 1});
+        }, [](const ngraph::Shape &shape) { return 2.0 * shape[1] * 9; }, {}},
+        {"GroupConvolutionDW", 1, [](const ngraph::ParameterVector &params) {
+            auto channels = params[0]->get_shape()[1];
+            auto weights = makeConst({channels, 1, 1, 3, 3}, 0.01f);
+            return std::make_shared<ngraph::opset1::GroupConvolution>(params[0], weights, ngraph::Strides{1, 1},
+                                                                       ngraph::CoordinateDiff{1, 1}, ngraph::CoordinateDiff{1, 1},
+                                                                       ngraph::Strides{1, 1});
+        }, [](const ngraph::Shape &) { return 2.0 * 9; }, {}},
+        {"MVN", 1, [](const ngraph::ParameterVector &params) {
+            return std::make_shared<ngraph::opset2::MVN>(params[0], false, true, 1e-9);
+        }, memoryBound, {}},
+        {"Softmax", 1, [](const ngraph::ParameterVector &params) {
+            return std::make_shared<ngraph::opset1::Softmax>(params[0], 1);
+        }, memoryBound, {}},
+        {"ReduceMean", 1, [](const ngraph::ParameterVector &params) {
+            auto axes = ngraph::opset1::Constant::create(ngraph::element::i64, {2}, {2, 3});
+            return std::make_shared<ngraph::opset1::ReduceMean>(params[0], axes, true);
+        }, memoryBound, {}},
+        // Reorder from the planar network input into the layout forced on the consumer
+        {"Reorder", 1, [](const ngraph::ParameterVector &params) {
+            return std::make_shared<ngraph::opset1::Relu>(params[0]);
+        }, memoryBound, {"Reorder"}},
+    };
+    return cases;
+}
+
+std::string layoutToFormat(const std::string &layout, size_t rank) {
+    if (layout == "planar")
+        return rank == 4 ? "nchw" : "";
+    if (rank != 4)
+        return "";
+    if (layout == "nChw8c" || layout == "nChw16c" || layout == "nhwc")
+        return layout;
+    THROW_IE_EXCEPTION << "Unsupported layout: " << layout;
+}
+
+std::string isaToPriority(const std::string &isa) {
+    if (isa == "any")
+        return "";
+    if (isa == "ref")
+        return "cpu:ref_any,cpu:ref";
+    if (isa == "avx512" || isa == "avx2" || isa == "sse42")
+        return "cpu:jit_" + isa + ",cpu:jit_" + isa + "_1x1,cpu:jit_" + isa + "_dw";
+    THROW_IE_EXCEPTION << "Unsupported isa: " << isa;
+}
+
+std::string formatsList(const std::string &format, size_t count) {
+    std::string result;
+    for (size_t i = 0; i < count; i++)
+        result += (i == 0 ? "cpu:" : ",cpu:") + format;
+    return result;
+}
+
+struct BenchConfig {
+    std::string op;
+    std::string shape;
+    std::string layout;
+    std::string precision;
+    std::string isa;
+
+    std::string key() const {
+        return op + "," + shape + "," + layout + "," + precision + "," + isa;
+    }
+};
+
+struct BenchResult {
+    BenchConfig config;
+    std::string impl;
+    double nodeTimeUs = 0;
+    double inferTimeUs = 0;
+    double nsPerElement = 0;
+    double gbPerSec = 0;
+    double gflops = 0;
+};
+
+std::shared_ptr<ngraph::Function> buildFunction(const OpCase &opCase, const ngraph::Shape &shape,
+                                                const BenchConfig &config) {
+    ngraph::ParameterVector params;
+    for (size_t i = 0; i < opCase.numInputs; i++)
+        params.push_back(std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, shape));
+
+    auto op = opCase.builder(params);
+    op->set_friendly_name(config.op);
+
+    auto &rtInfo = op->get_rt_info();
+    auto inFormat = layoutToFormat(config.layout, shape.size());
+    if (!inFormat.empty())
+        rtInfo["InputMemoryFormats"] = std::make_shared<ngraph::VariantWrapper<std::string>>(
+                formatsList(inFormat, opCase.numInputs));
+    auto outFormat = layoutToFormat(config.layout, op->get_output_shape(0).size());
+    if (!outFormat.empty())
+        rtInfo["OutputMemoryFormats"] = std::make_shared<ngraph::VariantWrapper<std::string>>(
+                formatsList(outFormat, 1));
+    auto priority = isaToPriority(config.isa);
+    if (!priority.empty())
+        rtInfo["PrimitivesPriority"] = std::make_shared<ngraph::VariantWrapper<std::string>>(priority);
+
+    auto result = std::make_shared<ngraph::opset1::Result>(op);
+    return std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, params, config.op);
+}
+
+void fillBlob(const Blob::Ptr &blob) {
+    auto memory = as<MemoryBlob>(blob);
+    if (!memory)
+        THROW_IE_EXCEPTION << "Unexpected blob type";
+    auto lock = memory->wmap();
+    auto data = lock.as<float *>();
+    for (size_t i = 0; i < blob->size(); i++)
+        data[i] = static_cast<float>(i % 255) / 127.f - 1.f;
+}
+
+bool isMeasured(const OpCase &opCase, const InferenceEngineProfileInfo &info) {
+    if (info.status != InferenceEngineProfileInfo::EXECUTED)
+        return false;
+    std::string type = info.layer_type;
+    if (!opCase.measuredTypes.empty())
+        return std::find(opCase.measuredTypes.begin(), opCase.measuredTypes.end(), type) != opCase.measuredTypes.end();
+    return type != "Input" && type != "Output" && type != "Reorder" && type != "Const";
+}
+
+// Perf counters are truncated to whole microseconds, while the execution graph keeps
+// the average node time with nanosecond resolution
+std::map<std::string, double> getNodeTimesUs(ExecutableNetwork &execNetwork) {
+    std::map<std::string, double> times;
+    CNNNetwork execGraph = execNetwork.GetExecGraphInfo();
+    for (const auto &layer : execGraph) {
+        auto time = layer->params.find("execTimeMcs");
+        if (time != layer->params.end() && time->second != "not_executed")
+            times[layer->name] = std::stod(time->second);
+    }
+    return times;
+}
+
+bool runCase(Core &ie, const OpCase &opCase, const ngraph::Shape &shape, const BenchConfig &config, BenchResult &result) {
+    CNNNetwork network(buildFunction(opCase, shape, config));
+
+    std::map<std::string, std::string> pluginConfig = {{CONFIG_KEY(PERF_COUNT), CONFIG_VALUE(YES)}};
+    if (config.precision == "BF16")
+        pluginConfig[CONFIG_KEY(ENFORCE_BF16)] = CONFIG_VALUE(YES);
+    else
+        pluginConfig[CONFIG_KEY(ENFORCE_BF16)] = CONFIG_VALUE(NO);
+    if (FLAGS_nthreads != 0)
+        pluginConfig[CONFIG_KEY(CPU_THREADS_NUM)] = std::to_string(FLAGS_nthreads);
+
+    auto execNetwork = ie.LoadNetwork(network, "CPU", pluginConfig);
+    auto request = execNetwork.CreateInferRequest();
+    for (const auto &input : network.getInputsInfo())
+        fillBlob(request.GetBlob(input.first));
+
+    for (uint32_t i = 0; i < FLAGS_nwarmup; i++)
+        request.Infer();
+    auto warmupTimes = getNodeTimesUs(execNetwork);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (uint32_t i = 0; i < FLAGS_niter; i++)
+        request.Infer();
+    auto finish = std::chrono::high_resolution_clock::now();
+
+    // Node times of the plugin are averaged over all inferences of the network,
+    // so warm-up inferences are excluded using the times taken after them.
+    const auto nodeTimes = getNodeTimesUs(execNetwork);
+    double nodeTimeUs = 0;
+    double maxNodeTime = -1;
+    for (const auto &counter : request.GetPerformanceCounts()) {
+        auto nodeTime = nodeTimes.find(counter.first);
+        if (!isMeasured(opCase, counter.second) || nodeTime == nodeTimes.end())
+            continue;
+
+        double totalTime = nodeTime->second * (FLAGS_nwarmup + FLAGS_niter);
+        auto warmup = warmupTimes.find(counter.first);
+        if (warmup != warmupTimes.end())
+            totalTime -= warmup->second * FLAGS_nwarmup;
+        double time = std::max(totalTime, 0.0) / std::max(FLAGS_niter, 1u);
+
+        nodeTimeUs += time;
+        if (time > maxNodeTime) {
+            maxNodeTime = time;
+            result.impl = counter.second.exec_type;
+        }
+    }
+    if (maxNodeTime < 0)
+        return false;
+
+    size_t elementSize = config.precision == "BF16" ? 2 : 4;
+    size_t outputElements = 0;
+    size_t totalElements = 0;
+    for (const auto &input : network.getInputsInfo())
+        totalElements += request.GetBlob(input.first)->size();
+    for (const auto &output : network.getOutputsInfo())
+        outputElements += request.GetBlob(output.first)->size();
+    totalElements += outputElements;
+
+    result.config = config;
+    result.nodeTimeUs = nodeTimeUs;
+    result.inferTimeUs = std::chrono::duration<double, std::micro>(finish - start).count() / std::max(FLAGS_niter, 1u);
+    if (nodeTimeUs > 0) {
+        result.nsPerElement = nodeTimeUs * 1e3 / outputElements;
+        result.gbPerSec = static_cast<double>(totalElements * elementSize) / (nodeTimeUs * 1e3);
+        result.gflops = opCase.flopsPerOutput(shape) * outputElements / (nodeTimeUs * 1e3);
+    }
+    return true;
+}
+
+void printResult(const BenchResult &result) {
+    std::cout << std::left << std::setw(20) << result.config.op
+              << std::setw(16) << result.config.shape
+              << std::setw(9) << result.config.layout
+              << std::setw(6) << result.config.precision
+              << std::setw(8) << result.config.isa
+              << std::setw(24) << result.impl
+              << std::right << std::fixed << std::setprecision(2)
+              << std::setw(12) << result.nodeTimeUs
+              << std::setw(12) << result.inferTimeUs
+              << std::setw(10) << result.nsPerElement
+              << std::setw(10) << result.gbPerSec
+              << std::setw(10) << result.gflops << std::endl;
+}
+
+const char reportHeader[] = "op,shape,layout,precision,isa,impl,node_time_us,infer_time_us,ns_per_element,gb_per_sec,gflops";
+
+void writeReport(const std::string &path, const std::vector<BenchResult> &results) {
+    std::ofstream report(path);
+    if (!report.is_open())
+        THROW_IE_EXCEPTION << "Cannot open report file: " << path;
+    report << reportHeader << std::endl;
+    for (const auto &result : results) {
+        report << result.config.key() << "," << result.impl << "," << result.nodeTimeUs << "," << result.inferTimeUs
+               << "," << result.nsPerElement << "," << result.gbPerSec << "," << result.gflops << std::endl;
+    }
+}
+
+std::map<std::string, double> readBaseline(const std::string &path) {
+    std::ifstream baseline(path);
+    if (!baseline.is_open())
+        THROW_IE_EXCEPTION << "Cannot open baseline file: " << path;
+
+    std::map<std::string, double> times;
+    std::string line;
+    std::getline(baseline, line);
+    if (line != reportHeader)
+        THROW_IE_EXCEPTION << "Unexpected baseline file format: " << path;
+    while (std::getline(baseline, line)) {
+        auto fields = split(line, ',');
+        if (fields.size() != 11)
+            continue;
+        BenchConfig config = {fields[0], fields[1], fields[2], fields[3], fields[4]};
+        times[config.key()] = std::stod(fields[6]);
+    }
+    return times;
+}
+
+/**
+ * Returns the number of configurations which became slower than the baseline by more than the threshold.
+ */
+size_t compareWithBaseline(const std::map<std::string, double> &baseline, const std::vector<BenchResult> &results) {
+    size_t regressions = 0;
+    std::cout << std::endl << "Comparison with baseline " << FLAGS_baseline << " (threshold "
+              << FLAGS_threshold << "%):" << std::endl;
+    for (const auto &result : results) {
+        auto it = baseline.find(result.config.key());
+        if (it == baseline.end() || it->second <= 0)
+            continue;
+        double change = (result.nodeTimeUs - it->second) / it->second * 100.0;
+        if (change > FLAGS_threshold) {
+            regressions++;
+            std::cout << "[ REGRESSION ] ";
+        } else if (change < -FLAGS_threshold) {
+            std::cout << "[ IMPROVEMENT ] ";
+        } else {
+            continue;
+        }
+        std::cout << result.config.key() << ": " << it->second << " us -> " << result.nodeTimeUs << " us ("
+                  << std::showpos << change << std::noshowpos << "%)" << std::endl;
+    }
+    std::cout << regressions << " regression(s) found" << std::endl;
+    return regressions;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    try {
+        gflags::ParseCommandLineNonHelpFlags(&argc, &argv, true);
+        if (FLAGS_h) {
+            showUsage();
+            return EXIT_SUCCESS;
+        }
+
+        auto cases = getOpCases();
+        if (FLAGS_list) {
+            for (const auto &opCase : cases)
+                std::cout << opCase.name << std::endl;
+            return EXIT_SUCCESS;
+        }
+
+        auto ops = split(FLAGS_ops, ',');
+        if (!ops.empty()) {
+            for (const auto &op : ops) {
+                if (std::none_of(cases.begin(), cases.end(), [&](const OpCase &opCase) { return opCase.name == op; }))
+                    THROW_IE_EXCEPTION << "Unsupported operation: " << op;
+            }
+            cases.erase(std::remove_if(cases.begin(), cases.end(), [&](const OpCase &opCase) {
+                return std::find(ops.begin(), ops.end(), opCase.name) == ops.end();
+            }), cases.end());
+        }
+
+        Core ie;
+        std::vector<BenchResult> results;
+
+        std::cout << std::left << std::setw(20) << "op" << std::setw(16) << "shape" << std::setw(9) << "layout"
+                  << std::setw(6) << "prec" << std::setw(8) << "isa" << std::setw(24) << "impl"
+                  << std::right << std::setw(12) << "node, us" << std::setw(12) << "infer, us"
+                  << std::setw(10) << "ns/elem" << std::setw(10) << "GB/s" << std::setw(10) << "GFLOPs" << std::endl;
+
+        for (const auto &opCase : cases) {
+            for (const auto &shapeStr : split(FLAGS_shapes, ',')) {
+                auto shape = parseShape(shapeStr);
+                for (const auto &layout : split(FLAGS_layouts, ',')) {
+                    for (const auto &precision : split(FLAGS_precisions, ',')) {
+                        for (const auto &isa : split(FLAGS_isa, ',')) {
+                            BenchConfig config = {opCase.name, shapeToString(shape), layout, precision, isa};
+                            BenchResult result;
+                            try {
+                                if (!runCase(ie, opCase, shape, config, result)) {
+                                    std::cout << config.key() << ": skipped, no measured nodes executed" << std::endl;
+                                    continue;
+                                }
+                            } catch (const std::exception &ex) {
+                                std::cout << config.key() << ": skipped, " << ex.what() << std::endl;
+                                continue;
+                            }
+                            printResult(result);
+                            results.push_back(result);
+                        }
+                    }
+                }
+            }
+        }
+
+        if (!FLAGS_report.empty())
+            writeReport(FLAGS_report, results);
+
+        if (!FLAGS_baseline.empty() && compareWithBaseline(readBaseline(FLAGS_baseline), results) != 0)
+            return EXIT_FAILURE;
+    } catch (const std::exception &ex) {
+        std::cerr << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
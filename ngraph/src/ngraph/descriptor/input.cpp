@@ -45,7 +45,12 @@ descriptor::Input::Input(Node* node, size_t index)
 
 descriptor::Input::~Input()
 {
-    remove_output();
+    // Nodes of a function are alive while they are reachable from its results, so destruction
+    // of a node doesn't change topology of any function
+    if (m_output != nullptr)
+    {
+        m_output->remove_input(this);
+    }
 }
 
 void descriptor::Input::replace_output(Output& new_output)
@@ -56,6 +61,7 @@ void descriptor::Input::replace_output(Output& new_output)
     }
     new_output.add_input(this);
     m_output = &new_output;
+    Node::topology_changed();
     m_src_node = std::shared_ptr<Node>(new_output.get_node());
 
     if (getenv_bool("NGRAPH_ENABLE_REPLACE_CHECK"))
@@ -79,6 +85,7 @@ void descriptor::Input::remove_output()
         m_output->remove_input(this);
         m_src_node = nullptr;
         m_output = nullptr;
+        Node::topology_changed();
     }
 }
 
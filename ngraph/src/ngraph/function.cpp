@@ -17,10 +17,12 @@
 #include <algorithm>
 #include <list>
 #include <memory>
+#include <unordered_set>
 
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/op/shape_of.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -94,6 +96,72 @@ void Function::validate_nodes_and_infer_types()
     }
 }
 
+void Function::validate_nodes_and_infer_types(const NodeVector& changed_nodes)
+{
+    if (changed_nodes.empty())
+    {
+        return;
+    }
+
+    // Nodes with changed output types or shapes
+    unordered_set<const Node*> changed;
+    // Nodes whose output values depend on changed shapes, their consumers may infer
+    // different shapes even if the shapes of these outputs stay the same
+    unordered_set<const Node*> values_changed;
+    for (const auto& node : changed_nodes)
+    {
+        changed.insert(node.get());
+    }
+
+    vector<element::Type> old_types;
+    vector<PartialShape> old_shapes;
+    for (auto& node : get_ordered_ops())
+    {
+        if (changed.count(node.get()) != 0)
+        {
+            continue;
+        }
+
+        bool inputs_changed = false;
+        bool input_values_changed = false;
+        for (const auto& input : node->inputs())
+        {
+            const Node* source = input.get_source_output().get_node();
+            inputs_changed = inputs_changed || changed.count(source) != 0;
+            input_values_changed = input_values_changed || values_changed.count(source) != 0;
+        }
+        if (!inputs_changed && !input_values_changed)
+        {
+            continue;
+        }
+
+        old_types.clear();
+        old_shapes.clear();
+        for (const auto& output : node->outputs())
+        {
+            old_types.push_back(output.get_element_type());
+            old_shapes.push_back(output.get_partial_shape());
+        }
+
+        node->revalidate_and_infer_types();
+
+        bool outputs_changed = node->get_output_size() != old_types.size();
+        for (size_t i = 0; i < old_types.size() && !outputs_changed; ++i)
+        {
+            outputs_changed = node->get_output_element_type(i) != old_types[i] ||
+                              !node->get_output_partial_shape(i).same_scheme(old_shapes[i]);
+        }
+        if (outputs_changed)
+        {
+            changed.insert(node.get());
+        }
+        if (input_values_changed || is_type<op::v0::ShapeOf>(node) || is_type<op::v3::ShapeOf>(node))
+        {
+            values_changed.insert(node.get());
+        }
+    }
+}
+
 void Function::init()
 {
     validate_nodes_and_infer_types();
@@ -101,6 +169,20 @@ void Function::init()
 
 std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
 {
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    // The version is read before sorting, so changes made during sorting invalidate the order
+    size_t version = Node::get_topology_version();
+    if (version == m_ordered_ops_version)
+    {
+        vector<shared_ptr<Node>> ordered_ops;
+        ordered_ops.reserve(m_ordered_ops.size());
+        for (auto node : m_ordered_ops)
+        {
+            ordered_ops.push_back(node->shared_from_this());
+        }
+        return ordered_ops;
+    }
+
     vector<shared_ptr<Node>> nodes;
     for (auto& r : get_results())
     {
@@ -111,7 +193,22 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
         nodes.push_back(param);
     }
 
-    return m_topological_sorter(nodes);
+    auto ordered_ops = m_topological_sorter(nodes);
+    m_ordered_ops.clear();
+    m_ordered_ops.reserve(ordered_ops.size());
+    for (auto& node : ordered_ops)
+    {
+        m_ordered_ops.push_back(node.get());
+    }
+    m_ordered_ops_version = version;
+    return ordered_ops;
+}
+
+void Function::invalidate_ordered_ops()
+{
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    m_ordered_ops.clear();
+    m_ordered_ops_version = 0;
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -287,9 +384,11 @@ void Function::replace_parameter(size_t parameter_index, const shared_ptr<op::Pa
                  " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
     m_parameters[parameter_index] = parameter;
+    invalidate_ordered_ops();
 }
 
 void Function::set_topological_sort(topological_sort_t sorter)
 {
     m_topological_sorter = sorter;
+    invalidate_ordered_ops();
 }
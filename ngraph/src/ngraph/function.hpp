@@ -20,6 +20,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -93,6 +94,11 @@ namespace ngraph
         const std::string& get_friendly_name() const;
 
         std::vector<std::shared_ptr<Node>> get_ops() const;
+        /// \brief Returns nodes of the function in topological order.
+        ///
+        /// The order is cached and is sorted again only after inputs or control dependencies
+        /// of some node were changed (see Node::get_topology_version) or parameters of the
+        /// function were replaced.
         std::vector<std::shared_ptr<Node>> get_ordered_ops() const;
         void map_unordered_ops(std::function<void(Node*)> f) const;
 
@@ -105,6 +111,18 @@ namespace ngraph
 
         void validate_nodes_and_infer_types();
 
+        /// \brief Revalidates only the nodes which depend on outputs of `changed_nodes`.
+        ///
+        /// Nodes are visited in topological order and a node is revalidated if at least one of
+        /// its inputs is produced by a changed node. A revalidated node is considered changed
+        /// only if the element type or the shape of some of its outputs has changed, so the
+        /// propagation stops at nodes which are not affected by the change. Output values of
+        /// ShapeOf depend on the shapes, so everything computed from them is always revalidated.
+        ///
+        /// \param changed_nodes Nodes whose outputs have been changed and which are valid
+        ///                      themselves, e.g. replaced parameters of the function.
+        void validate_nodes_and_infer_types(const NodeVector& changed_nodes);
+
         /// \brief Returns the sum of the size of all nodes in the graph plus the size of
         /// all constant data. This has little value beyond comparing the relative size of
         /// graphs and should not be considered the actual memory consumption of a graph.
@@ -141,5 +159,12 @@ namespace ngraph
         const std::string m_unique_name;
         size_t m_placement{0};
         topological_sort_t m_topological_sorter;
+
+        // Nodes of the cached order are alive while the topology is not changed because they
+        // are reachable from results, so raw pointers are kept to not extend their lifetime
+        void invalidate_ordered_ops();
+        mutable std::mutex m_ordered_ops_mutex;
+        mutable std::vector<Node*> m_ordered_ops;
+        mutable size_t m_ordered_ops_version{0};
     };
 }
@@ -15,9 +15,11 @@
 //*****************************************************************************
 
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <typeindex>
 #include <typeinfo>
+#include <unordered_set>
 
 #include "ngraph/autodiff/adjoints.hpp"
 #include "ngraph/descriptor/input.hpp"
@@ -35,6 +37,7 @@ using namespace std;
 using namespace ngraph;
 
 atomic<size_t> Node::m_next_instance_id(0);
+atomic<size_t> Node::s_topology_version(1);
 
 Node::Node(size_t output_size)
     : Node()
@@ -194,6 +197,7 @@ void Node::set_arguments(const NodeVector& arguments)
 
 void Node::set_arguments(const OutputVector& arguments)
 {
+    topology_changed();
     // Add this node as a user of each argument.
     size_t i = 0;
     for (auto& output : arguments)
@@ -289,12 +293,12 @@ void Node::set_output_type(size_t i, const element::Type& element_type, const Pa
     get_output_descriptor(i).get_tensor_ptr()->set_tensor_type(element_type, pshape);
 }
 
-std::deque<descriptor::Output>& Node::get_outputs()
+Node::OutputDescriptors& Node::get_outputs()
 {
     return m_outputs;
 }
 
-const std::deque<descriptor::Output>& Node::get_outputs() const
+const Node::OutputDescriptors& Node::get_outputs() const
 {
     return m_outputs;
 }
@@ -309,12 +313,27 @@ bool Node::is_constant() const
     return false;
 }
 
+namespace
+{
+    const std::string& intern_type_name(const char* type_name)
+    {
+        static std::mutex names_mutex;
+        static std::unordered_set<std::string> names;
+        std::lock_guard<std::mutex> guard(names_mutex);
+        return *names.emplace(type_name).first;
+    }
+}
+
 const std::string& Node::description() const
 {
     // Terrible transitional kludge to keep description working while we change
     // type_name to const_char and virtual description() to virtual get_type_name()
-    const_cast<Node*>(this)->m_node_type = get_type_name();
-    return m_node_type;
+    const char* type_name = get_type_name();
+    if (m_node_type == nullptr || *m_node_type != type_name)
+    {
+        m_node_type = &intern_type_name(type_name);
+    }
+    return *m_node_type;
 }
 
 const std::string& Node::get_friendly_name() const
@@ -350,14 +369,37 @@ void Node::set_placement(Placement placement)
     m_placement = placement;
 }
 
+Node::Annotations& Node::get_annotations()
+{
+    if (!m_annotations)
+    {
+        m_annotations.reset(new Annotations());
+    }
+    return *m_annotations;
+}
+
+Node::RTMap& Node::get_rt_info()
+{
+    return get_annotations().rt_info;
+}
+
+const Node::RTMap& Node::get_rt_info() const
+{
+    static const RTMap empty;
+    return m_annotations ? m_annotations->rt_info : empty;
+}
+
 void Node::add_provenance_group_member(const shared_ptr<Node>& node)
 {
-    m_provenance_group.insert(node);
+    get_annotations().provenance_group.insert(node);
 }
 
 void Node::remove_provenance_group_member(const shared_ptr<Node>& node)
 {
-    m_provenance_group.erase(node);
+    if (m_annotations)
+    {
+        m_annotations->provenance_group.erase(node);
+    }
 }
 
 void Node::replace_provenance_group_member(const shared_ptr<Node>& current_node,
@@ -376,7 +418,8 @@ void Node::replace_provenance_group_member(const shared_ptr<Node>& current_node,
 
 const set<shared_ptr<Node>>& Node::get_provenance_group_members() const
 {
-    return m_provenance_group;
+    static const set<shared_ptr<Node>> empty;
+    return m_annotations ? m_annotations->provenance_group : empty;
 }
 
 shared_ptr<Node> Node::add_provenance_group_members_above(const OutputVector& base)
@@ -408,7 +451,7 @@ shared_ptr<Node> Node::add_provenance_group_members_above(const OutputVector& ba
         add_provenance_group_member(node->shared_from_this());
         for (auto value : node->input_values())
         {
-            if (m_provenance_group.count(value.get_node_shared_ptr()) == 0)
+            if (get_annotations().provenance_group.count(value.get_node_shared_ptr()) == 0)
             {
                 todo.push_back(value.get_node());
             }
@@ -446,13 +489,15 @@ void Node::add_provenance_tags_above(const OutputVector& base,
 
 const std::unordered_set<std::string>& Node::get_provenance_tags() const
 {
-    return m_provenance_tags;
+    static const std::unordered_set<std::string> empty;
+    return m_annotations ? m_annotations->provenance_tags : empty;
 }
 
 void Node::add_provenance_tag(const std::string& tag)
 {
-    m_provenance_tags.insert(tag);
-    for (auto node : m_provenance_group)
+    auto& annotations = get_annotations();
+    annotations.provenance_tags.insert(tag);
+    for (auto node : annotations.provenance_group)
     {
         node->add_provenance_tag(tag);
     }
@@ -460,7 +505,10 @@ void Node::add_provenance_tag(const std::string& tag)
 
 void Node::remove_provenance_tag(const std::string& tag)
 {
-    m_provenance_tags.erase(tag);
+    if (m_annotations)
+    {
+        m_annotations->provenance_tags.erase(tag);
+    }
 }
 
 void Node::merge_provenance_tags_from(const std::shared_ptr<const Node>& source)
@@ -547,6 +595,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node)
     if (find(m_control_dependencies.begin(), m_control_dependencies.end(), node) ==
         m_control_dependencies.end())
     {
+        topology_changed();
         m_control_dependencies.push_back(node);
         if (find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this) ==
             node->m_control_dependents.end())
@@ -580,6 +629,7 @@ void Node::transfer_control_dependents(std::shared_ptr<Node> replacement)
 
 void Node::remove_control_dependency(std::shared_ptr<Node> node)
 {
+    topology_changed();
     {
         auto it = find(m_control_dependencies.begin(), m_control_dependencies.end(), node);
         if (it != m_control_dependencies.end())
@@ -598,6 +648,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
 
 void Node::clear_control_dependencies()
 {
+    topology_changed();
     for (auto& node : m_control_dependencies)
     {
         auto it = find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this);
@@ -617,6 +668,16 @@ void Node::clear_control_dependents()
     }
 }
 
+size_t Node::get_topology_version()
+{
+    return s_topology_version.load(memory_order_acquire);
+}
+
+void Node::topology_changed()
+{
+    s_topology_version.fetch_add(1, memory_order_acq_rel);
+}
+
 const op::AutoBroadcastSpec& Node::get_autob() const
 {
     static op::AutoBroadcastSpec s_spec;
@@ -43,6 +43,7 @@
 #include "ngraph/op/util/op_annotations.hpp"
 #include "ngraph/output_vector.hpp"
 #include "ngraph/placement.hpp"
+#include "ngraph/stable_vector.hpp"
 #include "ngraph/strides.hpp"
 #include "ngraph/type.hpp"
 
@@ -315,18 +316,22 @@ namespace ngraph
         /// \returns The stream os
         virtual std::ostream& write_description(std::ostream& os, uint32_t depth = 0) const;
 
-        std::deque<descriptor::Input>& get_inputs() NGRAPH_DEPRECATED("use inputs() instead")
+        /// Most nodes have a few inputs and a single output, so their descriptors are kept
+        /// inside the node. The containers provide the std::deque operations used with
+        /// descriptors: size(), empty(), at(), [], front(), back(), emplace_back() and iteration.
+        using InputDescriptors = StableVector<descriptor::Input, 3>;
+        using OutputDescriptors = StableVector<descriptor::Output, 1>;
+
+        InputDescriptors& get_inputs() NGRAPH_DEPRECATED("use inputs() instead")
         {
             return m_inputs;
         }
-        const std::deque<descriptor::Input>& get_inputs() const
-            NGRAPH_DEPRECATED("use inputs() instead")
+        const InputDescriptors& get_inputs() const NGRAPH_DEPRECATED("use inputs() instead")
         {
             return m_inputs;
         }
-        std::deque<descriptor::Output>& get_outputs() NGRAPH_DEPRECATED("use outputs() instead");
-        const std::deque<descriptor::Output>& get_outputs() const
-            NGRAPH_DEPRECATED("use outputs() instead");
+        OutputDescriptors& get_outputs() NGRAPH_DEPRECATED("use outputs() instead");
+        const OutputDescriptors& get_outputs() const NGRAPH_DEPRECATED("use outputs() instead");
 
         /// Get control dependencies registered on the node
         const std::vector<std::shared_ptr<Node>>& get_control_dependencies() const;
@@ -346,6 +351,11 @@ namespace ngraph
         /// Remove this node as a dependency from all dependent nodes
         void clear_control_dependents();
 
+        /// \brief Returns a counter which is incremented every time inputs or control
+        ///        dependencies of an existing node are changed. Function keeps its topological
+        ///        order while the counter is not changed.
+        static size_t get_topology_version();
+
         /// This node absorbs the control dependencies of source_node
         void add_node_control_dependencies(std::shared_ptr<Node> source_node);
 
@@ -479,8 +489,8 @@ namespace ngraph
 
         using RTMap = std::map<std::string, std::shared_ptr<Variant>>;
 
-        RTMap& get_rt_info() { return m_rt_info; }
-        const RTMap& get_rt_info() const { return m_rt_info; }
+        RTMap& get_rt_info();
+        const RTMap& get_rt_info() const;
         const std::unordered_set<std::string>& get_provenance_tags() const;
         void add_provenance_tag(const std::string& tag);
         template <typename T>
@@ -577,21 +587,30 @@ namespace ngraph
         descriptor::Input& get_input_descriptor(size_t position);
         descriptor::Output& get_output_descriptor(size_t position);
 
+        /// Provenance and runtime info are set for a few nodes, so they are allocated on demand
+        struct Annotations
+        {
+            std::unordered_set<std::string> provenance_tags;
+            std::set<std::shared_ptr<Node>> provenance_group;
+            RTMap rt_info;
+        };
+        Annotations& get_annotations();
+        static void topology_changed();
+
         std::vector<Node*> m_control_dependents;
         std::vector<std::shared_ptr<Node>> m_control_dependencies;
-        std::string m_node_type;
+        // Interned type name, nodes of one type share the same string
+        mutable const std::string* m_node_type = nullptr;
         size_t m_instance_id{m_next_instance_id.fetch_add(1)};
         std::string m_friendly_name;
         std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
-        std::unordered_set<std::string> m_provenance_tags;
-        std::set<std::shared_ptr<Node>> m_provenance_group;
-        std::deque<descriptor::Input> m_inputs;
-        std::deque<descriptor::Output> m_outputs;
-        std::unordered_map<Node*, autodiff::Adjoints> m_adjoint_map;
+        static std::atomic<size_t> s_topology_version;
+        InputDescriptors m_inputs;
+        OutputDescriptors m_outputs;
+        std::unique_ptr<Annotations> m_annotations;
         Placement m_placement = Placement::DEFAULT;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
-        std::map<std::string, std::shared_ptr<Variant>> m_rt_info;
     };
 
     using NodeTypeInfo = Node::type_info_t;
@@ -0,0 +1,85 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "ngraph/node_arena.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+struct NodeArena::State
+{
+    explicit State(size_t block_size)
+        : m_block_size(block_size)
+    {
+    }
+
+    mutex m_mutex;
+    vector<unique_ptr<char[]>> m_blocks;
+    size_t m_block_size;
+    char* m_current = nullptr;
+    size_t m_available = 0;
+    size_t m_allocated = 0;
+};
+
+NodeArena::NodeArena(size_t block_size)
+    : m_state(make_shared<State>(max<size_t>(block_size, 64)))
+{
+}
+
+NodeArena::~NodeArena()
+{
+}
+
+size_t NodeArena::get_allocated_size() const
+{
+    lock_guard<mutex> lock(m_state->m_mutex);
+    return m_state->m_allocated;
+}
+
+void* NodeArena::allocate(State& state, size_t size, size_t alignment)
+{
+    lock_guard<mutex> lock(state.m_mutex);
+    size_t padding = (alignment - reinterpret_cast<uintptr_t>(state.m_current) % alignment) %
+                     alignment;
+    if (state.m_current == nullptr || padding + size > state.m_available)
+    {
+        // Large objects get a block of their own and don't waste the rest of the current block
+        const bool dedicated = size + alignment > state.m_block_size / 4;
+        const size_t block_size = dedicated ? size + alignment : state.m_block_size;
+        state.m_blocks.emplace_back(new char[block_size]);
+        char* block = state.m_blocks.back().get();
+        if (dedicated)
+        {
+            state.m_allocated += size;
+            size_t block_padding =
+                (alignment - reinterpret_cast<uintptr_t>(block) % alignment) % alignment;
+            return block + block_padding;
+        }
+        state.m_current = block;
+        state.m_available = block_size;
+        padding = (alignment - reinterpret_cast<uintptr_t>(block) % alignment) % alignment;
+    }
+    void* result = state.m_current + padding;
+    state.m_current += padding + size;
+    state.m_available -= padding + size;
+    state.m_allocated += size;
+    return result;
+}
@@ -0,0 +1,113 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    /// \brief Bump allocator for the nodes of one graph.
+    ///
+    /// Nodes made by the arena are placed one after another in large blocks instead of a
+    /// separate heap allocation per node, which makes building and traversing graphs with many
+    /// nodes cheaper. Memory of a node is not reused when the node is destroyed; all blocks are
+    /// released when the arena and every node made by it are destroyed, so a graph builder
+    /// (e.g. a model reader) should use one arena per Function it builds.
+    ///
+    /// \code{.cpp}
+    /// NodeArena arena;
+    /// auto param = arena.make<op::Parameter>(element::f32, Shape{1, 3});
+    /// auto relu = arena.make<op::Relu>(param);
+    /// \endcode
+    class NGRAPH_API NodeArena
+    {
+        struct State;
+
+    public:
+        /// \brief STL allocator which allocates from the arena
+        template <typename T>
+        class Allocator
+        {
+        public:
+            using value_type = T;
+
+            explicit Allocator(std::shared_ptr<State> state)
+                : m_state(std::move(state))
+            {
+            }
+            template <typename U>
+            Allocator(const Allocator<U>& other)
+                : m_state(other.m_state)
+            {
+            }
+
+            T* allocate(size_t n)
+            {
+                return static_cast<T*>(NodeArena::allocate(*m_state, n * sizeof(T), alignof(T)));
+            }
+            void deallocate(T*, size_t) {}
+            template <typename U>
+            bool operator==(const Allocator<U>& other) const
+            {
+                return m_state == other.m_state;
+            }
+            template <typename U>
+            bool operator!=(const Allocator<U>& other) const
+            {
+                return m_state != other.m_state;
+            }
+
+        private:
+            template <typename>
+            friend class Allocator;
+
+            std::shared_ptr<State> m_state;
+        };
+
+        /// \param block_size Size of the blocks requested from the heap
+        explicit NodeArena(size_t block_size = 1 << 20);
+        NodeArena(const NodeArena&) = delete;
+        NodeArena& operator=(const NodeArena&) = delete;
+        ~NodeArena();
+
+        /// \brief Creates an object (usually a node) in the arena
+        template <typename T, typename... Args>
+        std::shared_ptr<T> make(Args&&... args)
+        {
+            return std::allocate_shared<T>(Allocator<T>(m_state), std::forward<Args>(args)...);
+        }
+
+        /// \return Allocator which allocates from the arena
+        template <typename T>
+        Allocator<T> get_allocator() const
+        {
+            return Allocator<T>(m_state);
+        }
+
+        /// \return Number of bytes allocated from the arena
+        size_t get_allocated_size() const;
+
+    private:
+        static void* allocate(State& state, size_t size, size_t alignment);
+
+        std::shared_ptr<State> m_state;
+    };
+}
@@ -18,12 +18,29 @@
 #include "ngraph/node.hpp"
 #include "ngraph/variant.hpp"
 
+namespace
+{
+    // Runtime info is allocated on the first non-const access, so it is read with const access
+    const ngraph::Node::RTMap& get_rt_info(const std::shared_ptr<ngraph::Node>& node)
+    {
+        return static_cast<const ngraph::Node&>(*node).get_rt_info();
+    }
+
+    void set_rt_info(const std::shared_ptr<ngraph::Node>& node, const ngraph::Node::RTMap& rtInfo)
+    {
+        if (!rtInfo.empty() || !get_rt_info(node).empty())
+        {
+            node->get_rt_info() = rtInfo;
+        }
+    }
+}
+
 ngraph::Node::RTMap mergeRuntimeInfo(const ngraph::NodeVector& nodes)
 {
     ngraph::Node::RTMap mergedInfo;
     for (auto& node : nodes)
     {
-        for (auto& item : node->get_rt_info())
+        for (auto& item : get_rt_info(node))
         {
             mergedInfo[item.first] = item.second;
         }
@@ -43,9 +60,7 @@ ngraph::Node::RTMap mergeRuntimeInfo(const ngraph::NodeVector& nodes)
 
 void ngraph::copy_runtime_info(std::shared_ptr<ngraph::Node> from, std::shared_ptr<ngraph::Node> to)
 {
-    auto& rtInfoFrom = from->get_rt_info();
-    auto& rtInfoTo = to->get_rt_info();
-    rtInfoTo = rtInfoFrom;
+    set_rt_info(to, get_rt_info(from));
 }
 
 void ngraph::copy_runtime_info(std::shared_ptr<ngraph::Node> from, ngraph::NodeVector to)
@@ -58,8 +73,7 @@ void ngraph::copy_runtime_info(std::shared_ptr<ngraph::Node> from, ngraph::NodeV
 
 void ngraph::copy_runtime_info(const ngraph::NodeVector& from, std::shared_ptr<ngraph::Node> to)
 {
-    auto& rtInfoTo = to->get_rt_info();
-    rtInfoTo = mergeRuntimeInfo(from);
+    set_rt_info(to, mergeRuntimeInfo(from));
 }
 
 void ngraph::copy_runtime_info(const ngraph::NodeVector& from, ngraph::NodeVector to)
@@ -67,7 +81,6 @@ void ngraph::copy_runtime_info(const ngraph::NodeVector& from, ngraph::NodeVecto
     auto mergedInfo = mergeRuntimeInfo(from);
     for (auto& node : to)
     {
-        auto& rtInfoTo = node->get_rt_info();
-        rtInfoTo = mergedInfo;
+        set_rt_info(node, mergedInfo);
     }
 }
@@ -0,0 +1,202 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ngraph
+{
+    /// \brief A sequence which keeps the first N elements inside the object and never moves
+    ///        elements, so references to the elements stay valid while elements are appended.
+    ///
+    /// Nodes keep their input and output descriptors in StableVector: descriptors refer to each
+    /// other by pointers and most nodes have a few ports, so the ports don't need separate
+    /// allocations. Elements after the first N are kept in a lazily allocated std::deque.
+    template <typename T, size_t N>
+    class StableVector
+    {
+    public:
+        template <typename Container, typename Value>
+        class Iterator
+        {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = typename std::remove_const<Value>::type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = Value*;
+            using reference = Value&;
+
+            Iterator() = default;
+            Iterator(Container* container, size_t index)
+                : m_container(container)
+                , m_index(index)
+            {
+            }
+            // iterator to const_iterator conversion
+            template <typename OtherContainer, typename OtherValue>
+            Iterator(const Iterator<OtherContainer, OtherValue>& other)
+                : m_container(other.m_container)
+                , m_index(other.m_index)
+            {
+            }
+
+            reference operator*() const { return (*m_container)[m_index]; }
+            pointer operator->() const { return &(*m_container)[m_index]; }
+            reference operator[](difference_type n) const { return (*m_container)[m_index + n]; }
+            Iterator& operator++()
+            {
+                ++m_index;
+                return *this;
+            }
+            Iterator operator++(int)
+            {
+                Iterator result = *this;
+                ++m_index;
+                return result;
+            }
+            Iterator& operator--()
+            {
+                --m_index;
+                return *this;
+            }
+            Iterator operator--(int)
+            {
+                Iterator result = *this;
+                --m_index;
+                return result;
+            }
+            Iterator& operator+=(difference_type n)
+            {
+                m_index += n;
+                return *this;
+            }
+            Iterator& operator-=(difference_type n)
+            {
+                m_index -= n;
+                return *this;
+            }
+            Iterator operator+(difference_type n) const { return Iterator(m_container, m_index + n); }
+            Iterator operator-(difference_type n) const { return Iterator(m_container, m_index - n); }
+            difference_type operator-(const Iterator& other) const
+            {
+                return static_cast<difference_type>(m_index) -
+                       static_cast<difference_type>(other.m_index);
+            }
+            bool operator==(const Iterator& other) const { return m_index == other.m_index; }
+            bool operator!=(const Iterator& other) const { return m_index != other.m_index; }
+            bool operator<(const Iterator& other) const { return m_index < other.m_index; }
+            bool operator>(const Iterator& other) const { return m_index > other.m_index; }
+            bool operator<=(const Iterator& other) const { return m_index <= other.m_index; }
+            bool operator>=(const Iterator& other) const { return m_index >= other.m_index; }
+        private:
+            template <typename, typename>
+            friend class Iterator;
+
+            Container* m_container = nullptr;
+            size_t m_index = 0;
+        };
+
+        using value_type = T;
+        using size_type = size_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using iterator = Iterator<StableVector, T>;
+        using const_iterator = Iterator<const StableVector, const T>;
+
+        StableVector() = default;
+        StableVector(const StableVector&) = delete;
+        StableVector& operator=(const StableVector&) = delete;
+        ~StableVector() { clear(); }
+        size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+        T& operator[](size_t i) { return i < N ? inline_data()[i] : (*m_overflow)[i - N]; }
+        const T& operator[](size_t i) const
+        {
+            return i < N ? inline_data()[i] : (*m_overflow)[i - N];
+        }
+        T& at(size_t i)
+        {
+            check_index(i);
+            return (*this)[i];
+        }
+        const T& at(size_t i) const
+        {
+            check_index(i);
+            return (*this)[i];
+        }
+        T& front() { return (*this)[0]; }
+        const T& front() const { return (*this)[0]; }
+        T& back() { return (*this)[m_size - 1]; }
+        const T& back() const { return (*this)[m_size - 1]; }
+        iterator begin() { return iterator(this, 0); }
+        iterator end() { return iterator(this, m_size); }
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, m_size); }
+        const_iterator cbegin() const { return begin(); }
+        const_iterator cend() const { return end(); }
+        template <typename... Args>
+        T& emplace_back(Args&&... args)
+        {
+            if (m_size < N)
+            {
+                new (inline_data() + m_size) T(std::forward<Args>(args)...);
+            }
+            else
+            {
+                if (!m_overflow)
+                {
+                    m_overflow.reset(new std::deque<T>());
+                }
+                m_overflow->emplace_back(std::forward<Args>(args)...);
+            }
+            return (*this)[m_size++];
+        }
+
+        void push_back(const T& value) { emplace_back(value); }
+        void clear()
+        {
+            m_overflow.reset();
+            for (size_t i = 0; i < m_size && i < N; ++i)
+            {
+                inline_data()[i].~T();
+            }
+            m_size = 0;
+        }
+
+    private:
+        T* inline_data() { return reinterpret_cast<T*>(m_inline); }
+        const T* inline_data() const { return reinterpret_cast<const T*>(m_inline); }
+        void check_index(size_t i) const
+        {
+            if (i >= m_size)
+            {
+                throw std::out_of_range("StableVector index is out of range");
+            }
+        }
+
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type m_inline[N];
+        std::unique_ptr<std::deque<T>> m_overflow;
+        size_t m_size = 0;
+    };
+}
@@ -236,3 +236,178 @@ TEST(build_graph, default_output_checks)
         FAIL() << "nullptr initialization of Output failed";
     }
 }
+
+TEST(build_graph, ordered_ops_follow_graph_changes)
+{
+    auto arg0 = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto arg1 = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto add = make_shared<op::Add>(arg0, arg1);
+    auto abs = make_shared<op::Abs>(add);
+    auto f = make_shared<Function>(NodeVector{abs}, ParameterVector{arg0, arg1});
+
+    auto ops = f->get_ordered_ops();
+    ASSERT_EQ(ops.size(), 5);
+    EXPECT_EQ(ops, f->get_ordered_ops());
+
+    auto neg = make_shared<op::Negative>(arg1);
+    auto mul = make_shared<op::Multiply>(arg0, neg);
+    replace_node(add, mul);
+    ops = f->get_ordered_ops();
+    ASSERT_EQ(ops.size(), 6);
+    EXPECT_EQ(count(ops.begin(), ops.end(), add), 0);
+    EXPECT_LT(find(ops.begin(), ops.end(), neg), find(ops.begin(), ops.end(), mul));
+    EXPECT_LT(find(ops.begin(), ops.end(), mul), find(ops.begin(), ops.end(), abs));
+
+    auto cdep = make_shared<op::Abs>(arg1);
+    mul->add_control_dependency(cdep);
+    ops = f->get_ordered_ops();
+    ASSERT_EQ(ops.size(), 7);
+    EXPECT_LT(find(ops.begin(), ops.end(), cdep), find(ops.begin(), ops.end(), mul));
+
+    mul->remove_control_dependency(cdep);
+    EXPECT_EQ(f->get_ordered_ops().size(), 6);
+
+    auto arg2 = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    f->replace_parameter(0, arg2);
+    ops = f->get_ordered_ops();
+    EXPECT_EQ(count(ops.begin(), ops.end(), arg0), 0);
+    EXPECT_EQ(count(ops.begin(), ops.end(), arg2), 1);
+}
+
+TEST(build_graph, set_arguments_changes_topology)
+{
+    auto arg0 = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto arg1 = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto add = make_shared<op::Add>();
+
+    auto version = Node::get_topology_version();
+    add->set_arguments(OutputVector{arg0, arg1});
+    EXPECT_NE(version, Node::get_topology_version());
+    EXPECT_EQ(arg0->output(0).get_target_inputs().size(), 1u);
+}
+
+namespace
+{
+    class ValidationCounter : public op::Op
+    {
+    public:
+        static constexpr NodeTypeInfo type_info{"ValidationCounter", 0};
+        const NodeTypeInfo& get_type_info() const override { return type_info; }
+        ValidationCounter(const Output<Node>& arg)
+            : Op({arg})
+        {
+            constructor_validate_and_infer_types();
+        }
+
+        void validate_and_infer_types() override
+        {
+            ++num_validations;
+            set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+        }
+
+        std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override
+        {
+            return make_shared<ValidationCounter>(new_args.at(0));
+        }
+
+        size_t num_validations = 0;
+    };
+    constexpr NodeTypeInfo ValidationCounter::type_info;
+}
+
+TEST(build_graph, validate_changed_nodes_only)
+{
+    auto arg0 = make_shared<op::Parameter>(element::f32, Shape{1, 4});
+    auto arg1 = make_shared<op::Parameter>(element::f32, Shape{1, 4});
+    auto direct = make_shared<ValidationCounter>(arg0);
+    auto shape_of = make_shared<op::ShapeOf>(arg0);
+    auto after_shape_of = make_shared<ValidationCounter>(shape_of);
+    auto independent = make_shared<ValidationCounter>(arg1);
+    auto f = make_shared<Function>(NodeVector{direct, after_shape_of, independent},
+                                   ParameterVector{arg0, arg1});
+    direct->num_validations = after_shape_of->num_validations = independent->num_validations = 0;
+
+    auto new_arg0 = make_shared<op::Parameter>(element::f32, Shape{3, 4});
+    f->replace_parameter(0, new_arg0);
+    f->validate_nodes_and_infer_types(NodeVector{new_arg0});
+
+    EXPECT_EQ(direct->num_validations, 1u);
+    EXPECT_EQ(direct->get_output_shape(0), (Shape{3, 4}));
+    EXPECT_EQ(f->get_output_shape(0), (Shape{3, 4}));
+    // the output shape of ShapeOf is the same, but its value is changed
+    EXPECT_EQ(after_shape_of->num_validations, 1u);
+    EXPECT_EQ(independent->num_validations, 0u);
+
+    new_arg0 = make_shared<op::Parameter>(element::f32, Shape{3, 4, 5});
+    f->replace_parameter(0, new_arg0);
+    f->validate_nodes_and_infer_types(NodeVector{new_arg0});
+
+    EXPECT_EQ(direct->num_validations, 2u);
+    EXPECT_EQ(after_shape_of->num_validations, 2u);
+    EXPECT_EQ(f->get_output_shape(1), (Shape{3}));
+    EXPECT_EQ(independent->num_validations, 0u);
+}
+
+TEST(build_graph, validate_changed_nodes_shape_of_reshape)
+{
+    auto arg0 = make_shared<op::Parameter>(element::f32, Shape{2, 4});
+    auto arg1 = make_shared<op::Parameter>(element::f32, Shape{2, 4});
+    auto relu = make_shared<op::Relu>(arg0);
+    auto shape_of = make_shared<op::ShapeOf>(relu);
+    auto pattern = make_shared<ValidationCounter>(shape_of);
+    auto reshape = make_shared<op::v1::Reshape>(arg1, pattern, false);
+    auto after_reshape = make_shared<ValidationCounter>(reshape);
+    auto f = make_shared<Function>(NodeVector{after_reshape}, ParameterVector{arg0, arg1});
+    pattern->num_validations = after_reshape->num_validations = 0;
+
+    // shapes of ShapeOf and of the pattern don't change, but the pattern value does
+    auto new_arg0 = make_shared<op::Parameter>(element::f32, Shape{4, 2});
+    f->replace_parameter(0, new_arg0);
+    f->validate_nodes_and_infer_types(NodeVector{new_arg0});
+
+    EXPECT_EQ(shape_of->get_output_shape(0), (Shape{2}));
+    EXPECT_EQ(pattern->num_validations, 1u);
+    EXPECT_EQ(after_reshape->num_validations, 1u);
+    EXPECT_EQ(after_reshape->get_output_partial_shape(0).rank(), Rank(2));
+
+    // the data of Reshape doesn't depend on shapes, so its consumers are validated only if
+    // its output changes
+    auto new_arg1 = make_shared<op::Parameter>(element::f32, Shape{8});
+    f->replace_parameter(1, new_arg1);
+    f->validate_nodes_and_infer_types(NodeVector{new_arg1});
+
+    EXPECT_EQ(pattern->num_validations, 1u);
+    EXPECT_EQ(after_reshape->num_validations, 1u);
+}
+
+TEST(build_graph, DISABLED_benchmark_ordered_ops)
+{
+    auto param = make_shared<op::Parameter>(element::f32, Shape{1, 16});
+    Output<Node> last = param;
+    for (size_t i = 0; i < 50000; i++)
+    {
+        last = make_shared<op::Add>(make_shared<op::Abs>(last), last);
+    }
+    auto f = make_shared<Function>(OutputVector{last}, ParameterVector{param});
+
+    constexpr size_t num_iterations = 100;
+    stopwatch sw;
+    sw.start();
+    for (size_t i = 0; i < num_iterations; i++)
+    {
+        f->get_ordered_ops();
+    }
+    sw.stop();
+    size_t cached_ms = sw.get_milliseconds();
+
+    sw.start();
+    for (size_t i = 0; i < num_iterations; i++)
+    {
+        topological_sort(f->get_results());
+    }
+    sw.stop();
+
+    std::cout << num_iterations << " get_ordered_ops of " << f->get_ordered_ops().size()
+              << " nodes: " << cached_ms << " ms cached, " << sw.get_milliseconds()
+              << " ms sorted" << std::endl;
+}
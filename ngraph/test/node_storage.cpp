@@ -0,0 +1,103 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/node_arena.hpp"
+#include "ngraph/rt_info.hpp"
+#include "ngraph/stable_vector.hpp"
+#include "ngraph/variant.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(node_storage, stable_vector_keeps_references)
+{
+    StableVector<vector<int>, 2> values;
+    vector<vector<int>*> addresses;
+    for (int i = 0; i < 100; ++i)
+    {
+        addresses.push_back(&values.emplace_back(1, i));
+    }
+    ASSERT_EQ(values.size(), 100);
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(addresses[i], &values[i]);
+        EXPECT_EQ(values.at(i).at(0), i);
+    }
+    EXPECT_EQ(values.end() - values.begin(), 100);
+    EXPECT_THROW(values.at(100), std::out_of_range);
+    values.clear();
+    EXPECT_TRUE(values.empty());
+}
+
+TEST(node_storage, many_inputs)
+{
+    NodeVector args;
+    for (size_t i = 0; i < 10; ++i)
+    {
+        args.push_back(make_shared<op::Parameter>(element::f32, Shape{1, 2}));
+    }
+    auto concat = make_shared<op::Concat>(args, 0);
+    ASSERT_EQ(concat->get_input_size(), 10);
+    EXPECT_EQ(concat->get_output_shape(0), (Shape{10, 2}));
+    for (size_t i = 0; i < args.size(); ++i)
+    {
+        EXPECT_EQ(concat->get_input_node_shared_ptr(i), args[i]);
+        auto targets = args[i]->output(0).get_target_inputs();
+        ASSERT_EQ(targets.size(), 1);
+        EXPECT_EQ(targets.begin()->get_index(), i);
+    }
+}
+
+TEST(node_storage, annotations)
+{
+    auto param = make_shared<op::Parameter>(element::f32, Shape{1, 2});
+    auto relu = make_shared<op::Relu>(param);
+    const Node& const_relu = *relu;
+    EXPECT_TRUE(const_relu.get_rt_info().empty());
+    EXPECT_TRUE(const_relu.get_provenance_tags().empty());
+
+    relu->add_provenance_tag("tag");
+    relu->get_rt_info()["key"] = make_shared<VariantWrapper<string>>("value");
+    copy_runtime_info(relu, param);
+    EXPECT_EQ(relu->get_provenance_tags().count("tag"), 1);
+    EXPECT_EQ(param->get_rt_info().count("key"), 1);
+    EXPECT_EQ(relu->description(), "Relu");
+}
+
+TEST(node_storage, arena)
+{
+    shared_ptr<Function> f;
+    {
+        NodeArena arena;
+        auto param = arena.make<op::Parameter>(element::f32, Shape{1, 2});
+        auto relu = arena.make<op::Relu>(param);
+        auto result = arena.make<op::Result>(relu);
+        f = make_shared<Function>(ResultVector{result}, ParameterVector{param});
+        EXPECT_GT(arena.get_allocated_size(), 0);
+    }
+    // Nodes stay valid after the arena is destroyed
+    ASSERT_EQ(f->get_ordered_ops().size(), 3);
+    EXPECT_EQ(f->get_output_shape(0), (Shape{1, 2}));
+    auto clone = clone_function(*f);
+    EXPECT_EQ(clone->get_ordered_ops().size(), 3);
+}
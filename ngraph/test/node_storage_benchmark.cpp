@@ -0,0 +1,126 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <iostream>
+#include <memory>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include "gtest/gtest.h"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/node_arena.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Build, get_ordered_ops and clone time of a large graph, with nodes allocated on the heap and
+// in a NodeArena. Run with --gtest_also_run_disabled_tests --gtest_filter=*benchmark_node_storage*
+
+namespace
+{
+    // Bytes in use on the heap, mallinfo() is deprecated since glibc 2.33
+    size_t get_heap_usage()
+    {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+        return mallinfo2().uordblks;
+#else
+        return 0;
+#endif
+    }
+
+    template <typename Make>
+    shared_ptr<Function> make_chain(size_t num_nodes, Make& make)
+    {
+        auto param = make.template make<op::Parameter>(element::f32, Shape{1, 16});
+        Output<Node> last = param;
+        for (size_t i = 0; i < num_nodes; ++i)
+        {
+            auto relu = make.template make<op::Relu>(last);
+            last = make.template make<op::Add>(relu, last);
+        }
+        return make_shared<Function>(ResultVector{make.template make<op::Result>(last)},
+                                     ParameterVector{param});
+    }
+
+    struct HeapMake
+    {
+        template <typename T, typename... Args>
+        shared_ptr<T> make(Args&&... args)
+        {
+            return make_shared<T>(std::forward<Args>(args)...);
+        }
+    };
+
+    struct ArenaMake
+    {
+        template <typename T, typename... Args>
+        shared_ptr<T> make(Args&&... args)
+        {
+            return arena.make<T>(std::forward<Args>(args)...);
+        }
+        NodeArena arena;
+    };
+
+    template <typename Make>
+    void benchmark_graph(const string& name, Make& make)
+    {
+        constexpr size_t num_nodes = 100000;
+        stopwatch sw;
+        size_t heap = get_heap_usage();
+
+        sw.start();
+        auto f = make_chain(num_nodes, make);
+        sw.stop();
+        size_t build_ms = sw.get_milliseconds();
+        heap = get_heap_usage() - heap;
+
+        sw.start();
+        size_t ordered = f->get_ordered_ops().size();
+        sw.stop();
+        size_t order_ms = sw.get_milliseconds();
+
+        sw.start();
+        auto clone = clone_function(*f);
+        sw.stop();
+        size_t clone_ms = sw.get_milliseconds();
+
+        std::cout << name << ": " << ordered << " nodes, build " << build_ms << " ms, "
+                  << "get_ordered_ops " << order_ms << " ms, clone " << clone_ms << " ms";
+        if (heap != 0)
+        {
+            std::cout << ", heap " << heap / 1024 << " KB";
+        }
+        std::cout << std::endl;
+    }
+}
+
+TEST(node_storage, DISABLED_benchmark_node_storage_heap)
+{
+    HeapMake make;
+    benchmark_graph("heap", make);
+}
+
+TEST(node_storage, DISABLED_benchmark_node_storage_arena)
+{
+    ArenaMake make;
+    benchmark_graph("arena", make);
+    std::cout << "arena: " << make.arena.get_allocated_size() / 1024 << " KB in the arena"
+              << std::endl;
+}